@@ -0,0 +1,691 @@
+/*
+ * Benchmarks.cpp
+ *
+ * The Primary Driver Source File for the Benchmark Harness.
+ *
+ * Contains the main (`wmain()`) method for the Benchmark Harness, which measures the
+ * `Console` rendering stack, the restoration of nested Alternate Output Buffers,
+ * the dispatch of keys to the Actions of a `MenuOptionList`,
+ * the reading and writing of the Active Display Monitor in Terraria Configuration Files,
+ * including reads answered from the `ConfigurationMetadataCache`,
+ * the retrieval of the Connected Display Monitors, the work done when launching the program
+ * in Apply-Last Mode compared to an Interactive Launch, and the application of a precompiled Monitor Preset.
+ *
+ * All `Console` output is written to an Off-Screen Console Output Buffer with a fixed size,
+ * so that the results do not depend on the size of the Console Window or on the Console
+ * having to render anything, and are printed to the Standard Output Buffer once finished.
+ *
+ * The benchmarks are always run by a Child Process within a temporary directory, so that any
+ * Program Data they write is removed afterwards instead of being added to that of the program.
+ */
+
+
+#include "ConfigurationFile.h"
+#include "Console.h"
+#include "DisplayTopology.h"
+#include "MonitorPresets.h"
+#include "UserInterface.h"
+#include "WatchMode.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>   // std::function
+#include <iostream>
+#include <numeric>      // std::accumulate
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Type Definitions */
+
+    // A structure type containing the timings measured for a single benchmark.
+    typedef struct BenchmarkResultStruct {
+
+        std::wstring name;          // The name of the benchmark.
+        size_t iterations;          // The number of timed iterations of the benchmark.
+        double minMicroseconds;     // The duration of the fastest iteration, in microseconds.
+        double medianMicroseconds;  // The median duration of all iterations, in microseconds.
+        double meanMicroseconds;    // The mean duration of all iterations, in microseconds.
+
+    } BenchmarkResult;
+
+
+    /* Constants */
+
+    // The width of the Off-Screen Console Output Buffer, in columns.
+    static const SHORT OFF_SCREEN_BUFFER_WIDTH = 120;
+    // The height of the Off-Screen Console Output Buffer, in rows.
+    static const SHORT OFF_SCREEN_BUFFER_HEIGHT = 3000;
+    // The height of the Window of the Off-Screen Console Output Buffer, in rows.
+    static const SHORT OFF_SCREEN_WINDOW_HEIGHT = 30;
+
+    // The sizes of the synthetic Terraria Configuration Files, in bytes.
+    static const size_t CONFIG_FILE_SIZES[] = { 1ULL << 10, 64ULL << 10, 1ULL << 20, 10ULL << 20 };
+    // The number of Menu Options in each of the `MenuOptionList`s.
+    static const size_t MENU_OPTION_COUNTS[] = { 10ULL, 100ULL, 1000ULL };
+
+    // The name of the benchmark for Apply-Last Mode, whose median duration is compared against the `APPLY_LAST_TARGET_MILLISECONDS`.
+    static const std::wstring APPLY_LAST_BENCHMARK_NAME = L"Apply-Last Launch (--apply-last)";
+    // The target wall time of launching the program in Apply-Last Mode, in milliseconds.
+    static const double APPLY_LAST_TARGET_MILLISECONDS = 20.0;
+
+
+    /* Helper Functions */
+
+    /**
+     * Create the Off-Screen Console Output Buffer and make it the Standard Output Buffer,
+     * so that it is used by the `Console` once it is created.
+     *
+     * The Off-Screen Console Output Buffer is never made the Active Console Output Buffer,
+     * and is given a fixed size so that the results are reproducible.
+     *
+     * @returns     The handle to the Off-Screen Console Output Buffer, or `INVALID_HANDLE_VALUE` on failure.
+     */
+    static HANDLE createOffScreenBuffer () {
+
+        HANDLE bufferHandle = CreateConsoleScreenBuffer(        // The handle to the Off-Screen Console Output Buffer.
+            GENERIC_READ | GENERIC_WRITE,
+            0,
+            NULL,
+            CONSOLE_TEXTMODE_BUFFER,
+            NULL
+        );
+        SMALL_RECT windowRect = {                               // The Window of the Off-Screen Console Output Buffer.
+            .Left = 0,
+            .Top = 0,
+            .Right = OFF_SCREEN_BUFFER_WIDTH - 1,
+            .Bottom = OFF_SCREEN_WINDOW_HEIGHT - 1
+        };
+
+        if ( bufferHandle == NULL || bufferHandle == INVALID_HANDLE_VALUE )
+            return INVALID_HANDLE_VALUE;
+
+        SetConsoleMode(bufferHandle, ENABLE_PROCESSED_OUTPUT | ENABLE_WRAP_AT_EOL_OUTPUT | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+        SetConsoleScreenBufferSize(bufferHandle, { .X = OFF_SCREEN_BUFFER_WIDTH, .Y = OFF_SCREEN_BUFFER_HEIGHT });
+        SetConsoleWindowInfo(bufferHandle, TRUE, &windowRect);
+        SetStdHandle(STD_OUTPUT_HANDLE, bufferHandle);
+
+        return bufferHandle;
+
+    }
+
+    /**
+     * Run a single benchmark, timing each iteration individually.
+     *
+     * The `body` is run once before any iterations are timed to warm up any caches.
+     *
+     * @param name          The name of the benchmark.
+     * @param iterations    The number of timed iterations of the benchmark to run.
+     * @param body          The function being benchmarked.
+     * @param reset         An optional function run after each iteration, which is not timed.
+     *
+     * @returns             A `BenchmarkResult` containing the timings of the benchmark.
+     */
+    static BenchmarkResult runBenchmark (
+        const std::wstring& name,
+        size_t iterations,
+        const std::function<void()>& body,
+        const std::function<void()>& reset = {}
+    ) {
+
+        std::vector<double> durations = {};     // The duration of each iteration, in microseconds.
+
+        iterations = std::max<size_t>(iterations, 1ULL);
+        durations.reserve(iterations);
+
+        body();
+
+        if (reset)
+            reset();
+
+        for ( size_t i = 0ULL; i < iterations; i++ ) {
+            auto startTime = std::chrono::steady_clock::now();
+
+            body();
+            durations.push_back( std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count() );
+
+            if (reset)
+                reset();
+        }
+
+        std::sort( durations.begin(), durations.end() );
+
+        return {
+            .name = name,
+            .iterations = iterations,
+            .minMicroseconds = durations.front(),
+            .medianMicroseconds = durations[durations.size() / 2ULL],
+            .meanMicroseconds = ( std::accumulate(durations.begin(), durations.end(), 0.0) / (double) durations.size() )
+        };
+
+    }
+
+    /**
+     * Write a synthetic Terraria Configuration File of approximately the specified size.
+     *
+     * The `Display` Configuration Properties are placed in the middle of the file,
+     * surrounded by filler Configuration Properties, as they are in real Terraria Configuration Files.
+     *
+     * @param filePath      The path to the synthetic Terraria Configuration File.
+     * @param fileSize      The approximate size of the synthetic Terraria Configuration File, in bytes.
+     *
+     * @returns             `true` on success and `false` on failure.
+     */
+    static bool writeSyntheticConfigFile ( const std::filesystem::path& filePath, size_t fileSize ) {
+
+        std::string contents = "{\r\n";     // The contents of the synthetic Terraria Configuration File.
+        size_t fillerNum = 0ULL;            // The number of the next filler Configuration Property.
+
+        // A lambda function used to add filler Configuration Properties until the `contents` reach the specified size.
+        auto addFiller = [&contents, &fillerNum] ( size_t targetSize ) {
+
+            while ( contents.size() < targetSize )
+                contents += std::format("  \"FillerSetting{0:d}\": \"Some Setting Value #{0:d}\",\r\n", fillerNum++);
+
+        };
+
+        addFiller(fileSize / 2ULL);
+        contents += "  \"Display\": \"\\\\\\\\?\\\\DISPLAY#BNQ7F5C#5&1d5d1c32&0&UID4353#{e6f07b5f-ee97-4a90-b076-33f57bf4eaa7}\",\r\n"
+                    "  \"DisplayScreen\": \"\\\\\\\\.\\\\DISPLAY1\",\r\n"
+                    "  \"DisplayWidth\": 1920,\r\n"
+                    "  \"DisplayHeight\": 1080,\r\n";
+        addFiller(fileSize - 3ULL);
+        contents += "  \"LastSetting\": true\r\n}";
+
+        std::ofstream fileStream(filePath, std::ios::binary);     // The File Stream used to write the synthetic file.
+
+        fileStream.write( contents.data(), (std::streamsize) contents.size() );
+        return fileStream.good();
+
+    }
+
+    /**
+     * Run the Benchmark Harness again in a Child Process whose Current Working Directory is the specified directory.
+     *
+     * The `PROGRAM_DATA_PATH` is determined from the Current Working Directory before `wmain()` is called,
+     * so this is the only way for the benchmarks to use their own Program Data. The directory is created
+     * before the Child Process is started, and is removed along with all of its contents once it exits.
+     *
+     * @param dirPath   The path to the directory the Child Process is run within.
+     *
+     * @returns         The Exit Code of the Child Process, or `ProgramStatusCode::CONSOLE_CREATION_FAILURE`
+     *                  if the Child Process could not be started.
+     */
+    static int runInDirectory ( const std::filesystem::path& dirPath ) {
+
+        std::wstring commandLine = GetCommandLineW();   // The Command Line of the Child Process, which may be modified by `CreateProcessW()`.
+        STARTUPINFOW startupInfo = {                    // Passes the Standard Handles of this process on to the Child Process.
+            .cb = sizeof(STARTUPINFOW),
+            .dwFlags = STARTF_USESTDHANDLES,
+            .hStdInput = GetStdHandle(STD_INPUT_HANDLE),
+            .hStdOutput = GetStdHandle(STD_OUTPUT_HANDLE),
+            .hStdError = GetStdHandle(STD_ERROR_HANDLE)
+        };
+        PROCESS_INFORMATION processInfo = {};           // Receives the handles to the Child Process and its Primary Thread.
+        DWORD exitCode = ProgramStatusCode::CONSOLE_CREATION_FAILURE;
+        std::error_code errorCode = {};                 // Receives any errors raised while creating or removing the directory.
+
+        // Program Data left behind by a previous run that was terminated early is removed as well.
+        std::filesystem::remove_all(dirPath, errorCode);
+        std::filesystem::create_directories(dirPath, errorCode);
+
+        if ( errorCode || !CreateProcessW(NULL, commandLine.data(), NULL, NULL, TRUE, 0UL, NULL, dirPath.c_str(), &startupInfo, &processInfo) ) {
+            std::wcerr << L"Failed to start the benchmarks within " << dirPath.wstring() << std::endl;
+            return ProgramStatusCode::CONSOLE_CREATION_FAILURE;
+        }
+
+        WaitForSingleObject(processInfo.hProcess, INFINITE);
+        GetExitCodeProcess(processInfo.hProcess, &exitCode);
+        CloseHandle(processInfo.hThread);
+        CloseHandle(processInfo.hProcess);
+
+        std::filesystem::remove_all(dirPath, errorCode);
+        return (int) exitCode;
+
+    }
+
+}
+
+/**
+ * The Primary Entry Point for the Benchmark Harness.
+ *
+ * @param argc	The total number of Command-Line Arguments available in `argv`.
+ *
+ * @param argv 	An array of Null-Terminated Wide-Character Strings corresponding
+ * 				to the Command-Line Arguments passed to the Benchmark Harness.
+ *
+ *              The number of timed iterations of each benchmark can be
+ *              changed using `--iterations <Count>` (defaults to `20`).
+ *
+ * @returns     `0` on success, or a positive, nonzero integer if the benchmarks could not be run
+ *              or Apply-Last Mode failed to restore the Monitor Assignment of the synthetic Terraria Configuration File.
+ */
+int wmain ( int argc, const wchar_t* argv[] ) {
+
+    using namespace PROGRAM_NAMESPACE;              // Import all custom code.
+
+    size_t iterations = 20ULL;                      // The number of timed iterations of each benchmark.
+    std::vector<BenchmarkResult> results = {};      // The results of each benchmark.
+    Console::console_ptr_t console = {};            // The `Console`, which writes to the Off-Screen Console Output Buffer.
+    std::filesystem::path benchmarkDirPath = (      // The directory containing the synthetic Terraria Configuration Files.
+        std::filesystem::temp_directory_path() / L"TerrariaMonitorToolBenchmarks"
+    );
+    const DisplayMonitorList syntheticMonitors = {  // The Display Monitors alternately set as the Active Display Monitor.
+        DisplayMonitor(
+            1U, L"\\\\?\\DISPLAY#BNQ7F5C#5&1d5d1c32&0&UID4353#{e6f07b5f-ee97-4a90-b076-33f57bf4eaa7}",
+            L"BenQ GW2480", 1920, 1080, 60, true
+        ),
+        DisplayMonitor(
+            2U, L"\\\\?\\DISPLAY#DEL40F7#5&1d5d1c32&0&UID4357#{e6f07b5f-ee97-4a90-b076-33f57bf4eaa7}",
+            L"DELL U2719D", 2560, 1440, 144
+        )
+    };
+    const DisplayMonitorRegistry syntheticRegistry = { syntheticMonitors };    // The `syntheticMonitors`, indexed by their Display IDs.
+    std::error_code errorCode = {};                 // Receives any errors raised while checking or creating directories.
+    int statusCode = ProgramStatusCode::SUCCESS;    // The Status Code returned once all of the benchmarks have been run.
+
+
+    // The lowercase value of the current Command-Line Argument, whose buffer is reused for each argument.
+    std::wstring lcArg = {};
+
+    // The path to the `benchmarkDirPath`, as well as anything printed by Apply-Last Mode, may contain any characters.
+    UTILS_NAMESPACE::useUtf16StandardStreams();
+
+    // Process Command-Line Arguments
+    for ( int i = 1; i < argc; i++ ) {
+        UTILS_NAMESPACE::stringToLowercase(argv[i], lcArg);
+
+        if ( lcArg == L"--iterations" && i + 1 < argc ) {
+            try {
+                iterations = std::stoull(argv[++i]);
+            }
+            catch (...) {}
+        }
+    }
+
+    // Only the Child Process started by `runInDirectory()` actually runs the benchmarks, so that
+    // the `PROGRAM_DATA_PATH` is located within the `benchmarkDirPath` and is removed along with it.
+    if ( !std::filesystem::equivalent(std::filesystem::current_path(), benchmarkDirPath, errorCode) )
+        return runInDirectory(benchmarkDirPath);
+
+    // Most of the benchmarks never read from or write to any Program Data, other than
+    // the Backup Configuration Files of the synthetic Terraria Configuration Files.
+    programSettings.statelessMode = true;
+
+    if ( createOffScreenBuffer() == INVALID_HANDLE_VALUE || !(console = Console::getConsole()) ) {
+        std::wcerr << L"Failed to create the Off-Screen Console Output Buffer via the Windows API.";
+        return ProgramStatusCode::CONSOLE_CREATION_FAILURE;
+    }
+
+
+    // `OutputBuffer::print()` with strings containing many Virtual Terminal Sequences.
+    {
+        // A line of output containing several Virtual Terminal Sequences, similar to the Main Menu.
+        std::wstring vtLine = std::format(
+            L"{:s}[1]{:s} {:s}DELL U2719D{:s}     {:s}2560 x 1440 @ 144Hz{:s}   {:s}(Main Display){:s}\n",
+            Console::getVirtualTerminalSequence(L"[92m"), Console::getVirtualTerminalSequence(L"[39m"),
+            Console::getVirtualTerminalSequence(L"[1m"), Console::getVirtualTerminalSequence(L"[22m"),
+            Console::getVirtualTerminalSequence(L"[96m"), Console::getVirtualTerminalSequence(L"[39m"),
+            Console::getVirtualTerminalSequence(L"[90m"), Console::getVirtualTerminalSequence(L"[39m")
+        );
+        // A block of output containing 200 of the `vtLine`s.
+        std::wstring vtBlock = {};
+
+        for ( size_t i = 0ULL; i < 200ULL; i++ )
+            vtBlock += vtLine;
+
+        results.push_back(runBenchmark(
+            L"OutputBuffer::print (200 VT-heavy lines, one call each)",
+            iterations,
+            [&console, &vtLine] () { for ( size_t i = 0ULL; i < 200ULL; i++ ) console->print(vtLine); },
+            [&console] () { console->clear(true); }
+        ));
+        results.push_back(runBenchmark(
+            L"OutputBuffer::print (200 VT-heavy lines, single call)",
+            iterations,
+            [&console, &vtBlock] () { console->print(vtBlock); },
+            [&console] () { console->clear(true); }
+        ));
+
+        // Nested prompts over a screen of output, like a Confirmation Prompt over the Configuration File Menu over the Main Menu.
+        console->print(vtBlock);
+
+        results.push_back(runBenchmark(
+            L"Console::createAltBuffer + restorePreviousBuffer (3 nested, 200 VT-heavy lines underneath)",
+            iterations,
+            [&console, &vtLine] () {
+
+                for ( size_t i = 0ULL; i < 3ULL; i++ ) {
+                    console->createAltBuffer();
+                    console->print(vtLine);
+                }
+                for ( size_t i = 0ULL; i < 3ULL; i++ )
+                    console->restorePreviousBuffer();
+
+            }
+        ));
+
+        console->clear(true);
+    }
+
+    // `Console::printMenuOptions()` with increasingly large `MenuOptionList`s.
+    for ( size_t optionCount : MENU_OPTION_COUNTS ) {
+        // The `MenuOptionList` being printed.
+        Console::MenuOptionList menuOptions = {};
+
+        for ( size_t i = 0ULL; i < optionCount; i++ )
+            menuOptions.push_back( Console::MenuOption(std::format(L"Menu Option #{:d}", i + 1ULL), {}, (i % 7ULL == 3ULL)) );
+
+        results.push_back(runBenchmark(
+            std::format(L"Console::printMenuOptions ({:d} options)", optionCount),
+            iterations,
+            [&console, &menuOptions] () { console->printMenuOptions(menuOptions); },
+            [&console] () { console->clear(true); }
+        ));
+    }
+
+    // Building a `MenuOptionList` with an additional Action, like the Main Menu, and dispatching unhandled keys to its Actions.
+    {
+        // A key that none of the Actions handle, so that every key is passed through all of them.
+        Console::WinConsoleInputKey unhandledKey = { .bKeyDown = TRUE, .wRepeatCount = 1U, .wVirtualKeyCode = L'Z' };
+        // The Current Selection Number passed to each of the Actions.
+        std::optional<size_t> currentSelectionNum = 0ULL;
+
+        results.push_back(runBenchmark(
+            L"MenuOptionList construction and Action dispatch (1000 keys)",
+            iterations,
+            [&console, &unhandledKey, &currentSelectionNum] () {
+
+                // The `MenuOptionList` receiving the keys.
+                Console::MenuOptionList menuOptions = {
+                    { { L"Yes", L'y' }, { L"No", L'n' } },
+                    {
+                        {
+                            [] ( const Console::WinConsoleInputKey& key, Console::MenuOptionList&, Console&, std::optional<size_t>& )
+                            -> Console::MenuOptionList::MenuOptionListAction::InputProcessingResult {
+
+                                return std::make_pair(key.wVirtualKeyCode == L'R', false);
+
+                            },
+                            L"Press R to do nothing."
+                        }
+                    }
+                };
+
+                // Each key is dispatched the same way as by `Console::waitForSelection()`.
+                for ( size_t i = 0ULL; i < 1000ULL; i++ ) {
+                    if ( !Console::MenuOptionList::DefaultActionPipeline::process(unhandledKey, menuOptions, *console, currentSelectionNum).first ) {
+                        for ( const Console::MenuOptionList::MenuOptionListAction& action : menuOptions.getActions() )
+                            action.actionFn(unhandledKey, menuOptions, *console, currentSelectionNum);
+                    }
+                }
+
+            }
+        ));
+    }
+
+    // Reading and writing the Active Display Monitor in increasingly large Terraria Configuration Files.
+    for ( size_t fileSize : CONFIG_FILE_SIZES ) {
+        // The path to the synthetic Terraria Configuration File.
+        std::filesystem::path filePath = benchmarkDirPath / std::format(L"config_{:d}KB.json", fileSize >> 10);
+        // The `ConfigurationFile` used for the synthetic Terraria Configuration File.
+        std::optional<ConfigurationFile> configFile = {};
+        // The Modified Configuration Properties, which are discarded.
+        ChangedValuesMap changedValues = {};
+        // The contents of the synthetic Terraria Configuration File before it is modified.
+        std::string unmodifiedContents = {};
+        // The number of lines written by `writeConfigFileDiff()`, which are discarded.
+        size_t diffLineCount = 0ULL;
+        // The index of the Display Monitor in the `syntheticMonitors` being set as the Active Display Monitor.
+        size_t monitorIndex = 0ULL;
+
+        if ( !writeSyntheticConfigFile(filePath, fileSize) )
+            continue;
+
+        results.push_back(runBenchmark(
+            std::format(L"getActiveMonitorFromConfigFile ({:d} KB)", fileSize >> 10),
+            iterations,
+            [&configFile, &filePath, &syntheticRegistry] () {
+
+                configFile.emplace( filePath.wstring() );
+                getActiveMonitorFromConfigFile(*configFile, syntheticRegistry);
+
+            },
+            [&configFile] () { configFile.reset(); }
+        ));
+        // Answered from the `ConfigurationMetadataCache` after checking the File Identity, as the file is unchanged.
+        results.push_back(runBenchmark(
+            std::format(L"getActiveMonitorFromConfigFile by path ({:d} KB)", fileSize >> 10),
+            iterations,
+            [&filePath, &syntheticRegistry] () {
+
+                getActiveMonitorFromConfigFile(filePath.wstring(), syntheticRegistry);
+
+            }
+        ));
+
+        configFile.emplace( filePath.wstring() );
+        unmodifiedContents = configFile->getContents();
+
+        results.push_back(runBenchmark(
+            std::format(L"setActiveMonitorInConfigFile ({:d} KB)", fileSize >> 10),
+            iterations,
+            [&configFile, &syntheticMonitors, &monitorIndex, &changedValues] () {
+
+                setActiveMonitorInConfigFile(*configFile, syntheticMonitors[monitorIndex], changedValues);
+                monitorIndex = (monitorIndex + 1ULL) % syntheticMonitors.size();
+
+            }
+        ));
+        results.push_back(runBenchmark(
+            std::format(L"writeConfigFileDiff ({:d} KB)", fileSize >> 10),
+            iterations,
+            [&configFile, &unmodifiedContents, &diffLineCount] () {
+
+                writeConfigFileDiff(
+                    unmodifiedContents,
+                    configFile->getContents(),
+                    3ULL,
+                    L"config.json",
+                    L"config.json (Dry Run)",
+                    [&diffLineCount] ( const std::wstring& ) { diffLineCount++; }
+                );
+
+            }
+        ));
+
+        configFile.reset();
+        std::filesystem::remove(filePath);
+    }
+
+    // Launching the program in Apply-Last Mode (`--apply-last`), compared to the work done by an Interactive Launch
+    // before the Main Menu can be drawn, not including the time spent waiting on the user to choose a Terraria Configuration File.
+    {
+        // The directory containing the synthetic Terraria Configuration File, which is saved to the Configuration Path History.
+        std::filesystem::path launchDirPath = benchmarkDirPath / L"Launch";
+        // The path to the synthetic Terraria Configuration File.
+        std::filesystem::path filePath = launchDirPath / CONFIG_FILE_NAME;
+        // The `ConfigurationFile` used for the synthetic Terraria Configuration File.
+        std::optional<ConfigurationFile> configFile = {};
+        // The Modified Configuration Properties, which are discarded.
+        ChangedValuesMap changedValues = {};
+        // The Connected Display Monitors, the first of which is set as the Active Display Monitor.
+        std::optional<DisplayMonitorList> displayMonitors = getDisplayMonitors(false);
+
+        std::filesystem::create_directories(launchDirPath, errorCode);
+
+        if ( displayMonitors && !displayMonitors->empty() && writeSyntheticConfigFile(filePath, CONFIG_FILE_SIZES[0]) ) {
+            // The Stable Identity of the Connected Display Monitor being set as the Active Display Monitor.
+            std::wstring stableId = displayMonitors->front().getStableId();
+
+            // Both launches load the Connected Display Monitors from the `DisplayTopologyCache`, so it is used here as well.
+            // All of the Program Data written from here on is located within the `benchmarkDirPath`.
+            programSettings.statelessMode = false;
+
+            // The Configuration Path History, which only contains the `launchDirPath`, just like after choosing it interactively.
+            UserInterface::ConfigurationPathHistory pathHistory = {};
+
+            pathHistory.promote(launchDirPath);
+            pathHistory.saveToFile();
+            MonitorAssignmentStore::assignMonitor(filePath.wstring(), stableId);
+
+            // Apply-Last Mode itself has to find the Monitor Assignment from the directory saved in the Configuration Path History.
+            if ( runApplyLastMode() != ProgramStatusCode::SUCCESS ) {
+                std::wcerr << L"Apply-Last Mode failed to restore the Monitor Assignment of the most recently used Terraria Configuration File." << std::endl;
+                statusCode = ProgramStatusCode::APPLY_LAST_FAILURE;
+            }
+
+            // The Terraria Configuration File has already been modified by Apply-Last Mode, so it is left unchanged,
+            // just like launching the program again before the Display Topology changes.
+            results.push_back(runBenchmark(
+                APPLY_LAST_BENCHMARK_NAME,
+                iterations,
+                [&configFile, &changedValues] () {
+
+                    // The Configuration Path History, whose first directory contains the most recently used Terraria Configuration File.
+                    UserInterface::ConfigurationPathHistory launchPathHistory = UserInterface::ConfigurationPathHistory::fetchFromFile();
+                    // The path to the most recently used Terraria Configuration File, found the same way as by `runApplyLastMode()`.
+                    std::wstring lastFilePath = (
+                        launchPathHistory.empty() ? std::wstring() : ( *launchPathHistory.begin() / CONFIG_FILE_NAME ).wstring()
+                    );
+                    // The Stable Identity of the Display Monitor assigned to the most recently used Terraria Configuration File.
+                    std::optional<std::wstring> assignedId = MonitorAssignmentStore::getAssignedMonitor(lastFilePath);
+
+                    configFile.emplace(lastFilePath);
+
+                    if (assignedId)
+                        applyMonitorAssignment(*configFile, *assignedId, changedValues);
+
+                },
+                [&configFile] () { configFile.reset(); }
+            ));
+            results.push_back(runBenchmark(
+                L"Interactive Launch (excluding the path prompt)",
+                iterations,
+                [&console, &configFile, &filePath] () {
+
+                    UserInterface ui = { console };
+                    DisplayChangeListener displayChangeListener = {};
+
+                    console->createAltBuffer();
+                    UserInterface::ConfigurationPathHistory::fetchFromFile();
+
+                    // The Connected Display Monitors, each of which is identified by its Handle within the Main Menu.
+                    DisplayMonitorRegistry monitorRegistry = { getDisplayMonitors().value_or(DisplayMonitorList()) };
+
+                    configFile.emplace( filePath.wstring() );
+                    getActiveMonitorFromConfigFile(*configFile, monitorRegistry);
+                    console->restorePreviousBuffer();
+
+                },
+                [&configFile] () { configFile.reset(); }
+            ));
+
+            // Applying a Monitor Preset with a different Display Resolution, compared to finding the Display Monitor and parsing
+            // the Terraria Configuration File for every switch. Both run as a Dry Run, so the precompiled Patch Plan stays current.
+            {
+                // The name of the Monitor Preset being applied.
+                const std::wstring presetName = L"Terraria Monitor Tool Benchmark";
+                // The Display Resolution of the Monitor Preset, which differs from the one in the Terraria Configuration File.
+                const DisplayMonitor::DisplayResolution presetResolution = { 800UL, 600UL, 60UL };
+
+                programSettings.dryRun = true;
+
+                if ( MonitorPresetStore::savePreset(presetName, displayMonitors->front(), presetResolution, { filePath.wstring() }) ) {
+                    results.push_back(runBenchmark(
+                        L"Apply Monitor Preset (--preset, Dry Run)",
+                        iterations,
+                        [&presetName] () { MonitorPresetStore::applyPreset(presetName); }
+                    ));
+                    results.push_back(runBenchmark(
+                        L"Apply Monitor Preset without Patch Plans (Dry Run)",
+                        iterations,
+                        [&configFile, &filePath, &stableId, &presetResolution, &changedValues] () {
+
+                            std::optional<DisplayMonitorList> connectedMonitors = getDisplayMonitors(true);
+
+                            configFile.emplace( filePath.wstring() );
+
+                            for ( const DisplayMonitor& monitor : connectedMonitors.value_or(DisplayMonitorList()) ) {
+                                if ( monitor.getStableId() == stableId )
+                                    setActiveMonitorInConfigFile(*configFile, monitor, changedValues, presetResolution);
+                            }
+
+                        },
+                        [&configFile] () { configFile.reset(); }
+                    ));
+
+                    MonitorPresetStore::deletePreset(presetName);
+                }
+
+                programSettings.dryRun = false;
+            }
+
+            programSettings.statelessMode = true;
+        }
+
+        configFile.reset();
+        std::filesystem::remove(filePath);
+    }
+
+    // The String Utility Functions used while parsing arguments and rendering paths, writing into a reused buffer.
+    {
+        // A long Configuration File Path, similar to those displayed in the Configuration Path History.
+        const std::wstring longPath = L"C:\\Users\\Player\\OneDrive - Contoso\\Documents\\My Games\\Terraria\\Profiles\\Main\\config.json";
+        // The buffer receiving the result of each call.
+        std::wstring outputStr = {};
+
+        results.push_back(runBenchmark(
+            L"stringToLowercase (1000 paths, reused buffer)",
+            iterations,
+            [&longPath, &outputStr] () { for ( size_t i = 0ULL; i < 1000ULL; i++ ) UTILS_NAMESPACE::stringToLowercase(longPath, outputStr); }
+        ));
+        results.push_back(runBenchmark(
+            L"truncatePathString (1000 paths, reused buffer)",
+            iterations,
+            [&longPath, &outputStr] () { for ( size_t i = 0ULL; i < 1000ULL; i++ ) UTILS_NAMESPACE::truncatePathString(longPath, 48ULL, outputStr); }
+        ));
+    }
+
+    // Retrieving the Connected Display Monitors from the Windows API.
+    results.push_back(runBenchmark(
+        L"getDisplayMonitors (uncached)",
+        iterations,
+        [] () { getDisplayMonitors(false); }
+    ));
+
+
+    // Print the results to the Standard Output Buffer, which is not affected by the Off-Screen Console Output Buffer.
+    std::wcout << std::format(L"{:<60s} {:>10s} {:>14s} {:>14s} {:>14s}\n", L"Benchmark", L"Iterations", L"Min (us)", L"Median (us)", L"Mean (us)");
+
+    for ( const BenchmarkResult& result : results ) {
+        std::wcout << std::format(
+            L"{:<60s} {:>10d} {:>14.1f} {:>14.1f} {:>14.1f}\n",
+            result.name,
+            result.iterations,
+            result.minMicroseconds,
+            result.medianMicroseconds,
+            result.meanMicroseconds
+        );
+    }
+
+    // Only the work done within the program is measured, so the time spent creating the process is not included.
+    for ( const BenchmarkResult& result : results ) {
+        if (result.name == APPLY_LAST_BENCHMARK_NAME) {
+            // The median duration of the Apply-Last Launch, in milliseconds.
+            double medianMilliseconds = (result.medianMicroseconds / 1000.0);
+
+            std::wcout << std::format(
+                L"\n{:s}: {:s} (median of {:.2f} ms against a target of {:.0f} ms)\n",
+                result.name,
+                ( medianMilliseconds <= APPLY_LAST_TARGET_MILLISECONDS ? L"PASS" : L"FAIL" ),
+                medianMilliseconds,
+                APPLY_LAST_TARGET_MILLISECONDS
+            );
+        }
+    }
+
+    return statusCode;
+
+}
@@ -0,0 +1,360 @@
+/*
+* ConfigurationBackups.cpp
+*
+* Source File defining the `ConfigurationBackupStore` class, which keeps a deduplicated
+* history of every version of a Terraria Configuration File that the program has replaced.
+*/
+
+
+#include "ConfigurationBackups.h"
+#include "Tracing.h"
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Variables */
+
+    // Serializes all modifications of the Backup Configuration Files made by this process,
+    // such as when multiple Terraria Configuration Files are modified concurrently in Non-Interactive Mode.
+    // Other processes are only guarded against by the `SNAPSHOT_GRACE_PERIOD`.
+    static std::mutex backupStoreMutex = {};
+
+
+    /* Internal Helper Functions */
+
+    /**
+     * Compute the hash of the specified contents, which is used to name Base Snapshots and Backup Journals.
+     *
+     * @param contents  The contents being hashed.
+     *
+     * @returns         A Wide-Character String containing the 64-bit FNV-1a Hash of the `contents`.
+     */
+    static std::wstring getContentHash ( std::string_view contents ) {
+
+        uint64_t hash = 14695981039346656037ULL;    // The running 64-bit FNV-1a Hash of the `contents`.
+
+        for ( char ch : contents ) {
+            hash ^= (unsigned char) ch;
+            hash *= 1099511628211ULL;
+        }
+
+        return std::format(L"{:016x}", hash);
+
+    }
+
+
+    /* ConfigurationBackupStore */
+    // Class Constants
+
+    const std::filesystem::path ConfigurationBackupStore::BACKUP_DIRECTORY_PATH = { PROGRAM_DATA_PATH / L"backups" };
+    const std::filesystem::path ConfigurationBackupStore::SNAPSHOT_DIRECTORY_PATH = { BACKUP_DIRECTORY_PATH / L"snapshots" };
+    const std::chrono::minutes ConfigurationBackupStore::SNAPSHOT_GRACE_PERIOD = std::chrono::minutes(10);
+
+    // Static Methods
+
+    bool ConfigurationBackupStore::recordGeneration ( const std::wstring& filePath, std::string_view contents ) {
+
+        ScopedTraceTimer traceTimer = { "Record Backup Generation", "config", filePath };
+        std::lock_guard<std::mutex> lock(backupStoreMutex);                 // Held while the Backup Configuration Files are modified.
+        BackupGenerationList generations = getGenerations(filePath);        // The existing Backup Generations.
+        std::optional<std::string> baseContents = {};                       // The contents of the current Base Snapshot.
+        std::set<std::wstring> prunedHashes = {};                           // The hashes of the Base Snapshots no longer referenced by the pruned Backup Generations.
+        std::error_code errorCode = {};                                     // Receives any errors raised while renewing the Base Snapshot.
+        BackupGeneration newGeneration = {                                  // The Backup Generation being recorded.
+            .generation = ( generations.empty() ? 1ULL : (generations.back().generation + 1ULL) ),
+            .timestamp = std::chrono::system_clock::to_time_t( std::chrono::system_clock::now() ),
+            .deltaOffset = 0ULL,
+            .deltaRemovedLength = 0ULL
+        };
+
+        try {
+            std::filesystem::create_directories(SNAPSHOT_DIRECTORY_PATH);
+
+            if ( !generations.empty() )
+                baseContents = readSnapshot(generations.back().baseHash);
+
+            // Describe the `contents` as the single range of bytes that differs from the current Base Snapshot.
+            if (baseContents) {
+                // The length of the prefix shared by the Base Snapshot and the `contents`.
+                size_t prefixLength = 0ULL;
+                // The length of the suffix shared by the Base Snapshot and the `contents`, not overlapping the prefix.
+                size_t suffixLength = 0ULL;
+                // The maximum length of any shared suffix.
+                size_t maxSuffixLength = std::min(baseContents->size(), contents.size());
+
+                while ( prefixLength < maxSuffixLength && (*baseContents)[prefixLength] == contents[prefixLength] )
+                    prefixLength++;
+
+                maxSuffixLength -= prefixLength;
+
+                while (
+                    suffixLength < maxSuffixLength
+                    && (*baseContents)[baseContents->size() - suffixLength - 1ULL] == contents[contents.size() - suffixLength - 1ULL]
+                ) {
+                    suffixLength++;
+                }
+
+                newGeneration.baseHash = generations.back().baseHash;
+                newGeneration.deltaOffset = prefixLength;
+                newGeneration.deltaRemovedLength = ( baseContents->size() - prefixLength - suffixLength );
+                newGeneration.deltaContents = contents.substr(prefixLength, contents.size() - prefixLength - suffixLength);
+
+                // The `contents` are identical to the most recent Backup Generation.
+                if (
+                       newGeneration.deltaOffset == generations.back().deltaOffset
+                    && newGeneration.deltaRemovedLength == generations.back().deltaRemovedLength
+                    && newGeneration.deltaContents == generations.back().deltaContents
+                ) {
+                    return true;
+                }
+
+                // Take a new Base Snapshot once the delta is no longer small.
+                if ( newGeneration.deltaContents.size() > std::max<size_t>(MIN_REBASE_DELTA_SIZE, contents.size() / 4ULL) )
+                    baseContents.reset();
+            }
+
+            // Take a new Base Snapshot, which can be shared with any other Backup Generation with the same contents.
+            if (!baseContents) {
+                // The path to the new Base Snapshot.
+                std::filesystem::path snapshotPath = {};
+
+                newGeneration.baseHash = getContentHash(contents);
+                newGeneration.deltaOffset = 0ULL;
+                newGeneration.deltaRemovedLength = 0ULL;
+                newGeneration.deltaContents.clear();
+                snapshotPath = SNAPSHOT_DIRECTORY_PATH / newGeneration.baseHash;
+
+                if ( !std::filesystem::exists(snapshotPath) && !UTILS_NAMESPACE::writeFileAtomically(snapshotPath, contents) )
+                    return false;
+            }
+
+            // Renew the Base Snapshot, so that it can't be removed by another process before the Backup Journal references it.
+            std::filesystem::last_write_time( SNAPSHOT_DIRECTORY_PATH / newGeneration.baseHash, std::filesystem::file_time_type::clock::now(), errorCode );
+
+            generations.push_back( std::move(newGeneration) );
+
+            if ( generations.size() > MAX_GENERATIONS ) {
+                for ( auto generationItr = generations.begin(); generationItr != generations.end() - MAX_GENERATIONS; generationItr++ )
+                    prunedHashes.insert(generationItr->baseHash);
+
+                generations.erase( generations.begin(), generations.end() - MAX_GENERATIONS );
+
+                for ( const BackupGeneration& generation : generations )
+                    prunedHashes.erase(generation.baseHash);
+            }
+
+            if ( !saveJournal(filePath, generations) )
+                return false;
+
+            // Only look for unreferenced Base Snapshots once this Backup Journal has stopped referencing one,
+            // rather than reading every Backup Journal each time a Backup Generation is recorded.
+            if ( !prunedHashes.empty() )
+                removeUnreferencedSnapshots();
+
+            return true;
+        }
+        catch (...) {}
+
+        return false;
+
+    }
+
+    ConfigurationBackupStore::BackupGenerationList ConfigurationBackupStore::getGenerations ( const std::wstring& filePath ) {
+
+        BackupGenerationList generations = {};                      // The Backup Generations read from the Backup Journal.
+        std::wistringstream journalStream(                          // The Stream used to read the Backup Journal.
+            UTILS_NAMESPACE::readTextFile( getJournalPath(filePath) ).value_or(L"")
+        );
+        std::wstring currentLine = {};                              // Contains the Current Line of the Backup Journal.
+
+        // The first line of the Backup Journal only contains the path to the Terraria Configuration File.
+        std::getline(journalStream, currentLine);
+
+        // Each subsequent line contains the Tab-Separated fields of a single Backup Generation.
+        while ( std::getline(journalStream, currentLine) ) {
+            std::wistringstream lineStream(currentLine);    // The Stream used to read the fields of the Current Line.
+            std::vector<std::wstring> fields = {};          // The fields of the Current Line.
+            std::wstring currentField = {};                 // The Current Field being read from the `lineStream`.
+            BackupGeneration generation = {};               // The Backup Generation described by the Current Line.
+
+            while ( std::getline(lineStream, currentField, L'\t') )
+                fields.push_back(currentField);
+
+            // Any trailing Delta Contents may be empty.
+            if (fields.size() == 5ULL)
+                fields.emplace_back();
+            if (fields.size() != 6ULL || fields[5].size() % 2ULL != 0ULL)
+                continue;
+
+            try {
+                generation.generation = std::stoull(fields[0]);
+                generation.timestamp = (std::time_t) std::stoll(fields[1]);
+                generation.baseHash = fields[2];
+                generation.deltaOffset = std::stoull(fields[3]);
+                generation.deltaRemovedLength = std::stoull(fields[4]);
+
+                // The Delta Contents are stored as Hexadecimal, as they may contain any bytes.
+                for ( size_t i = 0ULL; i < fields[5].size(); i += 2ULL )
+                    generation.deltaContents.push_back( (char) std::stoul(fields[5].substr(i, 2ULL), nullptr, 16) );
+            }
+            catch (...) {
+                continue;
+            }
+
+            generations.push_back( std::move(generation) );
+        }
+
+        return generations;
+
+    }
+
+    std::optional<std::string> ConfigurationBackupStore::getGenerationContents ( const std::wstring& filePath, size_t generation ) {
+
+        BackupGenerationList generations = getGenerations(filePath);   // The existing Backup Generations.
+
+        for ( const BackupGeneration& currentGeneration : generations ) {
+            if (currentGeneration.generation == generation) {
+                // The contents of the Base Snapshot of the Backup Generation.
+                std::optional<std::string> contents = readSnapshot(currentGeneration.baseHash);
+
+                if ( !contents || currentGeneration.deltaOffset + currentGeneration.deltaRemovedLength > contents->size() )
+                    return {};
+
+                contents->replace(currentGeneration.deltaOffset, currentGeneration.deltaRemovedLength, currentGeneration.deltaContents);
+                return contents;
+            }
+        }
+
+        return {};
+
+    }
+
+    bool ConfigurationBackupStore::restoreGeneration ( const std::wstring& filePath, size_t generation ) {
+
+        // The contents of the Backup Generation being restored.
+        std::optional<std::string> generationContents = getGenerationContents(filePath, generation);
+
+        if (!generationContents)
+            return false;
+
+        // Record the current contents so that the restore can be undone, with the file unmapped before it is replaced.
+        {
+            UTILS_NAMESPACE::MemoryMappedFile currentFile = { filePath };
+
+            if ( currentFile.isOpen() && !recordGeneration(filePath, currentFile.getContents()) )
+                return false;
+        }
+
+        return UTILS_NAMESPACE::writeFileAtomically(filePath, *generationContents);
+
+    }
+
+    bool ConfigurationBackupStore::deleteSavedData () {
+
+        std::lock_guard<std::mutex> lock(backupStoreMutex);     // Held while the Backup Configuration Files are modified.
+        std::error_code errorCode = {};                         // Receives any errors raised while deleting the Backup Configuration Files.
+
+        std::filesystem::remove_all(BACKUP_DIRECTORY_PATH, errorCode);
+        return !errorCode;
+
+    }
+
+    // Helper Methods
+
+    std::filesystem::path ConfigurationBackupStore::getJournalPath ( const std::wstring& filePath ) {
+
+        // The absolute path to the Terraria Configuration File, which is case-insensitive.
+        std::wstring absoluteFilePath = UTILS_NAMESPACE::stringToLowercase( std::filesystem::absolute(filePath).wstring() );
+
+        return BACKUP_DIRECTORY_PATH / ( getContentHash(UTILS_NAMESPACE::wideStringToUtf8(absoluteFilePath)) + L".journal" );
+
+    }
+
+    bool ConfigurationBackupStore::saveJournal ( const std::wstring& filePath, const BackupGenerationList& generations ) {
+
+        // The contents of the Backup Journal.
+        std::wstring contents = std::filesystem::absolute(filePath).wstring();
+
+        for ( const BackupGeneration& generation : generations ) {
+            contents += std::format(
+                L"\n{:d}\t{:d}\t{:s}\t{:d}\t{:d}\t",
+                generation.generation,
+                (long long) generation.timestamp,
+                generation.baseHash,
+                generation.deltaOffset,
+                generation.deltaRemovedLength
+            );
+
+            for ( char ch : generation.deltaContents )
+                contents += std::format(L"{:02x}", (unsigned char) ch);
+        }
+
+        return UTILS_NAMESPACE::writeFileAtomically( getJournalPath(filePath), UTILS_NAMESPACE::wideStringToUtf8(contents) );
+
+    }
+
+    std::optional<std::string> ConfigurationBackupStore::readSnapshot ( const std::wstring& baseHash ) {
+
+        // The Base Snapshot, mapped into memory.
+        UTILS_NAMESPACE::MemoryMappedFile snapshotFile = { (SNAPSHOT_DIRECTORY_PATH / baseHash).wstring() };
+
+        if ( !snapshotFile.isOpen() || getContentHash(snapshotFile.getContents()) != baseHash )
+            return {};
+
+        return std::string( snapshotFile.getContents() );
+
+    }
+
+    void ConfigurationBackupStore::removeUnreferencedSnapshots () {
+
+        std::set<std::wstring> referencedHashes = {};   // The hashes of every Base Snapshot referenced by a Backup Journal.
+        std::error_code errorCode = {};                 // Receives any errors raised while iterating over the directories.
+        // The time before which unreferenced Base Snapshots can be removed.
+        std::filesystem::file_time_type removalCutoff = std::filesystem::file_time_type::clock::now() - SNAPSHOT_GRACE_PERIOD;
+
+        for ( const auto& entry : std::filesystem::directory_iterator(BACKUP_DIRECTORY_PATH, errorCode) ) {
+            if ( entry.path().extension() != L".journal" )
+                continue;
+
+            std::wistringstream journalStream(          // The Stream used to read the Backup Journal.
+                UTILS_NAMESPACE::readTextFile( entry.path() ).value_or(L"")
+            );
+            std::wstring currentLine = {};              // Contains the Current Line of the Backup Journal.
+
+            // The first line of the Backup Journal only contains the path to the Terraria Configuration File.
+            std::getline(journalStream, currentLine);
+
+            // The hash of the Base Snapshot is the third field of each line.
+            while ( std::getline(journalStream, currentLine) ) {
+                size_t hashStartPos = currentLine.find(L'\t', currentLine.find(L'\t') + 1ULL);
+
+                if (hashStartPos != std::wstring::npos)
+                    referencedHashes.insert( currentLine.substr(hashStartPos + 1ULL, currentLine.find(L'\t', hashStartPos + 1ULL) - hashStartPos - 1ULL) );
+            }
+        }
+
+        // Don't delete anything if a Backup Journal might not have been read.
+        if (errorCode)
+            return;
+
+        for ( const auto& entry : std::filesystem::directory_iterator(SNAPSHOT_DIRECTORY_PATH, errorCode) ) {
+            std::error_code entryErrorCode = {};    // Receives any errors raised while checking or removing the Base Snapshot.
+
+            if ( referencedHashes.contains( entry.path().filename().wstring() ) )
+                continue;
+
+            // Another process may have just taken or reused the Base Snapshot without having saved its Backup Journal yet.
+            if ( entry.last_write_time(entryErrorCode) >= removalCutoff || entryErrorCode )
+                continue;
+
+            std::filesystem::remove(entry.path(), entryErrorCode);
+        }
+
+    }
+
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+
+/*
+* ConfigurationBackups.h
+*
+* Header File defining the `ConfigurationBackupStore` class, which keeps a deduplicated
+* history of every version of a Terraria Configuration File that the program has replaced.
+*/
+
+
+#include "framework.h"
+
+#include <chrono>
+#include <ctime>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/**
+	 * A class providing an incremental, content-addressed store of Backup Configuration Files.
+	 *
+	 * Rather than copying the entire Terraria Configuration File every time it is modified, the
+	 * `ConfigurationBackupStore` keeps a single *Base Snapshot* of the file, stored in a file named
+	 * after the hash of its contents so that identical Base Snapshots are shared, and records each
+	 * Backup Generation as a small delta against it. As only the `Display` Configuration Properties
+	 * are ever changed by the program, each delta typically only covers a few hundred bytes.
+	 *
+	 * A new Base Snapshot is only taken once a delta would grow too large (e.g., after Terraria
+	 * itself has rewritten the file), and Base Snapshots no longer referenced by any
+	 * Backup Generation are removed once their Backup Generations are pruned.
+	 *
+	 * Backup Configuration Files are stored within the `backups` directory of the `PROGRAM_DATA_PATH`,
+	 * and are removed along with the rest of the Program Data by `--clear-program-data`. As described
+	 * for `ProgramSettings::statelessMode`, Backup Configuration Files are still created in Stateless Mode.
+	 */
+	class ConfigurationBackupStore {
+
+		/* Type Definitions */
+		public:
+			/**
+			 * A structure type describing a single Backup Generation of a Terraria Configuration File.
+			 *
+			 * The contents of the Backup Generation are the contents of the Base Snapshot with
+			 * `deltaRemovedLength` bytes starting at `deltaOffset` replaced by the `deltaContents`.
+			 */
+			typedef struct BackupGenerationStruct {
+
+				size_t generation;			// The number of the Backup Generation, starting from `1`.
+				std::time_t timestamp;		// The time at which the Backup Generation was recorded.
+				std::wstring baseHash;		// The hash of the contents of the Base Snapshot.
+				size_t deltaOffset;			// The position in the Base Snapshot at which the delta begins.
+				size_t deltaRemovedLength;	// The number of bytes of the Base Snapshot replaced by the delta.
+				std::string deltaContents;	// The bytes replacing the removed bytes of the Base Snapshot.
+
+			} BackupGeneration;
+
+			// A collection of `BackupGeneration` structures, ordered from oldest to newest.
+			typedef std::vector<BackupGeneration> BackupGenerationList;
+
+
+		/* Class Constants */
+		public:
+			// The maximum number of Backup Generations kept for each Terraria Configuration File.
+			static const size_t MAX_GENERATIONS = 50ULL;
+			/**
+			 * The minimum size of a delta, in bytes, before a new Base Snapshot is taken instead.
+			 *
+			 * A new Base Snapshot is also taken whenever the delta exceeds a quarter of the size of the file.
+			 */
+			static const size_t MIN_REBASE_DELTA_SIZE = 4096ULL;
+
+		protected:
+			static const std::filesystem::path BACKUP_DIRECTORY_PATH;		// The path to the directory containing the Backup Journals.
+			static const std::filesystem::path SNAPSHOT_DIRECTORY_PATH;		// The path to the directory containing the Base Snapshots.
+			/**
+			 * The minimum age of a Base Snapshot before it can be removed for not being referenced by any Backup Journal.
+			 *
+			 * Other processes may be recording a Backup Generation at the same time, so a Base Snapshot that was only
+			 * just taken or reused may not be referenced by their Backup Journal yet.
+			 */
+			static const std::chrono::minutes SNAPSHOT_GRACE_PERIOD;
+
+
+		/* Static Methods */
+		public:
+			/**
+			 * Record a new Backup Generation of a Terraria Configuration File.
+			 *
+			 * Nothing is recorded if the `contents` are identical to the most recent Backup Generation.
+			 * Once more than `MAX_GENERATIONS` Backup Generations exist, the oldest ones are pruned.
+			 *
+			 * @param filePath	The path to the Terraria Configuration File.
+			 * @param contents	The contents of the Terraria Configuration File being backed up,
+			 * 					typically immediately before they are replaced.
+			 *
+			 * @returns			`true` on success and `false` on failure.
+			 */
+			static bool recordGeneration ( const std::wstring& filePath, std::string_view contents );
+
+			/**
+			 * Get the Backup Generations recorded for a Terraria Configuration File.
+			 *
+			 * @param filePath	The path to the Terraria Configuration File.
+			 *
+			 * @returns			A `BackupGenerationList` containing the Backup Generations,
+			 * 					which is empty if none have been recorded.
+			 */
+			static BackupGenerationList getGenerations ( const std::wstring& filePath );
+			/**
+			 * Reconstruct the contents of a Backup Generation of a Terraria Configuration File.
+			 *
+			 * @param filePath		The path to the Terraria Configuration File.
+			 * @param generation	The number of the Backup Generation.
+			 *
+			 * @returns				The contents of the Backup Generation, wrapped in an `std::optional` object.
+			 *
+			 * 						If the Backup Generation does not exist or its Base Snapshot is missing
+			 * 						or corrupted, an empty `std::optional` will be returned.
+			 */
+			static std::optional<std::string> getGenerationContents ( const std::wstring& filePath, size_t generation );
+			/**
+			 * Restore a Terraria Configuration File to the contents of one of its Backup Generations.
+			 *
+			 * The current contents of the Terraria Configuration File are recorded as a new
+			 * Backup Generation first, so that restoring a Backup Generation can itself be undone.
+			 *
+			 * @param filePath		The path to the Terraria Configuration File.
+			 * @param generation	The number of the Backup Generation being restored.
+			 *
+			 * @returns				`true` on success and `false` on failure.
+			 */
+			static bool restoreGeneration ( const std::wstring& filePath, size_t generation );
+
+			/**
+			 * Delete all of the Backup Configuration Files.
+			 *
+			 * @returns		`true` if the Backup Configuration Files were successfully
+			 * 				deleted or do not currently exist, otherwise `false`.
+			 */
+			static bool deleteSavedData ();
+
+
+		/* Helper Methods */
+		protected:
+			/**
+			 * Get the path to the Backup Journal of a Terraria Configuration File.
+			 *
+			 * @param filePath	The path to the Terraria Configuration File.
+			 *
+			 * @returns			The path to the Backup Journal, named after the hash of the absolute `filePath`.
+			 */
+			static std::filesystem::path getJournalPath ( const std::wstring& filePath );
+			/**
+			 * Write the Backup Journal of a Terraria Configuration File.
+			 *
+			 * @param filePath		The path to the Terraria Configuration File.
+			 * @param generations	The Backup Generations being written to the Backup Journal.
+			 *
+			 * @returns				`true` on success and `false` on failure.
+			 */
+			static bool saveJournal ( const std::wstring& filePath, const BackupGenerationList& generations );
+			/**
+			 * Read the contents of a Base Snapshot, verifying them against their hash.
+			 *
+			 * @param baseHash	The hash of the contents of the Base Snapshot.
+			 *
+			 * @returns			The contents of the Base Snapshot, wrapped in an `std::optional` object.
+			 * 					If the Base Snapshot is missing or corrupted, an empty `std::optional` will be returned.
+			 */
+			static std::optional<std::string> readSnapshot ( const std::wstring& baseHash );
+			/**
+			 * Delete every Base Snapshot that is no longer referenced by any Backup Journal,
+			 * other than those modified within the `SNAPSHOT_GRACE_PERIOD`.
+			 */
+			static void removeUnreferencedSnapshots ();
+
+	};
+
+}
@@ -0,0 +1,374 @@
+/*
+* ConfigurationDiscovery.cpp
+*
+* Source File defining the `ConfigurationDiscovery` class, which searches every User Profile
+* on the computer for Terraria Configuration Files, and keeps an index of the directories
+* it has found so that later searches only need to revalidate them.
+*/
+
+
+#include "ConfigurationDiscovery.h"
+#include "Tracing.h"
+
+#include <algorithm>
+#include <cwchar>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <unordered_set>
+#include <ShlObj.h>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Variables */
+
+    // The path to the directory containing the Terraria Configuration File, relative to a Documents Folder.
+    static const std::wstring TERRARIA_DOCUMENTS_PATH = L"\\My Games\\Terraria";
+
+
+    /* Internal Helper Functions */
+
+    /**
+     * Convert a `FILETIME` into a single 64-bit value.
+     *
+     * @param fileTime  The `FILETIME` being converted.
+     *
+     * @returns         The number of 100-nanosecond intervals since January 1, 1601 (UTC) represented by the `fileTime`.
+     */
+    static uint64_t getFileTimeValue ( const FILETIME& fileTime ) {
+
+        return ( ((uint64_t) fileTime.dwHighDateTime << 32) | fileTime.dwLowDateTime );
+
+    }
+
+    /**
+     * Get the path to a Known Folder of the Current User from the Windows API.
+     *
+     * @param folderId  The ID of the Known Folder being retrieved.
+     *
+     * @returns         An `std::optional` containing the path to the Known Folder,
+     *                  which is empty if the Known Folder could not be retrieved.
+     */
+    static std::optional<std::wstring> getKnownFolderPath ( REFKNOWNFOLDERID folderId ) {
+
+        // Wide-Character Null-Terminated String to the Known Folder.
+        // Has to be freed using `CoTaskMemFree` according to the Windows API.
+        PWSTR folderPath = nullptr;
+        // The path to the Known Folder, if it could be retrieved.
+        std::optional<std::wstring> result = {};
+
+        if ( SUCCEEDED( SHGetKnownFolderPath(folderId, 0, NULL, &folderPath) ) )
+            result = folderPath;
+
+        CoTaskMemFree(folderPath);
+        return result;
+
+    }
+
+    /**
+     * Get the time a file or directory was last modified.
+     *
+     * The time is retrieved from the directory entry using `FindFirstFileExW()`,
+     * so the file or directory itself never has to be opened.
+     *
+     * @param path  The path to the file or directory.
+     *
+     * @returns     An `std::optional` containing the time the file or directory was last modified as a `FILETIME` value,
+     *              which is empty if the file or directory does not exist.
+     */
+    static std::optional<uint64_t> getLastWriteTime ( const std::wstring& path ) {
+
+        WIN32_FIND_DATAW findData = {};     // Receives the directory entry for the `path`.
+        HANDLE findHandle = FindFirstFileExW(path.c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, NULL, 0);
+
+        if (findHandle == INVALID_HANDLE_VALUE)
+            return std::nullopt;
+
+        FindClose(findHandle);
+        return getFileTimeValue(findData.ftLastWriteTime);
+
+    }
+
+    /**
+     * Get the names of the subdirectories of a directory matching a Wildcard Pattern.
+     *
+     * Directory Junctions and other Reparse Points are skipped, so that the legacy
+     * directories Windows keeps for compatibility are not searched twice.
+     *
+     * @param directoryPath     The path to the directory being searched.
+     * @param pattern           The Wildcard Pattern the names of the subdirectories must match.
+     *
+     * @returns                 The names of the matching subdirectories.
+     */
+    static std::vector<std::wstring> findSubdirectories ( const std::wstring& directoryPath, const wchar_t* pattern ) {
+
+        std::vector<std::wstring> subdirectoryNames = {};   // The names of the matching subdirectories.
+        WIN32_FIND_DATAW findData = {};                     // Receives each of the matching directory entries.
+        HANDLE findHandle = FindFirstFileExW(
+            (directoryPath + L"\\" + pattern).c_str(),
+            FindExInfoBasic,
+            &findData,
+            FindExSearchLimitToDirectories,
+            NULL,
+            FIND_FIRST_EX_LARGE_FETCH
+        );
+
+        if (findHandle == INVALID_HANDLE_VALUE)
+            return subdirectoryNames;
+
+        do {
+            std::wstring_view name = findData.cFileName;   // The name of the current directory entry.
+
+            // Limiting the search to directories is only a hint to the File System, so files still have to be skipped.
+            if ( !(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) || (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) )
+                continue;
+            if (name == L"." || name == L"..")
+                continue;
+
+            subdirectoryNames.emplace_back(name);
+        } while ( FindNextFileW(findHandle, &findData) );
+
+        FindClose(findHandle);
+        return subdirectoryNames;
+
+    }
+
+
+    /* ConfigurationDiscovery */
+    // Class Constants
+
+    const std::wstring ConfigurationDiscovery::INDEX_FILE_NAME = L"discovery_index";
+    const std::filesystem::path ConfigurationDiscovery::INDEX_FILE_PATH = { PROGRAM_DATA_PATH / INDEX_FILE_NAME };
+    const uint64_t ConfigurationDiscovery::INDEX_MAX_AGE = ( 24ULL * 60ULL * 60ULL * 10'000'000ULL );
+
+    // Static Methods
+
+    size_t ConfigurationDiscovery::discover ( const DiscoveryCallback& onDiscovered, std::stop_token stopToken ) {
+
+        ScopedTraceTimer traceTimer = { "ConfigurationDiscovery::discover", "config" };
+        std::optional<DiscoveryIndex> savedIndex = fetchFromFile();     // The Discovery Index saved by a previous search, if any.
+        DiscoveryIndex newIndex = {};                                   // The Discovery Index saved once the search is complete.
+        std::mutex discoveryMutex = {};                                 // Serializes access to the `newIndex` and `discoveredKeys`.
+        std::unordered_set<std::wstring> discoveredKeys = {};           // The lowercase paths of the directories that have already been reported.
+        std::vector<std::future<void>> searches = {};                   // The searches running in parallel.
+        FILETIME currentTime = {};                                      // The time at which the search was started.
+
+        // The paths to the Known Folders of the Current User used to find its Default Configuration Directory.
+        std::optional<std::wstring> documentsDirPath = getKnownFolderPath(FOLDERID_Documents);
+        std::optional<std::wstring> profileDirPath = getKnownFolderPath(FOLDERID_Profile);
+        // The path to the directory containing the User Profiles of every user, and the time it was last modified.
+        std::optional<std::wstring> profilesDirPath = getKnownFolderPath(FOLDERID_UserProfiles);
+        std::optional<uint64_t> profilesWriteTime = ( profilesDirPath ? getLastWriteTime(*profilesDirPath) : std::nullopt );
+
+        /**
+         * A lambda helper function used to report a directory if it contains a Terraria Configuration File.
+         *
+         * May be called concurrently from multiple threads.
+         *
+         * @param directoryPath     The path to the directory being checked.
+         * @param profileName       The name of the User Profile the directory belongs to.
+         * @param isDefault         Indicates if this is the Default Configuration Directory of the Current User.
+         */
+        auto checkDirectory = [&onDiscovered, &newIndex, &discoveryMutex, &discoveredKeys, &stopToken] (
+            const std::wstring& directoryPath,
+            const std::wstring& profileName,
+            bool isDefault
+        ) {
+
+            // The time the Terraria Configuration File was last modified, if it exists.
+            std::optional<uint64_t> lastWriteTime = {};
+
+            if ( stopToken.stop_requested() || !(lastWriteTime = getLastWriteTime(directoryPath + L"\\" + CONFIG_FILE_NAME)) )
+                return;
+
+            // The directory being reported.
+            DiscoveredConfigDirectory directory = {
+                .directoryPath = directoryPath,
+                .profileName = profileName,
+                .isDefault = isDefault,
+                .lastWriteTime = *lastWriteTime
+            };
+
+            {
+                std::lock_guard<std::mutex> lock(discoveryMutex);
+
+                // The same directory may be reached through more than one User Profile,
+                // and nothing more is reported once the search has been stopped.
+                if ( stopToken.stop_requested() || !discoveredKeys.insert( UTILS_NAMESPACE::stringToLowercase(directoryPath) ).second )
+                    return;
+
+                // The Default Configuration Directory is determined again by every search, so it is not saved as such.
+                newIndex.directories.push_back(directory);
+                newIndex.directories.back().isDefault = false;
+            }
+
+            onDiscovered(directory);
+
+        };
+
+        GetSystemTimeAsFileTime(&currentTime);
+
+        // The Current User is checked first, so that its Default Configuration Directory is always reported as the default.
+        if (documentsDirPath) {
+            checkDirectory(
+                *documentsDirPath + TERRARIA_DOCUMENTS_PATH,
+                ( profileDirPath ? std::filesystem::path(*profileDirPath).filename().wstring() : std::wstring() ),
+                true
+            );
+        }
+
+        // When no User Profiles have been added or removed since the last full search,
+        // only the directories in the Discovery Index need to be checked again.
+        if (
+            savedIndex
+            && profilesWriteTime && savedIndex->profilesWriteTime == *profilesWriteTime
+            && getFileTimeValue(currentTime) - savedIndex->searchTime < INDEX_MAX_AGE
+        ) {
+            newIndex.profilesWriteTime = savedIndex->profilesWriteTime;
+            newIndex.searchTime = savedIndex->searchTime;
+
+            for ( const DiscoveredConfigDirectory& directory : savedIndex->directories ) {
+                searches.push_back( std::async(
+                    std::launch::async,
+                    [&checkDirectory, &directory] () { checkDirectory(directory.directoryPath, directory.profileName, false); }
+                ) );
+            }
+        }
+        // Otherwise, each of the User Profiles is searched in parallel.
+        else if (profilesDirPath) {
+            newIndex.profilesWriteTime = profilesWriteTime.value_or(0ULL);
+            newIndex.searchTime = getFileTimeValue(currentTime);
+
+            for ( std::wstring& profileName : findSubdirectories(*profilesDirPath, L"*") ) {
+                searches.push_back( std::async(
+                    std::launch::async,
+                    [&checkDirectory, &stopToken, profilePath = (*profilesDirPath + L"\\" + profileName), profileName = std::move(profileName)] () {
+
+                        if ( stopToken.stop_requested() )
+                            return;
+
+                        ScopedTraceTimer profileTraceTimer = { "ConfigurationDiscovery::searchProfile", "config", profileName };
+                        // The Documents Folders of the User Profile, including any that have been moved into OneDrive.
+                        std::vector<std::wstring> documentsDirPaths = { profilePath + L"\\Documents" };
+
+                        for ( const std::wstring& oneDriveDirName : findSubdirectories(profilePath, L"OneDrive*") )
+                            documentsDirPaths.push_back(profilePath + L"\\" + oneDriveDirName + L"\\Documents");
+
+                        for ( const std::wstring& documentsDirPath : documentsDirPaths )
+                            checkDirectory(documentsDirPath + TERRARIA_DOCUMENTS_PATH, profileName, false);
+
+                    }
+                ) );
+            }
+        }
+
+        for ( std::future<void>& search : searches )
+            search.wait();
+
+        // An incomplete search would cause the next search to miss directories, so it is never saved.
+        if ( stopToken.stop_requested() )
+            return newIndex.directories.size();
+
+        std::sort(
+            newIndex.directories.begin(),
+            newIndex.directories.end(),
+            [] ( const DiscoveredConfigDirectory& a, const DiscoveredConfigDirectory& b ) { return a.directoryPath < b.directoryPath; }
+        );
+
+        if ( !savedIndex || *savedIndex != newIndex )
+            saveToFile(newIndex);
+
+        return newIndex.directories.size();
+
+    }
+
+    // Serialization & Persistence to File
+
+    std::optional<ConfigurationDiscovery::DiscoveryIndex> ConfigurationDiscovery::fetchFromFile () {
+
+        // Don't read the Discovery Index File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return std::nullopt;
+
+        // The contents of the Discovery Index File, if it exists.
+        std::optional<std::wstring> contents = UTILS_NAMESPACE::readTextFile(INDEX_FILE_PATH);
+
+        if (!contents)
+            return std::nullopt;
+
+        std::wistringstream fileStream(*contents);  // The Stream used to read the Discovery Index File.
+        std::wstring currentLine = {};              // Contains the Current Line from the Discovery Index File.
+        DiscoveryIndex index = {};                  // The saved Discovery Index.
+        wchar_t* fieldEnd = nullptr;                // Receives the end of each of the numeric fields being parsed.
+
+        // The first line contains the time the User Profiles Directory was last modified,
+        // followed by a Tab and the time at which the full search was performed.
+        if ( !std::getline(fileStream, currentLine) )
+            return std::nullopt;
+
+        index.profilesWriteTime = std::wcstoull(currentLine.c_str(), &fieldEnd, 10);
+
+        if (*fieldEnd != L'\t')
+            return std::nullopt;
+
+        index.searchTime = std::wcstoull(fieldEnd + 1, &fieldEnd, 10);
+
+        // Each subsequent line contains the time the Terraria Configuration File was last modified,
+        // followed by a Tab, the name of the User Profile, another Tab, and the path to the directory.
+        while ( std::getline(fileStream, currentLine) ) {
+            DiscoveredConfigDirectory directory = {};   // The directory on the Current Line.
+            size_t profileNamePos = 0ULL;               // The position of the name of the User Profile.
+            size_t directoryPathPos = 0ULL;             // The position of the path to the directory.
+
+            directory.lastWriteTime = std::wcstoull(currentLine.c_str(), &fieldEnd, 10);
+
+            if (*fieldEnd != L'\t')
+                continue;
+
+            profileNamePos = (size_t) (fieldEnd - currentLine.c_str()) + 1ULL;
+            directoryPathPos = currentLine.find(L'\t', profileNamePos);
+
+            if ( directoryPathPos == std::wstring::npos || directoryPathPos + 1ULL >= currentLine.size() )
+                continue;
+
+            directory.profileName = currentLine.substr(profileNamePos, directoryPathPos - profileNamePos);
+            directory.directoryPath = currentLine.substr(directoryPathPos + 1ULL);
+            directory.isDefault = false;
+            index.directories.push_back( std::move(directory) );
+        }
+
+        return index;
+
+    }
+
+    bool ConfigurationDiscovery::saveToFile ( const DiscoveryIndex& index ) {
+
+        // Don't modify the Discovery Index File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return true;
+
+        // The contents of the Discovery Index File.
+        std::wstring contents = std::format(L"{:d}\t{:d}", index.profilesWriteTime, index.searchTime);
+
+        for ( const DiscoveredConfigDirectory& directory : index.directories )
+            std::format_to( std::back_inserter(contents), L"\n{:d}\t{:s}\t{:s}", directory.lastWriteTime, directory.profileName, directory.directoryPath );
+
+        if ( !ensureProgramDataDirectoryExists(nullptr) )
+            return false;
+
+        return UTILS_NAMESPACE::writeFileAtomically( INDEX_FILE_PATH, UTILS_NAMESPACE::wideStringToUtf8(contents) );
+
+    }
+
+    bool ConfigurationDiscovery::deleteSavedData () {
+
+        // Don't modify the Discovery Index File in Stateless Mode.
+        if ( programSettings.statelessMode || !std::filesystem::exists(INDEX_FILE_PATH) )
+            return true;
+
+        return std::filesystem::remove(INDEX_FILE_PATH);
+
+    }
+
+}
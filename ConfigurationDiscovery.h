@@ -0,0 +1,138 @@
+#pragma once
+
+
+/*
+* ConfigurationDiscovery.h
+*
+* Header File defining the `ConfigurationDiscovery` class, which searches every User Profile
+* on the computer for Terraria Configuration Files, and keeps an index of the directories
+* it has found so that later searches only need to revalidate them.
+*/
+
+
+#include "framework.h"
+
+#include <cstdint>
+#include <functional>
+#include <stop_token>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/**
+	 * A class providing the discovery of the Terraria Configuration Files of every User Profile on the computer.
+	 *
+	 * Searching every User Profile can take some time, especially when some of them are located on slow or
+	 * network drives, so the User Profiles are searched in parallel and each directory is reported as soon as it has been found.
+	 *
+	 * The directories found by a full search are saved to the Discovery Index, so that subsequent searches only
+	 * need to check that each of them still contains a Terraria Configuration File. A full search is only performed
+	 * again once a User Profile has been added or removed, or once the Discovery Index has become too old.
+	 */
+	class ConfigurationDiscovery {
+
+		/* Type Definitions */
+		public:
+			/**
+			 * A structure type representing a directory containing a Terraria Configuration File.
+			 */
+			typedef struct DiscoveredConfigDirectoryStruct {
+
+				std::wstring directoryPath;		// The path to the directory containing the Terraria Configuration File.
+				std::wstring profileName;		// The name of the User Profile the directory belongs to.
+				bool isDefault;					// Indicates if this is the Default Configuration Directory of the Current User.
+				uint64_t lastWriteTime;			// The time the Terraria Configuration File was last modified, as a `FILETIME`.
+
+				bool operator== ( const DiscoveredConfigDirectoryStruct& ) const = default;
+
+			} DiscoveredConfigDirectory;
+
+			/**
+			 * The Function Signature of the Callback Function invoked for each discovered directory.
+			 *
+			 * The Callback Function may be invoked concurrently from multiple threads.
+			 */
+			typedef std::function<void (const DiscoveredConfigDirectory&)> DiscoveryCallback;
+
+		protected:
+			/**
+			 * A structure type representing the contents of the Discovery Index.
+			 */
+			typedef struct DiscoveryIndexStruct {
+
+				uint64_t profilesWriteTime;								// The time the User Profiles Directory was last modified when the full search was performed.
+				uint64_t searchTime;									// The time at which the full search was performed.
+				std::vector<DiscoveredConfigDirectory> directories;		// The discovered directories, sorted by their paths.
+
+				bool operator== ( const DiscoveryIndexStruct& ) const = default;
+
+			} DiscoveryIndex;
+
+
+		/* Class Constants */
+		protected:
+			static const std::wstring INDEX_FILE_NAME;			// The name of the file used to store the Discovery Index.
+			static const std::filesystem::path INDEX_FILE_PATH;	// The path to the file used to store the Discovery Index.
+			static const uint64_t INDEX_MAX_AGE;				// The amount of time after which a full search is performed again, in `FILETIME` units.
+
+
+		/* Static Methods */
+		public:
+			/**
+			 * Discover the directories containing a Terraria Configuration File across all User Profiles.
+			 *
+			 * The Default Configuration Directory of the Current User is always checked first, and is the only
+			 * directory reported as the default. This method blocks until the search is complete, so it is
+			 * generally called from a Background Thread while the `onDiscovered` Callback Function forwards
+			 * each directory to the thread that needs it.
+			 *
+			 * Once a stop has been requested using the `stopToken`, no further directories are checked or reported,
+			 * and the Discovery Index is left unchanged, as the search is incomplete. Any checks that are already
+			 * in progress are still waited on before this method returns.
+			 *
+			 * @param onDiscovered	The Callback Function invoked as soon as each directory has been discovered.
+			 * 						Each directory is only reported once, even if it is found more than once.
+			 * @param stopToken		The `std::stop_token` used to stop the search early, such as the one of an `std::jthread`.
+			 *
+			 * @returns				The number of directories that were discovered.
+			 */
+			static size_t discover ( const DiscoveryCallback& onDiscovered, std::stop_token stopToken = {} );
+
+
+		/* Serialization & Persistence to File */
+		protected:
+			/**
+			 * Fetch the Discovery Index from the Discovery Index File.
+			 *
+			 * The Discovery Index is stored in a file located at `INDEX_FILE_PATH`,
+			 * and is never read from in Stateless Mode.
+			 *
+			 * @returns		An `std::optional` containing the saved Discovery Index, which is empty
+			 * 				if the Discovery Index File does not exist or could not be parsed.
+			 */
+			static std::optional<DiscoveryIndex> fetchFromFile ();
+
+			/**
+			 * Save the specified Discovery Index to the Discovery Index File.
+			 *
+			 * The Discovery Index is stored in a file located at `INDEX_FILE_PATH`,
+			 * and is never written to in Stateless Mode.
+			 *
+			 * @param index		The Discovery Index being saved.
+			 *
+			 * @returns			`true` on success and `false` on failure.
+			 */
+			static bool saveToFile ( const DiscoveryIndex& index );
+
+		public:
+			/**
+			 * Delete the Discovery Index File, causing the next search to be a full search.
+			 *
+			 * @returns		`true` if the Discovery Index File was successfully
+			 * 				deleted or does not currently exist, otherwise `false`.
+			 */
+			static bool deleteSavedData ();
+
+	};
+
+}
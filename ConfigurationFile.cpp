@@ -0,0 +1,793 @@
+/*
+* ConfigurationFile.cpp
+*
+* Source File defining the `ConfigurationFile` class, which provides
+* a parsed view of a Terraria Configuration File that is shared
+* between reading and writing the Active Display Monitor,
+* as well as the functions used to read and write the Active Display Monitor
+* and to print the changes made to a Terraria Configuration File.
+*/
+
+
+#include "ConfigurationFile.h"
+#include "ConfigurationBackups.h"
+#include "ConfigurationMetadata.h"
+#include "Tracing.h"
+#include <algorithm>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Type Definitions */
+
+    /**
+     * A structure type describing a `Display` Configuration Property matched
+     * within a single line of the Terraria Configuration File.
+     * 
+     * Each field is a view into the raw contents of the Terraria Configuration File.
+     */
+    typedef struct DisplayPropertyMatchStruct {
+
+        std::string_view propertyPrefix;    // The contents of the line up to and including the closing quote of the Property Name.
+        std::string_view propertyName;      // The name of the Configuration Property (e.g., `DisplayWidth`).
+        std::string_view propertyValue;     // The value of the Configuration Property, excluding any surrounding quotes.
+
+    } DisplayPropertyMatch;
+
+    /**
+     * A structure type used to step through the lines of the contents of a Terraria Configuration File
+     * without copying any of them.
+     */
+    typedef struct LineCursorStruct {
+
+        std::string_view contents;      // The raw contents being stepped through.
+        size_t pos;                     // The position of the first character of the next line.
+        size_t lineNum;                 // The number of lines preceding the next line.
+
+    } LineCursor;
+
+
+    /* Internal Helper Functions */
+
+    /**
+     * Match one of the `Display`, `DisplayWidth`, `DisplayHeight`, or `DisplayScreen`
+     * Configuration Properties within a single line of the Terraria Configuration File.
+     * 
+     * The line is matched as if by the Regular Expression `^[^"]*"(Display(?:Width|Height|Screen)?)": "?([^"]+)"?,`,
+     * without allocating any memory or compiling any Regular Expressions.
+     * 
+     * @param line  The line being matched, excluding any Line Terminator.
+     * 
+     * @returns     A `DisplayPropertyMatch` describing the matched Configuration Property,
+     *              wrapped in an `std::optional` object.
+     * 
+     *              If the `line` does not contain one of the `Display` Configuration Properties,
+     *              an empty `std::optional` will be returned.
+     */
+    static std::optional<DisplayPropertyMatch> matchDisplayProperty ( std::string_view line ) {
+
+        // The names of the Configuration Properties that can be matched.
+        constexpr std::string_view PROPERTY_NAMES[] = { "Display", "DisplayWidth", "DisplayHeight", "DisplayScreen" };
+
+        size_t nameStartPos = line.find('"');       // The position of the opening quote of the Property Name.
+        size_t nameEndPos = std::string_view::npos; // The position of the closing quote of the Property Name.
+        size_t valueStartPos = 0ULL;                // The position of the first character of the Property Value.
+        size_t valueEndPos = 0ULL;                  // The position following the last character of the Property Value.
+        std::string_view propertyName = {};         // The name of the Configuration Property.
+
+        if (nameStartPos == std::string_view::npos)
+            return {};
+
+        nameEndPos = line.find('"', nameStartPos + 1ULL);
+
+        if (nameEndPos == std::string_view::npos)
+            return {};
+
+        propertyName = line.substr(nameStartPos + 1ULL, nameEndPos - nameStartPos - 1ULL);
+
+        if ( std::find(std::begin(PROPERTY_NAMES), std::end(PROPERTY_NAMES), propertyName) == std::end(PROPERTY_NAMES) )
+            return {};
+        if ( line.substr(nameEndPos + 1ULL, 2ULL) != ": " )
+            return {};
+
+        valueStartPos = (nameEndPos + 3ULL);
+
+        if ( valueStartPos < line.size() && line[valueStartPos] == '"' )
+            valueStartPos++;
+
+        // The Property Value extends up to the next quote, as long as it is immediately followed by a comma.
+        valueEndPos = std::min(line.find('"', valueStartPos), line.size());
+
+        if ( valueEndPos == valueStartPos )
+            return {};
+
+        // Otherwise, the Property Value extends up to the last comma preceding the next quote.
+        if ( line.substr(valueEndPos, 2ULL) != "\"," ) {
+            valueEndPos = line.substr(0ULL, valueEndPos).rfind(',');
+
+            if ( valueEndPos == std::string_view::npos || valueEndPos <= valueStartPos )
+                return {};
+        }
+
+        return DisplayPropertyMatch{
+            .propertyPrefix = line.substr(0ULL, nameEndPos + 1ULL),
+            .propertyName = propertyName,
+            .propertyValue = line.substr(valueStartPos, valueEndPos - valueStartPos)
+        };
+
+    }
+
+    /**
+     * Read the next line of the contents of a Terraria Configuration File, advancing the `cursor` past it.
+     * 
+     * @param cursor        The `LineCursor` marking the next line.
+     * 
+     * @param endLineNum    The number of the line at which to stop reading lines, if it is reached
+     *                      before the end of the contents.
+     * 
+     * @param oLine         Receives the line that was read, excluding any Line Terminator.
+     * 
+     * @returns             `true` if a line was read, or `false` if the `cursor` was already
+     *                      at the end of the contents or at the `endLineNum`.
+     */
+    static bool readLine ( LineCursor& cursor, size_t endLineNum, _Out_ std::string_view& oLine ) {
+
+        size_t lineEndPos = 0ULL;   // The position of the Line Terminator of the line, or of the end of the contents.
+
+        if ( cursor.pos >= cursor.contents.size() || cursor.lineNum >= endLineNum )
+            return false;
+
+        lineEndPos = std::min( cursor.contents.find('\n', cursor.pos), cursor.contents.size() );
+        oLine = cursor.contents.substr(cursor.pos, lineEndPos - cursor.pos);
+
+        // Exclude Carriage Returns from the line.
+        if ( !oLine.empty() && oLine.back() == '\r' )
+            oLine.remove_suffix(1ULL);
+
+        cursor.pos = std::min<size_t>( lineEndPos + 1ULL, cursor.contents.size() );
+        cursor.lineNum++;
+        return true;
+
+    }
+
+    /**
+     * Move a `LineCursor` back by the specified number of lines.
+     * 
+     * @param cursor    The `LineCursor` being moved.
+     * 
+     * @param count     The number of lines to move the `cursor` back by,
+     *                  which stops at the first line of the contents.
+     */
+    static void rewindLines ( LineCursor& cursor, size_t count ) {
+
+        for ( ; count > 0ULL && cursor.pos > 0ULL; count-- ) {
+            // The position of the Line Terminator of the line preceding the previous line, if any.
+            size_t prevLineEndPos = ( cursor.pos >= 2ULL ? cursor.contents.rfind('\n', cursor.pos - 2ULL) : std::string_view::npos );
+
+            cursor.pos = ( prevLineEndPos != std::string_view::npos ? (prevLineEndPos + 1ULL) : 0ULL );
+            cursor.lineNum--;
+        }
+
+    }
+
+    /**
+     * Write a single line of a Unified Diff using the specified Callback Function.
+     * 
+     * @param oOutputLine   The Wide-Character String reused to assemble each line of the Unified Diff.
+     * 
+     * @param prefix        The character preceding the line (i.e., ` `, `-`, or `+`).
+     * 
+     * @param line          The UTF-8 Encoded line being written, excluding any Line Terminator.
+     * 
+     * @param onLine        The Callback Function invoked with the assembled line.
+     */
+    static void writeDiffLine (
+        _Out_ std::wstring& oOutputLine,
+        wchar_t prefix,
+        std::string_view line,
+        const DiffLineCallback& onLine
+    ) {
+
+        // The number of Wide Characters in the converted line.
+        int lineLength = ( !line.empty() ? MultiByteToWideChar(CP_UTF8, 0, line.data(), (int) line.size(), NULL, 0) : 0 );
+
+        oOutputLine.assign(1ULL, prefix);
+
+        if (lineLength > 0) {
+            oOutputLine.resize(1ULL + lineLength);
+            MultiByteToWideChar(CP_UTF8, 0, line.data(), (int) line.size(), oOutputLine.data() + 1, lineLength);
+        }
+
+        onLine(oOutputLine);
+
+    }
+
+
+    /* ConfigurationFile */
+    // Class Constructors
+
+    ConfigurationFile::ConfigurationFile ( const std::wstring& iFilePath ) : filePath(iFilePath), mappedFile(iFilePath) {
+
+        ScopedTraceTimer traceTimer = { "Read Configuration File", "config", iFilePath };
+
+        this->contents = this->mappedFile.getContents();
+        this->loadDisplayProperties();
+
+    }
+
+    // Instance Methods
+
+    bool ConfigurationFile::isOpen () const {
+
+        return this->contentsAvailable;
+
+    }
+    bool ConfigurationFile::isCurrent () const {
+
+        return ( this->fileIdentity && ConfigurationMetadataCache::getFileIdentity(this->filePath) == this->fileIdentity );
+
+    }
+    bool ConfigurationFile::reload () {
+
+        ScopedTraceTimer traceTimer = { "Read Configuration File", "config", this->filePath };
+        bool isOpen = this->mappedFile.open(this->filePath);  // Indicates if the Terraria Configuration File was successfully opened.
+
+        this->ownedContents.clear();
+        this->contents = this->mappedFile.getContents();
+        this->loadDisplayProperties();
+
+        return isOpen;
+
+    }
+    void ConfigurationFile::close () {
+
+        if ( !this->mappedFile.isOpen() )
+            return;
+
+        // The `displayProperties` are byte offsets, so they remain valid for the copied contents.
+        this->ownedContents.assign(this->contents);
+        this->contents = this->ownedContents;
+        this->mappedFile.close();
+
+    }
+
+    const std::wstring& ConfigurationFile::getFilePath () const {
+
+        return this->filePath;
+
+    }
+    std::string_view ConfigurationFile::getContents () const {
+
+        return this->contents;
+
+    }
+    const ConfigurationFile::DisplayPropertyList& ConfigurationFile::getDisplayProperties () const {
+
+        return this->displayProperties;
+
+    }
+
+    std::string_view ConfigurationFile::getPropertyName ( const DisplayProperty& property ) const {
+
+        return this->contents.substr(property.nameStartPos, property.nameLength);
+
+    }
+    std::string_view ConfigurationFile::getPropertyValue ( const DisplayProperty& property ) const {
+
+        return this->contents.substr(property.valueStartPos, property.valueLength);
+
+    }
+    std::string_view ConfigurationFile::getPropertyPrefix ( const DisplayProperty& property ) const {
+
+        return this->contents.substr(
+            property.lineStartPos,
+            (property.nameStartPos + property.nameLength + 1ULL) - property.lineStartPos
+        );
+
+    }
+    std::string_view ConfigurationFile::getLineTerminator ( const DisplayProperty& property ) const {
+
+        return this->contents.substr(property.lineEndPos, property.nextLineStartPos - property.lineEndPos);
+
+    }
+
+    std::optional<std::wstring> ConfigurationFile::getActiveDisplayId () const {
+
+        for ( const DisplayProperty& property : this->displayProperties ) {
+            if ( this->getPropertyName(property) == "Display" ) {
+                // The raw value of the `Display` Configuration Property.
+                std::string_view propertyValue = this->getPropertyValue(property);
+                // The Display ID with any double-escaped backslashes removed.
+                std::string displayId = {};
+
+                displayId.reserve( propertyValue.size() );
+
+                for ( size_t i = 0ULL; i < propertyValue.size(); i++ ) {
+                    displayId.push_back(propertyValue[i]);
+
+                    if ( propertyValue[i] == '\\' && (i + 1ULL) < propertyValue.size() && propertyValue[i + 1ULL] == '\\' )
+                        i++;
+                }
+
+                return UTILS_NAMESPACE::utf8ToWideString(displayId);
+            }
+        }
+
+        return {};
+
+    }
+
+    void ConfigurationFile::replaceContents ( std::string&& newContents ) {
+
+        this->mappedFile.close();
+        this->ownedContents = std::move(newContents);
+        this->contents = this->ownedContents;
+        this->contentsAvailable = true;
+        this->scanDisplayProperties();
+
+    }
+    void ConfigurationFile::recordWrite () {
+
+        this->fileIdentity = ConfigurationMetadataCache::getFileIdentity(this->filePath);
+
+        if (this->fileIdentity)
+            ConfigurationMetadataCache::recordEntry(this->filePath, *this->fileIdentity, *this);
+
+    }
+
+    // Helper Methods
+
+    void ConfigurationFile::loadDisplayProperties () {
+
+        // The cached metadata of the Terraria Configuration File, if it has not changed since it was cached.
+        std::optional<ConfigurationMetadataCache::MetadataEntry> entry = {};
+
+        this->contentsAvailable = this->mappedFile.isOpen();
+        this->fileIdentity = ConfigurationMetadataCache::getFileIdentity( this->mappedFile.getFileHandle() );
+
+        if (!this->fileIdentity) {
+            this->scanDisplayProperties();
+            return;
+        }
+
+        entry = ConfigurationMetadataCache::findEntry(this->filePath, *this->fileIdentity);
+
+        if ( entry && ConfigurationMetadataCache::matchesContents(*entry, this->contents) ) {
+            this->displayProperties.clear();
+            this->displayProperties.reserve( entry->displayProperties.size() );
+
+            for ( const ConfigurationMetadataCache::CachedDisplayProperty& property : entry->displayProperties )
+                this->displayProperties.push_back(property.offsets);
+
+            return;
+        }
+
+        this->scanDisplayProperties();
+        ConfigurationMetadataCache::recordEntry(this->filePath, *this->fileIdentity, *this);
+
+    }
+    void ConfigurationFile::scanDisplayProperties () {
+
+        // The sequence of characters that begins every `Display` Configuration Property.
+        constexpr std::string_view PROPERTY_NAME_PREFIX = "\"Display";
+
+        // The position in the `contents` to search for the next `Display` Configuration Property from.
+        size_t searchPos = 0ULL;
+        // The position of the next potential `Display` Configuration Property in the `contents`.
+        size_t propertyPos = 0ULL;
+
+        this->displayProperties.clear();
+
+        // Jump directly to each line that could contain a `Display` Configuration Property.
+        while ( (propertyPos = this->contents.find(PROPERTY_NAME_PREFIX, searchPos)) != std::string_view::npos ) {
+            // The position of the first character of the current line.
+            size_t lineStartPos = this->contents.rfind('\n', propertyPos);
+            // The position of the Line Terminator of the current line.
+            size_t lineEndPos = std::min( this->contents.find('\n', propertyPos), this->contents.size() );
+            // The position of the first character of the next line.
+            size_t nextLineStartPos = std::min<size_t>( lineEndPos + 1ULL, this->contents.size() );
+
+            lineStartPos = ( lineStartPos != std::string_view::npos ? (lineStartPos + 1ULL) : 0ULL );
+            searchPos = nextLineStartPos;
+
+            // Exclude Carriage Returns from the current line.
+            if ( lineEndPos > lineStartPos && this->contents[lineEndPos - 1ULL] == '\r' )
+                lineEndPos--;
+
+            // The `Display` Configuration Property on the current line, if any.
+            std::optional<DisplayPropertyMatch> match = matchDisplayProperty(
+                this->contents.substr(lineStartPos, lineEndPos - lineStartPos)
+            );
+
+            if (match) {
+                this->displayProperties.push_back({
+                    .lineStartPos = lineStartPos,
+                    .lineEndPos = lineEndPos,
+                    .nextLineStartPos = nextLineStartPos,
+                    .nameStartPos = (size_t) (match->propertyName.data() - this->contents.data()),
+                    .nameLength = match->propertyName.size(),
+                    .valueStartPos = (size_t) (match->propertyValue.data() - this->contents.data()),
+                    .valueLength = match->propertyValue.size()
+                });
+            }
+        }
+
+    }
+
+
+    /* Active Display Monitor Functions */
+
+    std::optional<DisplayMonitorRegistry::monitor_handle_t> getActiveMonitorFromConfigFile (
+        const ConfigurationFile& configFile,
+        const DisplayMonitorRegistry& displayMonitors
+    ) {
+
+        // The Display ID of the Active Display Monitor.
+        std::optional<std::wstring> selectedDisplayId = configFile.getActiveDisplayId();
+
+        if (!selectedDisplayId)
+            return {};
+
+        // Attempt to match the Active Display Monitor to one of the provided `displayMonitors`.
+        return displayMonitors.findByDisplayId(*selectedDisplayId);
+
+    }
+    std::optional<DisplayMonitorRegistry::monitor_handle_t> getActiveMonitorFromConfigFile (
+        const std::wstring& filePath,
+        const DisplayMonitorRegistry& displayMonitors
+    ) {
+
+        // The current File Identity of the Terraria Configuration File.
+        std::optional<FileIdentity> identity = ConfigurationMetadataCache::getFileIdentity(filePath);
+        // The cached metadata of the Terraria Configuration File, if it has not changed since it was cached.
+        std::optional<ConfigurationMetadataCache::MetadataEntry> entry = {};
+
+        if (!identity)
+            return {};
+
+        if ( (entry = ConfigurationMetadataCache::findEntry(filePath, *identity)) ) {
+            if (!entry->activeDisplayId)
+                return {};
+
+            return displayMonitors.findByDisplayId(*entry->activeDisplayId);
+        }
+
+        // The Terraria Configuration File has changed, so it must be read again.
+        ConfigurationFile configFile = { filePath };
+
+        return getActiveMonitorFromConfigFile(configFile, displayMonitors);
+
+    }
+
+    ConfigFilePatchList planActiveMonitorPatches (
+        const ConfigurationFile& configFile,
+        const DisplayMonitor& newSelectedMonitor,
+        _Out_ ChangedValuesMap& oChangedValues,
+        const std::optional<DisplayMonitor::DisplayResolution>& resolution
+    ) {
+
+        // Contains the Display ID of the Active Display Monitor, in which all
+        // of the backslashes have already been double-escaped for writing.
+        std::string selectedDisplayId = {};
+        // The patches replacing each of the `Display` Configuration Properties.
+        ConfigFilePatchList patches = {};
+        // The Configuration Properties modified by the `patches`, relative to the contents of the `configFile`.
+        ChangedValuesMap patchedValues = {};
+        // The Display Resolution written to the `DisplayWidth` and `DisplayHeight` Configuration Properties.
+        const DisplayMonitor::DisplayResolution& newResolution = resolution.value_or(newSelectedMonitor.currentResolution);
+
+        for ( char ch : UTILS_NAMESPACE::wideStringToUtf8(newSelectedMonitor.displayId) ) {
+            if (ch == '\\')
+                selectedDisplayId.push_back('\\');
+
+            selectedDisplayId.push_back(ch);
+        }
+
+        // Patch each of the `Display` Configuration Properties, replacing the entire line containing each of them.
+        for ( const ConfigurationFile::DisplayProperty& property : configFile.getDisplayProperties() ) {
+            std::string_view propertyNameStr = configFile.getPropertyName(property);               // The name of the Configuration Property.
+            std::wstring propertyName = UTILS_NAMESPACE::utf8ToWideString(propertyNameStr);        // The name of the Configuration Property.
+            std::wstring oldValueStr = UTILS_NAMESPACE::utf8ToWideString(                          // The old value to be added to the `patchedValues` map.
+                configFile.getPropertyValue(property)
+            );
+            std::wstring newValueStr = {};                                                          // The new value to be added to the `patchedValues` map.
+            // The patch replacing the line containing the Configuration Property.
+            ConfigFilePatch patch = {
+                .startPos = property.lineStartPos,
+                .endPos = property.nextLineStartPos,
+                .replacement = std::string( configFile.getPropertyPrefix(property) )
+            };
+
+            if ( propertyNameStr == "DisplayWidth" || propertyNameStr == "DisplayHeight" ) {
+                // The new width or height.
+                DWORD newValue = (
+                    propertyNameStr == "DisplayWidth"
+                        ? newResolution.displayWidth
+                        : newResolution.displayHeight
+                );
+                // The previous width or height, converted to an integer type.
+                DWORD matchValue = std::stoul(oldValueStr);
+
+                if (newValue != matchValue) {
+                    patch.replacement.append(": ")
+                                     .append( std::to_string(newValue) )
+                                     .append(",")
+                                     .append( configFile.getLineTerminator(property) );
+                    patches.push_back( std::move(patch) );
+                    newValueStr = std::to_wstring(newValue);
+                }
+            }
+            else {
+                patch.replacement.append(": \"")
+                                 .append(selectedDisplayId)
+                                 .append("\",")
+                                 .append( configFile.getLineTerminator(property) );
+                patches.push_back( std::move(patch) );
+                oldValueStr = (L'"' + oldValueStr + L'"');
+                newValueStr = (L'"' + UTILS_NAMESPACE::utf8ToWideString(selectedDisplayId) + L'"');
+            }
+
+            // We assume that changes have been made anytime `newValueStr` is populated.
+            if ( !newValueStr.empty() )
+                patchedValues.emplace( std::move(propertyName), std::make_pair( std::move(oldValueStr), std::move(newValueStr) ) );
+        }
+
+        mergeChangedValues(oChangedValues, patchedValues);
+        return patches;
+
+    }
+
+    void mergeChangedValues ( _Out_ ChangedValuesMap& oChangedValues, const ChangedValuesMap& newChanges ) {
+
+        for ( const auto& [propertyName, values] : newChanges ) {
+            if ( !oChangedValues.contains(propertyName) ) {
+                oChangedValues.emplace(propertyName, values);
+            }
+            else if ( oChangedValues[propertyName].first != values.second ) {
+                oChangedValues[propertyName].second = values.second;
+            }
+            else {
+                oChangedValues.erase(propertyName);
+            }
+        }
+
+    }
+
+    std::string applyConfigFilePatches ( std::string_view contents, const ConfigFilePatchList& patches ) {
+
+        // The patched contents of the Terraria Configuration File.
+        std::string outputData = {};
+        // The position of the first character of the `contents` that has not yet been copied to the `outputData`.
+        size_t copyPos = 0ULL;
+
+        // The patched contents are never much larger than the original contents.
+        outputData.reserve( contents.size() + 128ULL );
+
+        // Copy every character in between each of the patches without modification.
+        for ( const ConfigFilePatch& patch : patches ) {
+            outputData.append(contents, copyPos, patch.startPos - copyPos)
+                      .append(patch.replacement);
+            copyPos = patch.endPos;
+        }
+
+        // Copy the remainder of the Terraria Configuration File.
+        outputData.append(contents, copyPos);
+        return outputData;
+
+    }
+
+    bool setActiveMonitorInConfigFile (
+        ConfigurationFile& configFile,
+        const DisplayMonitor& newSelectedMonitor,
+        _Out_ ChangedValuesMap& oChangedValues,
+        const std::optional<DisplayMonitor::DisplayResolution>& resolution
+    ) {
+
+        // Times the entire modification of the Terraria Configuration File.
+        ScopedTraceTimer traceTimer = { "setActiveMonitorInConfigFile", "config", configFile.getFilePath() };
+
+        // Catch any exceptions that are raised and return `false` on error.
+        try {
+            // Attempt to read the Terraria Configuration File again if it could not be opened before,
+            // or if it has been replaced since it was read, so that changes made by other programs are never reverted.
+            if ( !configFile.isOpen() || !configFile.isCurrent() )
+                configFile.reload();
+
+            if ( configFile.isOpen() ) {
+                // The raw contents of the Current Terraria Configuration File.
+                std::string_view configFileContents = configFile.getContents();
+                // The Modified Configuration Properties, which only replace the `oChangedValues` once the changes have been written.
+                ChangedValuesMap changedValues = oChangedValues;
+                // The updated contents of the Terraria Configuration File.
+                std::string outputData = {};
+
+                // Times the patching of the `Display` Configuration Properties.
+                std::optional<ScopedTraceTimer> patchTraceTimer;
+                patchTraceTimer.emplace("Patch Configuration File", "config");
+
+                outputData = applyConfigFilePatches(
+                    configFileContents,
+                    planActiveMonitorPatches(configFile, newSelectedMonitor, changedValues, resolution)
+                );
+                patchTraceTimer.reset();
+
+                // Terraria Configuration Files that already use the `newSelectedMonitor` and `newResolution`
+                // are left untouched, so nothing is backed up, written, or reported as having changed.
+                if (outputData == configFileContents)
+                    return true;
+
+                // Back up the unmodified contents before they are replaced. Failing to record
+                // the Backup Generation does not prevent the Active Display Monitor from being changed.
+                if (!programSettings.dryRun)
+                    ConfigurationBackupStore::recordGeneration(configFile.getFilePath(), configFileContents);
+
+                // The updated contents become the contents of the `configFile`,
+                // which also unmaps the Terraria Configuration File so that it can be replaced.
+                configFile.replaceContents( std::move(outputData) );
+
+                // If the updated contents could not be written, the `configFile`
+                // goes back to reflecting the unmodified Terraria Configuration File.
+                if ( !programSettings.dryRun && !UTILS_NAMESPACE::writeFileAtomically(configFile.getFilePath(), configFile.getContents()) ) {
+                    configFile.reload();
+                    return false;
+                }
+
+                // Cache the new contents, so that the next `ConfigurationFile` for the file does not need to scan them again.
+                if (!programSettings.dryRun)
+                    configFile.recordWrite();
+
+                oChangedValues = std::move(changedValues);
+                return true;
+            }
+        }
+        catch (...) {}
+
+        return false;
+
+    }
+
+    size_t writeConfigFileDiff (
+        std::string_view oldContents,
+        std::string_view newContents,
+        size_t contextLines,
+        std::wstring_view oldLabel,
+        std::wstring_view newLabel,
+        const DiffLineCallback& onLine
+    ) {
+
+        // Times the comparison of both versions of the Terraria Configuration File.
+        ScopedTraceTimer traceTimer = { "writeConfigFileDiff", "config" };
+
+        LineCursor oldCursor = { oldContents, 0ULL, 0ULL };     // The next line of the original version.
+        LineCursor newCursor = { newContents, 0ULL, 0ULL };     // The next line of the updated version.
+        std::string_view oldLine = {};                          // The current line of the original version.
+        std::string_view newLine = {};                          // The current line of the updated version.
+        bool hasOldLine = false;                                // Indicates if the `oldLine` was read.
+        bool hasNewLine = false;                                // Indicates if the `newLine` was read.
+        std::wstring outputLine = {};                           // The current line of the Unified Diff, whose buffer is reused for each line.
+        size_t hunkCount = 0ULL;                                // The number of Hunks that have been written.
+
+        while (true) {
+            // The number of unchanged lines since the end of the previous Hunk.
+            size_t unchangedLineCount = 0ULL;
+
+            // Skip to the next changed line, stopping once both versions have been exhausted.
+            while (true) {
+                LineCursor oldLineStart = oldCursor;    // The start of the `oldLine`.
+                LineCursor newLineStart = newCursor;    // The start of the `newLine`.
+
+                hasOldLine = readLine(oldCursor, SIZE_MAX, oldLine);
+                hasNewLine = readLine(newCursor, SIZE_MAX, newLine);
+
+                if ( !hasOldLine && !hasNewLine )
+                    return hunkCount;
+                if ( !hasOldLine || !hasNewLine || oldLine != newLine ) {
+                    oldCursor = oldLineStart;
+                    newCursor = newLineStart;
+                    break;
+                }
+
+                unchangedLineCount++;
+            }
+
+            // The Hunk begins with the unchanged lines preceding the first change.
+            rewindLines( oldCursor, std::min(contextLines, unchangedLineCount) );
+            rewindLines( newCursor, std::min(contextLines, unchangedLineCount) );
+
+            LineCursor oldHunkStart = oldCursor;    // The first line of the Hunk in the original version.
+            LineCursor newHunkStart = newCursor;    // The first line of the Hunk in the updated version.
+            LineCursor oldHunkEnd = oldCursor;      // The line following the Hunk in the original version.
+            LineCursor newHunkEnd = newCursor;      // The line following the Hunk in the updated version.
+            size_t unchangedRunLength = 0ULL;       // The number of consecutive unchanged lines following the last change.
+
+            // Find the end of the Hunk, which includes every change that is not separated
+            // from the previous one by more than twice the number of `contextLines`.
+            while (true) {
+                hasOldLine = readLine(oldCursor, SIZE_MAX, oldLine);
+                hasNewLine = readLine(newCursor, SIZE_MAX, newLine);
+
+                if ( !hasOldLine && !hasNewLine )
+                    break;
+
+                if ( hasOldLine && hasNewLine && oldLine == newLine ) {
+                    if ( ++unchangedRunLength > (2ULL * contextLines) )
+                        break;
+                    if ( unchangedRunLength > contextLines )
+                        continue;
+                }
+                else {
+                    unchangedRunLength = 0ULL;
+                }
+
+                oldHunkEnd = oldCursor;
+                newHunkEnd = newCursor;
+            }
+
+            if ( hunkCount++ == 0ULL ) {
+                outputLine.assign(L"--- ").append(oldLabel);
+                onLine(outputLine);
+                outputLine.assign(L"+++ ").append(newLabel);
+                onLine(outputLine);
+            }
+
+            // Empty ranges are numbered after the line preceding them, as they are by `diff -u`.
+            outputLine.clear();
+            std::format_to(
+                std::back_inserter(outputLine),
+                L"@@ -{:d},{:d} +{:d},{:d} @@",
+                oldHunkStart.lineNum + ( oldHunkEnd.lineNum > oldHunkStart.lineNum ? 1ULL : 0ULL ),
+                oldHunkEnd.lineNum - oldHunkStart.lineNum,
+                newHunkStart.lineNum + ( newHunkEnd.lineNum > newHunkStart.lineNum ? 1ULL : 0ULL ),
+                newHunkEnd.lineNum - newHunkStart.lineNum
+            );
+            onLine(outputLine);
+
+            oldCursor = oldHunkStart;
+            newCursor = newHunkStart;
+
+            // Write each line of the Hunk, grouping the removed lines of each run of changes before the added lines.
+            while (true) {
+                LineCursor oldChangeStart = oldCursor;  // The first line of the current run of changes in the original version.
+                LineCursor newChangeStart = newCursor;  // The first line of the current run of changes in the updated version.
+
+                hasOldLine = readLine(oldCursor, oldHunkEnd.lineNum, oldLine);
+                hasNewLine = readLine(newCursor, newHunkEnd.lineNum, newLine);
+
+                if ( !hasOldLine && !hasNewLine )
+                    break;
+
+                if ( hasOldLine && hasNewLine && oldLine == newLine ) {
+                    writeDiffLine(outputLine, L' ', oldLine, onLine);
+                    continue;
+                }
+
+                // Find the end of the current run of changes.
+                while (true) {
+                    LineCursor oldLineStart = oldCursor;    // The start of the `oldLine`.
+                    LineCursor newLineStart = newCursor;    // The start of the `newLine`.
+
+                    hasOldLine = readLine(oldCursor, oldHunkEnd.lineNum, oldLine);
+                    hasNewLine = readLine(newCursor, newHunkEnd.lineNum, newLine);
+
+                    if ( !hasOldLine && !hasNewLine )
+                        break;
+                    if ( hasOldLine && hasNewLine && oldLine == newLine ) {
+                        oldCursor = oldLineStart;
+                        newCursor = newLineStart;
+                        break;
+                    }
+                }
+
+                while ( readLine(oldChangeStart, oldCursor.lineNum, oldLine) )
+                    writeDiffLine(outputLine, L'-', oldLine, onLine);
+                while ( readLine(newChangeStart, newCursor.lineNum, newLine) )
+                    writeDiffLine(outputLine, L'+', newLine, onLine);
+            }
+
+            oldCursor = oldHunkEnd;
+            newCursor = newHunkEnd;
+        }
+
+    }
+
+}
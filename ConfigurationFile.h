@@ -0,0 +1,445 @@
+#pragma once
+
+
+/*
+* ConfigurationFile.h
+*
+* Header File defining the `ConfigurationFile` class, which provides
+* a parsed view of a Terraria Configuration File that is shared
+* between reading and writing the Active Display Monitor,
+* as well as the functions used to read and write the Active Display Monitor
+* and to print the changes made to a Terraria Configuration File.
+*/
+
+
+#include "framework.h"
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/* Type Definitions */
+
+	/**
+	 * A type representing a Map of Configuration Property Names to an `std::pair`
+	 * containing the old and new Configuration Property Values.
+	 * 
+	 * The Configuration Property Name and Property Values are all represented
+	 * by Wide-Character Strings.
+	 */
+	typedef std::unordered_map< std::wstring, std::pair<std::wstring, std::wstring> > ChangedValuesMap;
+
+	/**
+	 * A structure type representing a single replacement made to the contents of a Terraria Configuration File.
+	 */
+	typedef struct ConfigFilePatchStruct {
+
+		size_t startPos;			// The position of the first character being replaced.
+		size_t endPos;				// The position following the last character being replaced.
+		std::string replacement;	// The characters replacing those between the `startPos` and `endPos`.
+
+	} ConfigFilePatch;
+
+	// A collection of `ConfigFilePatch` structures, in the order they appear in the Terraria Configuration File and never overlapping.
+	typedef std::vector<ConfigFilePatch> ConfigFilePatchList;
+
+	/**
+	 * A structure type uniquely identifying a single version of a file,
+	 * such as one returned by `ConfigurationMetadataCache::getFileIdentity()`.
+	 */
+	typedef struct FileIdentityStruct {
+
+		uint32_t volumeSerialNumber = 0UL;	// The Serial Number of the Volume containing the file.
+		uint64_t fileIndex = 0ULL;			// The File Index of the file, which is unique within its Volume.
+		uint64_t fileSize = 0ULL;			// The size of the file, in bytes.
+		uint64_t lastWriteTime = 0ULL;		// The time the file was last modified, as a `FILETIME`.
+
+		bool operator== ( const FileIdentityStruct& ) const = default;
+
+	} FileIdentity;
+
+	/**
+	 * The Function Signature of the Callback Function invoked for each line of a Unified Diff.
+	 * 
+	 * The Wide-Character String passed to the Callback Function does not include a Line Terminator,
+	 * and is only valid until the Callback Function returns.
+	 */
+	typedef std::function<void (const std::wstring&)> DiffLineCallback;
+
+
+	/**
+	 * A class providing a parsed view of a Terraria Configuration File.
+	 *
+	 * The Terraria Configuration File is mapped into memory and scanned once when the `ConfigurationFile`
+	 * is constructed, recording the byte offsets of every `Display` Configuration Property it contains.
+	 * The same `ConfigurationFile` can then be used to both read and write the Active Display Monitor
+	 * without reading the file again or matching any Regular Expressions.
+	 *
+	 * Terraria Configuration Files that have not changed since they were last read are not scanned at all,
+	 * as the byte offsets recorded by the `ConfigurationMetadataCache` are used instead.
+	 *
+	 * A `ConfigurationFile` that is kept for some time, such as while waiting on the user, should be `close()`d
+	 * between operations so that other programs (e.g., Terraria itself) can replace the Terraria Configuration File.
+	 * `setActiveMonitorInConfigFile()` checks the File Identity of the Terraria Configuration File before using
+	 * the contents of the `ConfigurationFile`, reading it again if it has been replaced in the meantime.
+	 */
+	class ConfigurationFile {
+
+		/* Inner Structure Types */
+		public:
+			/**
+			 * A structure type containing the byte offsets of a `Display` Configuration Property
+			 * (i.e., `Display`, `DisplayWidth`, `DisplayHeight`, or `DisplayScreen`)
+			 * within the contents of the Terraria Configuration File.
+			 */
+			typedef struct DisplayPropertyStruct {
+
+				size_t lineStartPos;		// The position of the first character of the line containing the Configuration Property.
+				size_t lineEndPos;			// The position of the Line Terminator of the line, or of the end of the contents.
+				size_t nextLineStartPos;	// The position of the first character of the following line, or of the end of the contents.
+				size_t nameStartPos;		// The position of the first character of the name of the Configuration Property.
+				size_t nameLength;			// The length of the name of the Configuration Property.
+				size_t valueStartPos;		// The position of the first character of the value of the Configuration Property.
+				size_t valueLength;			// The length of the value of the Configuration Property, excluding any surrounding quotes.
+
+			} DisplayProperty;
+
+			// A collection of `DisplayProperty` structures, in the order they appear in the Terraria Configuration File.
+			typedef std::vector<DisplayProperty> DisplayPropertyList;
+
+
+		/* Instance Properties */
+		private:
+			// A Wide-Character String containing the path to the Terraria Configuration File.
+			std::wstring filePath;
+			// The Terraria Configuration File, mapped into memory for reading.
+			UTILS_NAMESPACE::MemoryMappedFile mappedFile;
+			/**
+			 * The contents of the Terraria Configuration File once they have been replaced using `replaceContents()`
+			 * or copied using `close()`, at which point the `mappedFile` is closed.
+			 */
+			std::string ownedContents = {};
+			// Indicates if the `contents` are available, either from the `mappedFile` or the `ownedContents`.
+			bool contentsAvailable = false;
+			/**
+			 * The File Identity of the Terraria Configuration File the `contents` were read from or last written to,
+			 * which is empty if it could not be determined.
+			 */
+			std::optional<FileIdentity> fileIdentity = {};
+			// The raw contents of the Terraria Configuration File, from either the `mappedFile` or the `ownedContents`.
+			std::string_view contents = {};
+			// The `Display` Configuration Properties found in the `contents`.
+			DisplayPropertyList displayProperties = {};
+
+
+		/* Class Constructors */
+		public:
+			/**
+			 * Construct a new `ConfigurationFile` by mapping
+			 * the specified Terraria Configuration File into memory.
+			 *
+			 * Use `isOpen()` to determine if the Terraria Configuration File was successfully opened.
+			 *
+			 * @param iFilePath	A Wide-Character String containing the path to the Terraria Configuration File.
+			 */
+			ConfigurationFile ( const std::wstring& iFilePath );
+			ConfigurationFile ( const ConfigurationFile& ) = delete;
+			ConfigurationFile& operator= ( const ConfigurationFile& ) = delete;
+
+
+		/* Instance Methods */
+		public:
+			/**
+			 * Determine if the contents of the Terraria Configuration File are available.
+			 *
+			 * @returns	`true` if the Terraria Configuration File was successfully opened
+			 * 			or its contents have since been replaced, otherwise `false`.
+			 */
+			bool isOpen () const;
+			/**
+			 * Determine if the Terraria Configuration File has not been replaced since the `contents` were read
+			 * from or last written to it, based on its File Identity.
+			 *
+			 * @returns	`true` if the File Identity of the Terraria Configuration File is unchanged, otherwise `false`.
+			 */
+			bool isCurrent () const;
+			/**
+			 * Map the Terraria Configuration File into memory again, discarding any replaced contents.
+			 *
+			 * @returns	`true` if the Terraria Configuration File was successfully opened, otherwise `false`.
+			 */
+			bool reload ();
+			/**
+			 * Unmap the Terraria Configuration File from memory, allowing it to be replaced by other programs.
+			 *
+			 * The contents are copied first, so the `ConfigurationFile` remains open, and its
+			 * `DisplayPropertyList` remains valid, until `reload()` or `replaceContents()` is called.
+			 */
+			void close ();
+
+			/**
+			 * Get the path to the Terraria Configuration File.
+			 *
+			 * @returns	A Wide-Character String containing the path to the Terraria Configuration File.
+			 */
+			const std::wstring& getFilePath () const;
+			/**
+			 * Get the raw contents of the Terraria Configuration File.
+			 *
+			 * @returns	An `std::string_view` of the contents of the Terraria Configuration File,
+			 * 			which is invalidated by calls to `reload()` and `replaceContents()`.
+			 */
+			std::string_view getContents () const;
+			/**
+			 * Get the `Display` Configuration Properties found in the Terraria Configuration File.
+			 *
+			 * @returns	A `DisplayPropertyList` containing the `Display` Configuration Properties,
+			 * 			which is invalidated by calls to `reload()` and `replaceContents()`.
+			 */
+			const DisplayPropertyList& getDisplayProperties () const;
+
+			/**
+			 * Get the name of a `Display` Configuration Property.
+			 *
+			 * @param property	The `DisplayProperty` of the Configuration Property.
+			 *
+			 * @returns			The name of the Configuration Property (e.g., `DisplayWidth`).
+			 */
+			std::string_view getPropertyName ( const DisplayProperty& property ) const;
+			/**
+			 * Get the value of a `Display` Configuration Property.
+			 *
+			 * @param property	The `DisplayProperty` of the Configuration Property.
+			 *
+			 * @returns			The raw value of the Configuration Property, excluding any surrounding quotes.
+			 */
+			std::string_view getPropertyValue ( const DisplayProperty& property ) const;
+			/**
+			 * Get the contents of the line containing a `Display` Configuration Property
+			 * up to and including the closing quote of the name of the Configuration Property.
+			 *
+			 * @param property	The `DisplayProperty` of the Configuration Property.
+			 *
+			 * @returns			The contents of the line preceding the value of the Configuration Property.
+			 */
+			std::string_view getPropertyPrefix ( const DisplayProperty& property ) const;
+			/**
+			 * Get the Line Terminator of the line containing a `Display` Configuration Property.
+			 *
+			 * @param property	The `DisplayProperty` of the Configuration Property.
+			 *
+			 * @returns			The Line Terminator of the line (e.g., `\r\n`), or an empty
+			 * 					`std::string_view` if the line is the last line of the file.
+			 */
+			std::string_view getLineTerminator ( const DisplayProperty& property ) const;
+
+			/**
+			 * Get the Display ID of the Active Display Monitor.
+			 *
+			 * @returns	A Wide-Character String containing the value of the first `Display`
+			 * 			Configuration Property with any double-escaped backslashes removed,
+			 * 			wrapped in an `std::optional` object.
+			 *
+			 * 			If the Terraria Configuration File does not contain a `Display`
+			 * 			Configuration Property, an empty `std::optional` will be returned.
+			 */
+			std::optional<std::wstring> getActiveDisplayId () const;
+
+			/**
+			 * Replace the contents of the `ConfigurationFile`, typically after they have been written
+			 * to the Terraria Configuration File, and scan them for the `Display` Configuration Properties.
+			 *
+			 * The Terraria Configuration File is unmapped from memory, allowing it to be replaced.
+			 *
+			 * @param newContents	The new contents of the Terraria Configuration File.
+			 */
+			void replaceContents ( std::string&& newContents );
+			/**
+			 * Record that the contents of the `ConfigurationFile` have been written to the Terraria Configuration File,
+			 * updating its File Identity and caching its `Display` Configuration Properties in the `ConfigurationMetadataCache`.
+			 */
+			void recordWrite ();
+
+
+		/* Helper Methods */
+		private:
+			/**
+			 * Record the File Identity of the `mappedFile` and find its `Display` Configuration Properties, using the byte offsets
+			 * recorded by the `ConfigurationMetadataCache` if the Terraria Configuration File has not changed
+			 * since it was cached, and otherwise scanning the `contents` and caching the results.
+			 */
+			void loadDisplayProperties ();
+			/**
+			 * Scan the `contents` for the `Display` Configuration Properties,
+			 * replacing the existing `displayProperties` with the results.
+			 */
+			void scanDisplayProperties ();
+
+	};
+
+
+	/* Active Display Monitor Functions */
+
+	/**
+	 * Get the Active Display Monitor from the Specified Terraria Configuration File.
+	 * 
+	 * @param configFile        The `ConfigurationFile` for the Terraria Configuration File.
+	 * 
+	 * @param displayMonitors   The `DisplayMonitorRegistry` containing the Connected Display Monitors to 
+	 *                          compare to the Active Display Monitor in the Terraria Configuration File.
+	 * 
+	 * @returns                 On success, returns the Handle of the Connected Display Monitor
+	 *                          in the specified `displayMonitors` that is set as the Active Display Monitor
+	 *                          in the Terraria Configuration File, wrapped in an `std::optional` object.
+	 * 
+	 *                          If the specified Terraria Configuration File could not be found or opened,
+	 *                          or if the Active Display Monitor in the Specified Terraria Configuration File
+	 *                          was not found in the specified `displayMonitors`, 
+	 *                          an empty `std::optional` will be returned.
+	 */
+	std::optional<DisplayMonitorRegistry::monitor_handle_t> getActiveMonitorFromConfigFile (
+		const ConfigurationFile& configFile,
+		const DisplayMonitorRegistry& displayMonitors
+	);
+	/**
+	 * Get the Active Display Monitor from the Terraria Configuration File at the Specified Path.
+	 * 
+	 * If the Terraria Configuration File has not changed since it was last read, the Active Display Monitor
+	 * is taken from the `ConfigurationMetadataCache` without reading the file. Otherwise, the file is read
+	 * using a `ConfigurationFile`, which also updates the `ConfigurationMetadataCache`.
+	 * 
+	 * @param filePath          The path to the Terraria Configuration File.
+	 * 
+	 * @param displayMonitors   The `DisplayMonitorRegistry` containing the Connected Display Monitors to 
+	 *                          compare to the Active Display Monitor in the Terraria Configuration File.
+	 * 
+	 * @returns                 The same result as `getActiveMonitorFromConfigFile()` for a `ConfigurationFile`
+	 *                          of the Terraria Configuration File.
+	 */
+	std::optional<DisplayMonitorRegistry::monitor_handle_t> getActiveMonitorFromConfigFile (
+		const std::wstring& filePath,
+		const DisplayMonitorRegistry& displayMonitors
+	);
+
+	/**
+	 * Plan the patches needed to set the Active Display Monitor in the Specified Terraria Configuration File,
+	 * without modifying the `configFile` or the Terraria Configuration File itself.
+	 * 
+	 * The patches only depend on the byte offsets recorded by the `configFile`, so they can be applied
+	 * using `applyConfigFilePatches()` to the same contents at any later time without scanning them again.
+	 * 
+	 * @param configFile            The `ConfigurationFile` for the Terraria Configuration File, which must be open.
+	 * 
+	 * @param newSelectedMonitor    The `DisplayMonitor` corresponding to the Connected Display Monitor to
+	 *                              be set as the new Active Display Monitor.
+	 * 
+	 * @param oChangedValues        The `ChangedValuesMap` updated with the Configuration Properties modified by the patches.
+	 * 
+	 * @param resolution            The Display Resolution written to the `DisplayWidth` and `DisplayHeight`
+	 *                              Configuration Properties. Defaults to the Current Display Resolution of the `newSelectedMonitor`.
+	 * 
+	 * @returns                     A `ConfigFilePatchList` containing the patches.
+	 */
+	ConfigFilePatchList planActiveMonitorPatches (
+		const ConfigurationFile& configFile,
+		const DisplayMonitor& newSelectedMonitor,
+		_Out_ ChangedValuesMap& oChangedValues,
+		const std::optional<DisplayMonitor::DisplayResolution>& resolution = std::nullopt
+	);
+
+	/**
+	 * Apply a set of patches to the contents of a Terraria Configuration File.
+	 * 
+	 * @param contents  The contents of the Terraria Configuration File the `patches` were planned for.
+	 * 
+	 * @param patches   The `ConfigFilePatchList` containing the patches, such as one returned by `planActiveMonitorPatches()`.
+	 * 
+	 * @returns         The patched contents of the Terraria Configuration File.
+	 */
+	std::string applyConfigFilePatches ( std::string_view contents, const ConfigFilePatchList& patches );
+
+	/**
+	 * Merge a set of newly Modified Configuration Properties into a `ChangedValuesMap`.
+	 *
+	 * Configuration Properties changed back to the value they had in the `oChangedValues`
+	 * are removed from it, as the Terraria Configuration File no longer differs from its original contents.
+	 *
+	 * @param oChangedValues    The `ChangedValuesMap` being updated.
+	 *
+	 * @param newChanges        The `ChangedValuesMap` containing the newly Modified Configuration Properties.
+	 */
+	void mergeChangedValues ( _Out_ ChangedValuesMap& oChangedValues, const ChangedValuesMap& newChanges );
+
+	/**
+	 * Set the Active Display Monitor in the Specified Terraria Configuration File.
+	 * 
+	 * The updated contents are assembled directly from the `Display` Configuration Properties
+	 * already recorded by the `configFile` using `planActiveMonitorPatches()`, copying everything
+	 * in between without modification, and then become the new contents of the `configFile`.
+	 * 
+	 * If the Terraria Configuration File has been replaced since the `configFile` was read (see `ConfigurationFile::isCurrent()`),
+	 * it is read again first, so that the changes are always made to the current contents of the file.
+	 * 
+	 * When performing a Dry Run, the Terraria Configuration File is not written to, so the changes
+	 * can be printed by comparing it to the `configFile` using `writeConfigFileDiff()`.
+	 * 
+	 * @param configFile            The `ConfigurationFile` for the Terraria Configuration File.
+	 * 
+	 * @param newSelectedMonitor    The `DisplayMonitor` corresponding to the Connected Display Monitor to
+	 *                              be set as the new Active Display Monitor.
+	 * 
+	 * @param oChangedValues        The `ChangedValuesMap` updated with the Modified Configuration Properties.
+	 * 
+	 * @param resolution            The Display Resolution written to the `DisplayWidth` and `DisplayHeight`
+	 *                              Configuration Properties, such as one returned by `DisplayModeCatalog::getSupportedResolutions()`.
+	 *                              Defaults to the Current Display Resolution of the `newSelectedMonitor`.
+	 * 
+	 * @returns                     `true` on success and `false` on failure.
+	 */
+	bool setActiveMonitorInConfigFile (
+		ConfigurationFile& configFile,
+		const DisplayMonitor& newSelectedMonitor,
+		_Out_ ChangedValuesMap& oChangedValues,
+		const std::optional<DisplayMonitor::DisplayResolution>& resolution = std::nullopt
+	);
+
+	/**
+	 * Write the differences between two versions of a Terraria Configuration File as a Unified Diff.
+	 * 
+	 * Only the changed lines and the specified number of unchanged lines surrounding them are written,
+	 * one line at a time, as the contents are compared. Nothing is copied from either version,
+	 * so the amount of memory used does not depend on the size of the Terraria Configuration File.
+	 * 
+	 * The lines of each version are compared in order, which produces the smallest possible Unified Diff
+	 * when lines are only replaced, as they are by `setActiveMonitorInConfigFile()`. Line Terminators
+	 * are not compared or written, so changes between `\n` and `\r\n` are ignored.
+	 * 
+	 * @param oldContents           The raw contents of the original version of the Terraria Configuration File.
+	 * 
+	 * @param newContents           The raw contents of the updated version of the Terraria Configuration File.
+	 * 
+	 * @param contextLines          The number of unchanged lines written before and after each change.
+	 *                              Changes separated by no more than twice as many unchanged lines share a Hunk.
+	 * 
+	 * @param oldLabel              The label written to the `---` header line, such as the path to the file.
+	 * 
+	 * @param newLabel              The label written to the `+++` header line.
+	 * 
+	 * @param onLine                The Callback Function invoked for each line of the Unified Diff.
+	 *                              The header lines are only written if there are any differences.
+	 * 
+	 * @returns                     The number of Hunks that were written, which is `0` if both versions are the same.
+	 */
+	size_t writeConfigFileDiff (
+		std::string_view oldContents,
+		std::string_view newContents,
+		size_t contextLines,
+		std::wstring_view oldLabel,
+		std::wstring_view newLabel,
+		const DiffLineCallback& onLine
+	);
+
+}
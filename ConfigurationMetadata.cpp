@@ -0,0 +1,300 @@
+/*
+* ConfigurationMetadata.cpp
+*
+* Source File defining the `ConfigurationMetadataCache` class, which remembers the `Display`
+* Configuration Properties found in each Terraria Configuration File along with the identity
+* of the file they were found in, so that unchanged files never need to be scanned again.
+*/
+
+
+#include "ConfigurationMetadata.h"
+
+#include <mutex>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Variables */
+
+    // Serializes access to the in-memory Configuration Metadata and the Configuration Metadata File.
+    static std::mutex metadataMutex = {};
+    // The in-memory Configuration Metadata, once it has been loaded from the Configuration Metadata File.
+    static std::optional<ConfigurationMetadataCache::MetadataEntryMap> metadataEntries = {};
+
+
+    /* Internal Helper Functions */
+
+    /**
+     * Get the key used for a Terraria Configuration File within a `MetadataEntryMap`.
+     *
+     * @param filePath  The path to the Terraria Configuration File.
+     *
+     * @returns         The absolute path to the Terraria Configuration File.
+     */
+    static std::wstring getEntryKey ( const std::wstring& filePath ) {
+
+        std::error_code errorCode = {};     // Receives any errors raised while resolving the absolute path.
+        std::filesystem::path absolutePath = std::filesystem::absolute(filePath, errorCode);
+
+        return ( errorCode ? filePath : absolutePath.wstring() );
+
+    }
+
+    /**
+     * Get the in-memory Configuration Metadata, loading it from the Configuration Metadata File first if necessary.
+     *
+     * The `metadataMutex` must be held by the caller.
+     *
+     * @returns     The in-memory Configuration Metadata.
+     */
+    static ConfigurationMetadataCache::MetadataEntryMap& getMetadataEntries () {
+
+        if (!metadataEntries)
+            metadataEntries = ConfigurationMetadataCache::fetchFromFile();
+
+        return *metadataEntries;
+
+    }
+
+
+    /* ConfigurationMetadataCache */
+    // Class Constants
+
+    const std::wstring ConfigurationMetadataCache::METADATA_FILE_NAME = L"config_metadata";
+    const std::filesystem::path ConfigurationMetadataCache::METADATA_FILE_PATH = { PROGRAM_DATA_PATH / METADATA_FILE_NAME };
+    const std::string_view ConfigurationMetadataCache::METADATA_FILE_SIGNATURE = { "TMCM\x01", 5ULL };
+
+    // Static Methods
+
+    std::optional<FileIdentity> ConfigurationMetadataCache::getFileIdentity ( HANDLE fileHandle ) {
+
+        BY_HANDLE_FILE_INFORMATION fileInfo = {};   // Receives the information about the file.
+
+        if ( fileHandle == INVALID_HANDLE_VALUE || !GetFileInformationByHandle(fileHandle, &fileInfo) )
+            return std::nullopt;
+
+        return FileIdentity{
+            .volumeSerialNumber = (uint32_t) fileInfo.dwVolumeSerialNumber,
+            .fileIndex = ( ((uint64_t) fileInfo.nFileIndexHigh << 32) | fileInfo.nFileIndexLow ),
+            .fileSize = ( ((uint64_t) fileInfo.nFileSizeHigh << 32) | fileInfo.nFileSizeLow ),
+            .lastWriteTime = ( ((uint64_t) fileInfo.ftLastWriteTime.dwHighDateTime << 32) | fileInfo.ftLastWriteTime.dwLowDateTime )
+        };
+
+    }
+    std::optional<FileIdentity> ConfigurationMetadataCache::getFileIdentity ( const std::wstring& filePath ) {
+
+        // A handle to the file, which is only able to read its attributes.
+        HANDLE fileHandle = CreateFileW(
+            filePath.c_str(),
+            FILE_READ_ATTRIBUTES,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            NULL,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            NULL
+        );
+        // The File Identity of the file.
+        std::optional<FileIdentity> identity = getFileIdentity(fileHandle);
+
+        if (fileHandle != INVALID_HANDLE_VALUE)
+            CloseHandle(fileHandle);
+
+        return identity;
+
+    }
+
+    std::optional<ConfigurationMetadataCache::MetadataEntry> ConfigurationMetadataCache::findEntry (
+        const std::wstring& filePath,
+        const FileIdentity& identity
+    ) {
+
+        std::lock_guard<std::mutex> lock(metadataMutex);
+        MetadataEntryMap& entries = getMetadataEntries();   // The in-memory Configuration Metadata.
+        // The entry for the Terraria Configuration File, if it has been cached.
+        MetadataEntryMap::const_iterator entryItr = entries.find( getEntryKey(filePath) );
+
+        if ( entryItr == entries.end() || entryItr->second.identity != identity )
+            return std::nullopt;
+
+        return entryItr->second;
+
+    }
+    void ConfigurationMetadataCache::recordEntry ( const std::wstring& filePath, const FileIdentity& identity, const ConfigurationFile& configFile ) {
+
+        // The metadata of the Terraria Configuration File.
+        MetadataEntry entry = {
+            .identity = identity,
+            .displayProperties = {},
+            .activeDisplayId = configFile.getActiveDisplayId()
+        };
+
+        entry.displayProperties.reserve( configFile.getDisplayProperties().size() );
+
+        for ( const ConfigurationFile::DisplayProperty& property : configFile.getDisplayProperties() ) {
+            entry.displayProperties.push_back({
+                .offsets = property,
+                .name = std::string( configFile.getPropertyName(property) ),
+                .value = std::string( configFile.getPropertyValue(property) )
+            });
+        }
+
+        std::lock_guard<std::mutex> lock(metadataMutex);
+        MetadataEntryMap& entries = getMetadataEntries();   // The in-memory Configuration Metadata.
+        // The existing entry for the Terraria Configuration File, which is created if it has not been cached yet.
+        MetadataEntry& cachedEntry = entries[ getEntryKey(filePath) ];
+
+        // The Configuration Metadata File is only written to when the entry actually changes.
+        if ( cachedEntry.identity == entry.identity && cachedEntry.displayProperties.size() == entry.displayProperties.size() )
+            return;
+
+        cachedEntry = std::move(entry);
+        saveToFile(entries);
+
+    }
+    bool ConfigurationMetadataCache::matchesContents ( const MetadataEntry& entry, std::string_view contents ) {
+
+        if ( entry.identity.fileSize != contents.size() )
+            return false;
+
+        for ( const CachedDisplayProperty& property : entry.displayProperties ) {
+            const ConfigurationFile::DisplayProperty& offsets = property.offsets;   // The recorded offsets of the Configuration Property.
+
+            // The recorded offsets must be in order, and must all fall within the `contents`.
+            if (
+                   offsets.nameStartPos <= offsets.lineStartPos
+                || offsets.nameLength != property.name.size()
+                || offsets.valueLength != property.value.size()
+                || offsets.valueStartPos < offsets.nameStartPos + offsets.nameLength
+                || offsets.lineEndPos < offsets.valueStartPos + offsets.valueLength
+                || offsets.nextLineStartPos < offsets.lineEndPos
+                || offsets.nextLineStartPos > contents.size()
+            ) {
+                return false;
+            }
+
+            if (
+                   contents[offsets.nameStartPos - 1ULL] != '"'
+                || contents.substr(offsets.nameStartPos, offsets.nameLength) != property.name
+                || contents.substr(offsets.valueStartPos, offsets.valueLength) != property.value
+            ) {
+                return false;
+            }
+        }
+
+        return true;
+
+    }
+
+    // Serialization & Persistence to File
+
+    ConfigurationMetadataCache::MetadataEntryMap ConfigurationMetadataCache::fetchFromFile () {
+
+        MetadataEntryMap entries = {};      // The cached metadata.
+
+        // Don't read the Configuration Metadata File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return entries;
+
+        // The Configuration Metadata File, mapped into memory so that it is read all at once.
+        UTILS_NAMESPACE::MemoryMappedFile file = { METADATA_FILE_PATH.wstring() };
+        // Reads each of the fields of the Configuration Metadata File in turn.
+        UTILS_NAMESPACE::BinaryReader reader = { file.getContents(), METADATA_FILE_SIGNATURE.size(), false };
+
+        if ( !reader.contents.starts_with(METADATA_FILE_SIGNATURE) )
+            return entries;
+
+        while ( reader.pos < reader.contents.size() ) {
+            // The absolute path to the Terraria Configuration File.
+            std::wstring filePath = UTILS_NAMESPACE::utf8ToWideString( UTILS_NAMESPACE::readBytes(reader) );
+            MetadataEntry entry = {};   // The `MetadataEntry` being read.
+
+            entry.identity.volumeSerialNumber = (uint32_t) UTILS_NAMESPACE::readVarint(reader);
+            entry.identity.fileIndex = UTILS_NAMESPACE::readVarint(reader);
+            entry.identity.fileSize = UTILS_NAMESPACE::readVarint(reader);
+            entry.identity.lastWriteTime = UTILS_NAMESPACE::readVarint(reader);
+
+            if ( UTILS_NAMESPACE::readVarint(reader) != 0ULL )
+                entry.activeDisplayId = UTILS_NAMESPACE::utf8ToWideString( UTILS_NAMESPACE::readBytes(reader) );
+
+            for ( uint64_t propertyCount = UTILS_NAMESPACE::readVarint(reader); propertyCount > 0ULL && !reader.failed; propertyCount-- ) {
+                CachedDisplayProperty& property = entry.displayProperties.emplace_back();  // The Configuration Property being read.
+
+                property.offsets.lineStartPos = (size_t) UTILS_NAMESPACE::readVarint(reader);
+                property.offsets.lineEndPos = (size_t) UTILS_NAMESPACE::readVarint(reader);
+                property.offsets.nextLineStartPos = (size_t) UTILS_NAMESPACE::readVarint(reader);
+                property.offsets.nameStartPos = (size_t) UTILS_NAMESPACE::readVarint(reader);
+                property.offsets.nameLength = (size_t) UTILS_NAMESPACE::readVarint(reader);
+                property.offsets.valueStartPos = (size_t) UTILS_NAMESPACE::readVarint(reader);
+                property.offsets.valueLength = (size_t) UTILS_NAMESPACE::readVarint(reader);
+                property.name = UTILS_NAMESPACE::readBytes(reader);
+                property.value = UTILS_NAMESPACE::readBytes(reader);
+            }
+
+            // Discard the first truncated `MetadataEntry`, along with everything following it.
+            if (reader.failed)
+                break;
+
+            entries.insert_or_assign( std::move(filePath), std::move(entry) );
+        }
+
+        return entries;
+
+    }
+
+    bool ConfigurationMetadataCache::saveToFile ( const MetadataEntryMap& entries ) {
+
+        // Don't modify the Configuration Metadata File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return true;
+
+        // The contents of the Configuration Metadata File.
+        std::string contents( METADATA_FILE_SIGNATURE );
+
+        for ( const auto& [filePath, entry] : entries ) {
+            UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(filePath) );
+            UTILS_NAMESPACE::writeVarint(contents, entry.identity.volumeSerialNumber);
+            UTILS_NAMESPACE::writeVarint(contents, entry.identity.fileIndex);
+            UTILS_NAMESPACE::writeVarint(contents, entry.identity.fileSize);
+            UTILS_NAMESPACE::writeVarint(contents, entry.identity.lastWriteTime);
+            UTILS_NAMESPACE::writeVarint( contents, entry.activeDisplayId ? 1ULL : 0ULL );
+
+            if (entry.activeDisplayId)
+                UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(*entry.activeDisplayId) );
+
+            UTILS_NAMESPACE::writeVarint(contents, entry.displayProperties.size());
+
+            for ( const CachedDisplayProperty& property : entry.displayProperties ) {
+                UTILS_NAMESPACE::writeVarint(contents, property.offsets.lineStartPos);
+                UTILS_NAMESPACE::writeVarint(contents, property.offsets.lineEndPos);
+                UTILS_NAMESPACE::writeVarint(contents, property.offsets.nextLineStartPos);
+                UTILS_NAMESPACE::writeVarint(contents, property.offsets.nameStartPos);
+                UTILS_NAMESPACE::writeVarint(contents, property.offsets.nameLength);
+                UTILS_NAMESPACE::writeVarint(contents, property.offsets.valueStartPos);
+                UTILS_NAMESPACE::writeVarint(contents, property.offsets.valueLength);
+                UTILS_NAMESPACE::writeBytes(contents, property.name);
+                UTILS_NAMESPACE::writeBytes(contents, property.value);
+            }
+        }
+
+        if ( !ensureProgramDataDirectoryExists(nullptr) )
+            return false;
+
+        return UTILS_NAMESPACE::writeFileAtomically(METADATA_FILE_PATH, contents);
+
+    }
+
+    bool ConfigurationMetadataCache::deleteSavedData () {
+
+        std::lock_guard<std::mutex> lock(metadataMutex);
+
+        metadataEntries.reset();
+
+        // Don't modify the Configuration Metadata File in Stateless Mode.
+        if ( programSettings.statelessMode || !std::filesystem::exists(METADATA_FILE_PATH) )
+            return true;
+
+        return std::filesystem::remove(METADATA_FILE_PATH);
+
+    }
+
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+
+/*
+* ConfigurationMetadata.h
+*
+* Header File defining the `ConfigurationMetadataCache` class, which remembers the `Display`
+* Configuration Properties found in each Terraria Configuration File along with the identity
+* of the file they were found in, so that unchanged files never need to be scanned again.
+*/
+
+
+#include "ConfigurationFile.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/**
+	 * A class providing a persistent cache of the metadata of each Terraria Configuration File.
+	 *
+	 * Each entry records the *File Identity* of a Terraria Configuration File (i.e., the Volume Serial Number,
+	 * File Index, size, and Last Write Time of the file), which is retrieved from an open handle to the file
+	 * using a single call to `GetFileInformationByHandle()`, along with the byte offsets and raw values of each
+	 * of the `Display` Configuration Properties it contained at the time. As long as the File Identity has not changed,
+	 * the offsets can be used as-is instead of scanning the contents of the file, and the Active Display Monitor
+	 * can be determined without even mapping the file into memory.
+	 *
+	 * Writing a Terraria Configuration File, whether by the program or by Terraria itself, always changes
+	 * its File Identity, so stale entries are simply ignored and replaced the next time the file is read.
+	 * Entries are also checked against the contents of the file before their offsets are used,
+	 * so a damaged Configuration Metadata File can never cause a Terraria Configuration File to be misread.
+	 *
+	 * The Configuration Metadata File is removed along with the rest of the Program Data by `--clear-program-data`,
+	 * and is never read from or written to in Stateless Mode, in which case entries are only cached in memory.
+	 */
+	class ConfigurationMetadataCache {
+
+		/* Type Definitions */
+		public:
+			/**
+			 * A structure type representing a `Display` Configuration Property recorded by a `MetadataEntry`.
+			 */
+			typedef struct CachedDisplayPropertyStruct {
+
+				ConfigurationFile::DisplayProperty offsets = {};	// The byte offsets of the Configuration Property.
+				std::string name = {};								// The raw name of the Configuration Property.
+				std::string value = {};								// The raw value of the Configuration Property, excluding any surrounding quotes.
+
+			} CachedDisplayProperty;
+
+			/**
+			 * A structure type representing the cached metadata of a single Terraria Configuration File.
+			 */
+			typedef struct MetadataEntryStruct {
+
+				FileIdentity identity = {};								// The File Identity of the Terraria Configuration File when it was read.
+				std::vector<CachedDisplayProperty> displayProperties = {};	// The `Display` Configuration Properties, in the order they appear in the file.
+				std::optional<std::wstring> activeDisplayId = {};		// The Display ID of the Active Display Monitor, as returned by `ConfigurationFile::getActiveDisplayId()`.
+
+			} MetadataEntry;
+
+			// A Map of the absolute paths to Terraria Configuration Files to their cached metadata.
+			typedef std::unordered_map<std::wstring, MetadataEntry> MetadataEntryMap;
+
+
+		/* Class Constants */
+		protected:
+			static const std::wstring METADATA_FILE_NAME;			// The name of the file used to store the Configuration Metadata.
+			static const std::filesystem::path METADATA_FILE_PATH;	// The path to the file used to store the Configuration Metadata.
+			/**
+			 * The signature at the start of the Configuration Metadata File, followed by each `MetadataEntry` in turn.
+			 *
+			 * Every string is stored as UTF-8 preceded by its length in bytes, and every integer, including
+			 * those lengths, is stored as an unsigned Variable-Length Integer of 7 bits per byte.
+			 */
+			static const std::string_view METADATA_FILE_SIGNATURE;
+
+
+		/* Static Methods */
+		public:
+			/**
+			 * Get the File Identity of an open file.
+			 *
+			 * @param fileHandle	A handle to the file, such as one returned by `MemoryMappedFile::getFileHandle()`.
+			 *
+			 * @returns				An `std::optional` containing the File Identity, which is empty if
+			 * 						the `fileHandle` is invalid or the file information could not be retrieved.
+			 */
+			static std::optional<FileIdentity> getFileIdentity ( HANDLE fileHandle );
+			/**
+			 * Get the File Identity of the specified file.
+			 *
+			 * The file is only opened for reading its attributes, so it can be checked even while
+			 * another process has it open for writing.
+			 *
+			 * @param filePath	The path to the file.
+			 *
+			 * @returns			An `std::optional` containing the File Identity, which is empty if
+			 * 					the file does not exist or could not be opened.
+			 */
+			static std::optional<FileIdentity> getFileIdentity ( const std::wstring& filePath );
+
+			/**
+			 * Find the cached metadata of a Terraria Configuration File.
+			 *
+			 * @param filePath	The path to the Terraria Configuration File.
+			 * @param identity	The current File Identity of the Terraria Configuration File.
+			 *
+			 * @returns			An `std::optional` containing the `MetadataEntry`, which is empty if the
+			 * 					Terraria Configuration File has not been cached or has changed since it was.
+			 */
+			static std::optional<MetadataEntry> findEntry ( const std::wstring& filePath, const FileIdentity& identity );
+			/**
+			 * Record the metadata of a Terraria Configuration File, saving the Configuration Metadata File if it changed.
+			 *
+			 * @param filePath		The path to the Terraria Configuration File.
+			 * @param identity		The File Identity of the Terraria Configuration File the `configFile` was read from.
+			 * @param configFile	The `ConfigurationFile` containing the current contents of the Terraria Configuration File.
+			 */
+			static void recordEntry ( const std::wstring& filePath, const FileIdentity& identity, const ConfigurationFile& configFile );
+			/**
+			 * Determine if the offsets recorded by a `MetadataEntry` can be used with the contents of a Terraria Configuration File.
+			 *
+			 * @param entry		The `MetadataEntry` being checked.
+			 * @param contents	The raw contents of the Terraria Configuration File.
+			 *
+			 * @returns			`true` if every `Display` Configuration Property of the `entry` is found
+			 * 					at its recorded offsets within the `contents`, otherwise `false`.
+			 */
+			static bool matchesContents ( const MetadataEntry& entry, std::string_view contents );
+
+
+		/* Serialization & Persistence to File */
+		public:
+			/**
+			 * Fetch the cached metadata from the Configuration Metadata File.
+			 *
+			 * The Configuration Metadata is stored in a file located at `METADATA_FILE_PATH`,
+			 * and is never read from in Stateless Mode.
+			 *
+			 * @returns		A `MetadataEntryMap` containing the cached metadata, which is empty if the
+			 * 				Configuration Metadata File does not exist or could not be parsed.
+			 */
+			static MetadataEntryMap fetchFromFile ();
+
+			/**
+			 * Save the specified metadata to the Configuration Metadata File.
+			 *
+			 * The Configuration Metadata is stored in a file located at `METADATA_FILE_PATH`,
+			 * and is never written to in Stateless Mode.
+			 *
+			 * @param entries	The metadata being saved.
+			 *
+			 * @returns			`true` on success and `false` on failure.
+			 */
+			static bool saveToFile ( const MetadataEntryMap& entries );
+			/**
+			 * Delete the Configuration Metadata File, along with any metadata cached in memory.
+			 *
+			 * @returns		`true` if the Configuration Metadata File was successfully
+			 * 				deleted or does not currently exist, otherwise `false`.
+			 */
+			static bool deleteSavedData ();
+
+	};
+
+}
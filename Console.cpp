@@ -15,7 +15,9 @@
 
 
 #include "Console.h"
+#include "Tracing.h"
 #include <algorithm> // min(), max()
+#include <deque>
 
 
 namespace PROGRAM_NAMESPACE {
@@ -66,7 +68,84 @@ namespace PROGRAM_NAMESPACE {
 		return std::optional( std::towlower(*hotkey) );
 
 	}
+	/**
+	 * An internal helper function that gets the number of columns the specified
+	 * Wide-Character String occupies when printed to the console.
+	 * 
+	 * @param str	The Wide-Character String being measured.
+	 * 
+	 * @returns		The length of the `str`, excluding any Virtual Terminal Sequences it contains.
+	 */
+	static size_t getPrintedWidth ( const std::wstring& str ) {
+
+		size_t printedWidth = 0ULL;		// The number of columns occupied by the `str`.
+
+		for ( size_t strPos = 0ULL; strPos < str.size(); strPos++ ) {
+			// The length of the Virtual Terminal Sequence at the current position, if any.
+			size_t sequenceLength = UTILS_NAMESPACE::VirtualTerminalSequenceScanner::getSequenceLength(&str[strPos]);
+
+			if (sequenceLength > 0ULL)
+				strPos += (sequenceLength - 1ULL);
+			else
+				printedWidth++;
+		}
+
+		return printedWidth;
+
+	}
+
 
+	/**
+	 * An internal helper function that ensures a span of an arena has room for the specified number of elements,
+	 * growing the span in place if it is located at the end of the arena, or relocating it to the end of the arena otherwise.
+	 * 
+	 * @tparam T			The type of the elements of the arena.
+	 * 
+	 * @param arena			The arena containing the span.
+	 * @param spanStart		The index of the first element of the span in the `arena`, which is updated if the span is relocated.
+	 * @param spanCount		The number of elements currently used by the span.
+	 * @param spanCapacity	The number of elements currently reserved for the span, which is updated if the span grows.
+	 * @param required		The number of elements the span must be able to hold.
+	 * @param minCapacity	The minimum number of elements reserved for the span when it grows.
+	 * 
+	 * @returns				The number of elements of the `arena` left behind if the span was relocated, otherwise `0`.
+	 */
+	template <typename T>
+	static size_t reserveArenaSpan (
+		std::vector<T>& arena,
+		uint32_t& spanStart,
+		uint32_t spanCount,
+		uint32_t& spanCapacity,
+		size_t required,
+		size_t minCapacity
+	) {
+
+		size_t newCapacity = 0ULL;	// The number of elements reserved for the span after it grows.
+		size_t unusedCount = 0ULL;	// The number of elements left behind by the span if it is relocated.
+
+		if (required <= spanCapacity)
+			return 0ULL;
+
+		newCapacity = std::max<size_t>({ required, (spanCapacity * 2ULL), minCapacity });
+
+		// The span can simply grow in place when nothing follows it in the `arena`.
+		if ( (spanStart + spanCapacity) == arena.size() ) {
+			arena.resize(spanStart + newCapacity);
+		}
+		else {
+			size_t newStart = arena.size();		// The index of the span after it has been relocated.
+
+			arena.resize(newStart + newCapacity);
+			std::copy_n(arena.begin() + spanStart, spanCount, arena.begin() + newStart);
+
+			unusedCount = spanCapacity;
+			spanStart = (uint32_t) newStart;
+		}
+
+		spanCapacity = (uint32_t) newCapacity;
+		return unusedCount;
+
+	}
 
 	/* Utils::AConsoleBuffer */
 	namespace UTILS_NAMESPACE {
@@ -86,11 +165,213 @@ namespace PROGRAM_NAMESPACE {
 	}
 
 
+	/* Console::OutputBuffer::BufferContents */
+	// Instance Methods
+
+	size_t Console::OutputBuffer::BufferContents::size () const {
+
+		return this->rows.size();
+
+	}
+	bool Console::OutputBuffer::BufferContents::empty () const {
+
+		return this->rows.empty();
+
+	}
+	void Console::OutputBuffer::BufferContents::clear () {
+
+		this->chars.clear();
+		this->cursorOffsets.clear();
+		this->rows.clear();
+		this->unusedChars = 0ULL;
+		this->unusedCursorOffsets = 0ULL;
+
+	}
+	void Console::OutputBuffer::BufferContents::ensureRows ( size_t rowCount ) {
+
+		if ( this->rows.size() < rowCount )
+			this->rows.resize(rowCount);
+
+	}
+
+	std::wstring_view Console::OutputBuffer::BufferContents::getRow ( size_t rowNum ) const {
+
+		const RowSpan& row = this->rows[rowNum];	// The `RowSpan` of the row.
+
+		if (row.charCount == 0U)
+			return std::wstring_view();
+
+		return std::wstring_view( &this->chars[row.charStart], row.charCount );
+
+	}
+	size_t Console::OutputBuffer::BufferContents::getRowLength ( size_t rowNum ) const {
+
+		return this->rows[rowNum].charCount;
+
+	}
+	void Console::OutputBuffer::BufferContents::appendChar ( size_t rowNum, wchar_t wchar ) {
+
+		RowSpan& row = this->rows[rowNum];	// The `RowSpan` of the row.
+
+		this->reserveChars(row, row.charCount + 1ULL);
+		this->chars[row.charStart + row.charCount] = wchar;
+		row.charCount++;
+
+	}
+	void Console::OutputBuffer::BufferContents::setChar ( size_t rowNum, size_t charPos, wchar_t wchar ) {
+
+		RowSpan& row = this->rows[rowNum];	// The `RowSpan` of the row.
+
+		if (charPos < row.charCount)
+			this->chars[row.charStart + charPos] = wchar;
+		else if (charPos == row.charCount)
+			this->appendChar(rowNum, wchar);
+
+	}
+	void Console::OutputBuffer::BufferContents::eraseChars ( size_t rowNum, size_t charPos, size_t count ) {
+
+		RowSpan& row = this->rows[rowNum];		// The `RowSpan` of the row.
+		auto rowBegin = this->chars.begin() + row.charStart;	// An iterator to the first Wide Character of the row.
+
+		if (charPos >= row.charCount)
+			return;
+
+		count = std::min<size_t>(count, row.charCount - charPos);
+
+		std::copy(rowBegin + charPos + count, rowBegin + row.charCount, rowBegin + charPos);
+		row.charCount -= (offset_t) count;
+
+	}
+
+	size_t Console::OutputBuffer::BufferContents::getCursorOffsetCount ( size_t rowNum ) const {
+
+		return this->rows[rowNum].cursorCount;
+
+	}
+	size_t Console::OutputBuffer::BufferContents::getCursorOffset ( size_t rowNum, size_t cursorX ) const {
+
+		return this->cursorOffsets[this->rows[rowNum].cursorStart + cursorX];
+
+	}
+	void Console::OutputBuffer::BufferContents::appendCursorOffset ( size_t rowNum, size_t offset ) {
+
+		RowSpan& row = this->rows[rowNum];	// The `RowSpan` of the row.
+
+		this->reserveCursorOffsets(row, row.cursorCount + 1ULL);
+		this->cursorOffsets[row.cursorStart + row.cursorCount] = (offset_t) offset;
+		row.cursorCount++;
+
+	}
+	void Console::OutputBuffer::BufferContents::shiftCursorOffsets ( size_t rowNum, size_t cursorX, size_t distance ) {
+
+		const RowSpan& row = this->rows[rowNum];	// The `RowSpan` of the row.
+		
+		if (cursorX >= row.cursorCount)
+			return;
+
+		// The Cursor Offsets of the row are contiguous, allowing the shift to be vectorized.
+		std::for_each(
+			this->cursorOffsets.begin() + row.cursorStart + cursorX,
+			this->cursorOffsets.begin() + row.cursorStart + row.cursorCount,
+			[distance]( offset_t& offset ) { offset -= (offset_t) distance; }
+		);
+
+	}
+
+	std::wstring Console::OutputBuffer::BufferContents::join ( wchar_t separator ) const {
+
+		std::wstring joinedRows = {};	// The joined rows.
+		size_t joinedLength = 0ULL;		// The total length of the joined rows.
+
+		for (const RowSpan& row : this->rows)
+			joinedLength += (row.charCount + 1ULL);
+
+		joinedRows.reserve(joinedLength);
+
+		for ( size_t i = 0ULL; i < this->rows.size(); i++ ) {
+			if (i > 0ULL)
+				joinedRows.push_back(separator);
+
+			joinedRows.append(this->getRow(i));
+		}
+
+		return joinedRows;
+
+	}
+
+	// Helper Methods
+
+	void Console::OutputBuffer::BufferContents::reserveChars ( RowSpan& row, size_t required ) {
+
+		this->unusedChars += reserveArenaSpan(
+			this->chars,
+			row.charStart,
+			row.charCount,
+			row.charCapacity,
+			required,
+			MIN_ROW_CAPACITY
+		);
+
+		if ( this->unusedChars > (this->chars.size() / 2ULL) )
+			this->compact();
+
+	}
+	void Console::OutputBuffer::BufferContents::reserveCursorOffsets ( RowSpan& row, size_t required ) {
+
+		this->unusedCursorOffsets += reserveArenaSpan(
+			this->cursorOffsets,
+			row.cursorStart,
+			row.cursorCount,
+			row.cursorCapacity,
+			required,
+			MIN_ROW_CAPACITY
+		);
+
+		if ( this->unusedCursorOffsets > (this->cursorOffsets.size() / 2ULL) )
+			this->compact();
+
+	}
+	void Console::OutputBuffer::BufferContents::compact () {
+
+		std::vector<wchar_t> compactChars = {};			// The compacted Character Arena.
+		std::vector<offset_t> compactCursorOffsets = {};	// The compacted Cursor Offset Arena.
+
+		compactChars.reserve(this->chars.size() - this->unusedChars);
+		compactCursorOffsets.reserve(this->cursorOffsets.size() - this->unusedCursorOffsets);
+
+		// Copy each row into the compacted arenas in order, retaining the capacity reserved for each row.
+		for (RowSpan& row : this->rows) {
+			size_t charStart = compactChars.size();				// The new index of the first Wide Character of the row.
+			size_t cursorStart = compactCursorOffsets.size();	// The new index of the first Cursor Offset of the row.
+
+			compactChars.insert(
+				compactChars.end(),
+				this->chars.begin() + row.charStart,
+				this->chars.begin() + row.charStart + row.charCapacity
+			);
+			compactCursorOffsets.insert(
+				compactCursorOffsets.end(),
+				this->cursorOffsets.begin() + row.cursorStart,
+				this->cursorOffsets.begin() + row.cursorStart + row.cursorCapacity
+			);
+
+			row.charStart = (offset_t) charStart;
+			row.cursorStart = (offset_t) cursorStart;
+		}
+
+		this->chars = std::move(compactChars);
+		this->cursorOffsets = std::move(compactCursorOffsets);
+		this->unusedChars = 0ULL;
+		this->unusedCursorOffsets = 0ULL;
+
+	}
+
+
 	/* Console::OutputBuffer */
 	// Class Constructors & Destructors
 
 	Console::OutputBuffer::OutputBuffer ( win_conbuf_t iBufferHandle )
-		: AConsoleBuffer(iBufferHandle), mainBufferData({ .handle = iBufferHandle }), altBufferData()
+		: AConsoleBuffer(iBufferHandle), mainBufferData({ .handle = iBufferHandle }), altBufferData(), frameData()
 	{
 	
 		// We set the Cursor Starting Position here to ensure that the
@@ -101,6 +382,12 @@ namespace PROGRAM_NAMESPACE {
 
 	Console::OutputBuffer::~OutputBuffer () {
 	
+		// Write any output left over from an uncommitted Output Frame.
+		if ( this->isFrameActive() ) {
+			this->flushFrame();
+			this->frameData.depth = 0U;
+		}
+
 		// Clear all Alternate Output Buffers and revert the
 		// console to the Original Output Buffer.
 		if ( !programSettings.useCustomBufferBehavior )
@@ -130,17 +417,23 @@ namespace PROGRAM_NAMESPACE {
 
 		if ( altBufferData.handle != NULL && altBufferData.handle != INVALID_HANDLE_VALUE ) {
 			if (programSettings.useCustomBufferBehavior) {
+				this->takeSnapshot( this->getCurrentBufferData() );
 				this->clear();
 
 				if ( !this->getCurrentBufferData().cursorIsVisible )
 					this->synchronizeCursorVisibility(true, false);
 			}
 			else {	
+				this->flushFrame();
 				SetConsoleActiveScreenBuffer(altBufferData.handle);
 			}
 
 			altBuffer = this->getCurrentBufferNum();
 			this->altBufferData.push(altBufferData);
+
+			// Any Output Frame in progress now continues in the Alternate Output Buffer.
+			if ( !programSettings.useCustomBufferBehavior && this->isFrameActive() )
+				this->flushFrame(true);
 		}
 
 		return altBuffer;
@@ -164,21 +457,24 @@ namespace PROGRAM_NAMESPACE {
 
 				auto& bufferData = this->getCurrentBufferData();
 				
-				for ( size_t i = 0; i < bufferData.contents.size(); i++ ) {
-					this->print(bufferData.contents[i], false);
-
-					if ( i < (bufferData.contents.size() - 1ULL) )
-						this->println(false);
-				}
+				// Restore the cells of the Previous Output Buffer in a single block operation if possible,
+				// and otherwise replay its contents with a single write.
+				if ( !this->restoreSnapshot(bufferData) )
+					this->print(bufferData.contents.join(L'\n'), false);
 				
 				if ( prevBufferCursorVisibility != bufferData.cursorIsVisible ) {
 					this->synchronizeCursorVisibility(bufferData.cursorIsVisible, false);
 				}
 			}
 			else {
+				this->flushFrame();
 				CloseHandle(this->altBufferData.top().handle);
 				this->altBufferData.pop();
 				SetConsoleActiveScreenBuffer(this->getBufferHandle());
+
+				// Any Output Frame in progress now continues in the Previous Output Buffer.
+				if ( this->isFrameActive() )
+					this->flushFrame(true);
 			}
 		}
 
@@ -186,10 +482,42 @@ namespace PROGRAM_NAMESPACE {
 
 	}
 
+	// Implemented Frame Management Instance Methods
+
+	Console::OutputBuffer& Console::OutputBuffer::beginFrame () {
+
+		if ( this->frameData.depth++ == 0U ) {
+			this->frameData.contents.clear();
+			this->flushFrame(true);
+		}
+
+		return *this;
+
+	}
+
+	Console::OutputBuffer& Console::OutputBuffer::commitFrame () {
+
+		if ( this->isFrameActive() && --this->frameData.depth == 0U )
+			this->flushFrame();
+
+		return *this;
+
+	}
+
+	bool Console::OutputBuffer::isFrameActive () const {
+
+		return (this->frameData.depth > 0U);
+
+	}
+
 	// Implemented Cursor Position Management Instance Methods
 
 	Console::OutputBuffer::WinConsoleCursorCoordinates Console::OutputBuffer::getCursorPos () const {
 	
+		// The Console Cursor is tracked locally while an Output Frame is in progress.
+		if ( this->isFrameActive() )
+			return this->frameData.cursorPos;
+
 		// A structure containing details about the Console Output Buffer returned by the Windows API.
 		CONSOLE_SCREEN_BUFFER_INFO currentConsoleBufferInfo = {};
 
@@ -206,6 +534,46 @@ namespace PROGRAM_NAMESPACE {
 
 	bool Console::OutputBuffer::setCursorPos ( const WinConsoleCursorCoordinates& cursorPos ) {
 	
+		if ( this->isFrameActive() ) {
+			// The visible viewport of the Current Output Frame.
+			const SMALL_RECT& window = this->frameData.window;
+
+			/**
+			 * A lambda function used to determine if a Console Cursor Position lies within the `window`.
+			 *
+			 * @param pos	The Console Cursor Position being checked.
+			 *
+			 * @returns		`true` if the `pos` is within the `window`, otherwise `false`.
+			 */
+			auto isWithinWindow = [&window] ( const WinConsoleCursorCoordinates& pos ) -> bool {
+
+				return ( pos.X >= window.Left && pos.X <= window.Right && pos.Y >= window.Top && pos.Y <= window.Bottom );
+
+			};
+
+			// The viewport has not scrolled as long as the Console Cursor has stayed within it, so the Console Cursor
+			// can be repositioned by the Output Frame itself, relative to the viewport and starting from `1`.
+			if ( isWithinWindow(this->frameData.cursorPos) && isWithinWindow(cursorPos) ) {
+				this->frameData.contents.append(getVirtualTerminalSequence(std::format(
+					L"[{:d};{:d}H",
+					(cursorPos.Y - window.Top) + 1,
+					(cursorPos.X - window.Left) + 1
+				)));
+				this->frameData.cursorPos = cursorPos;
+				return true;
+			}
+
+			// Otherwise, any output assembled by the Current Output Frame belongs to the previous Cursor Position.
+			this->flushFrame();
+
+			if ( SetConsoleCursorPosition(this->getBufferHandle(), cursorPos) != TRUE )
+				return false;
+
+			// Positioning the Console Cursor may have scrolled the viewport as well.
+			this->flushFrame(true);
+			return true;
+		}
+
 		return ( SetConsoleCursorPosition(this->getBufferHandle(), cursorPos) == TRUE );
 	
 	}
@@ -264,7 +632,6 @@ namespace PROGRAM_NAMESPACE {
 
 		if (clearBuffer) {
 			this->getCurrentBufferData().contents.clear();
-			this->getCurrentBufferData().contentsCursorData.clear();
 		}
 		if (resetCursorPos) {
 			this->setCursorPos(
@@ -281,21 +648,12 @@ namespace PROGRAM_NAMESPACE {
 	}
 
 	const Console::OutputBuffer& Console::OutputBuffer::print ( const wchar_t* str, bool addToBuffer ) const {
-		
-		/**
-		 * A Regular Expression Pattern used to attempt to automatically
-		 * detect and match Virtual Terminal Sequences.
-		 */
-		std::wregex TERMINAL_SEQUENCE_REGEX = std::wregex(
-			std::format(
-				L"^{:c}{:s}",
-				VIRTUAL_TERMINAL_SEQUENCE_ESCAPE,
-				L"(?:[\\w=>]|\\([0B]|(?:\\[(?:!p|(?:\\??\\d{0,4} ?[a-zA-Z])|(?:\\d{1,3};\\d{1,3}[fH])|(?:[34]8;[25];\\d{1,3};\\d{1,3};\\d{1,3})))|(?:\\]4;\\d{1,3};rgb;\\d{1,3};\\d{1,3};\\d{1,3}\x07))"
-			)
-		);
-		
+
+		ScopedTraceTimer traceTimer = { "OutputBuffer::print", "console" };
 		auto& bufferData = this->getCurrentBufferData();	// The `BufferData` for the Current Output Buffer.
+		bool isFrameActive = this->isFrameActive();			// Indicates if the `str` is being added to the Current Output Frame.
 		short newlineCount = 0;								// The number of newlines counted in the specified `str`.
+		short scrolledLines = 0;							// The number of lines the console was scrolled by printing the specified `str`.
 		DWORD strLength = 0UL;								// The counted length of the specified `str`.
 		size_t strPos = 0ULL;								// Our current position in the `str`.
 		wchar_t currentChar;								// The current Wide Character being processed.
@@ -308,7 +666,15 @@ namespace PROGRAM_NAMESPACE {
 			.dwSize = sizeof(CONSOLE_SCREEN_BUFFER_INFO)
 		};
 
-		GetConsoleScreenBufferInfo(bufferData.handle, &bufferInfo);
+		// While an Output Frame is in progress, the information about the Current Output Buffer
+		// is taken from when the Output Frame was started instead of from the Windows API.
+		if (isFrameActive) {
+			bufferInfo.dwSize = this->frameData.bufferSize;
+			bufferInfo.dwMaximumWindowSize.X = this->frameData.maxWindowWidth;
+		}
+		else {
+			GetConsoleScreenBufferInfo(bufferData.handle, &bufferInfo);
+		}
 
 		// A lambda function used to write the specified `str` to the Current Output Buffer.
 		auto writeToConsole = [this, &str, &strLength]() -> BOOL {
@@ -316,6 +682,9 @@ namespace PROGRAM_NAMESPACE {
 			if (strLength == 0)
 				return true;
 
+			TraceRecorder::incrementCounter(TraceRecorder::CONSOLE_WRITE_CALLS);
+			TraceRecorder::incrementCounter(TraceRecorder::CONSOLE_BYTES_WRITTEN, strLength * sizeof(wchar_t));
+
 			return WriteConsoleW(
 				this->getBufferHandle(),
 				str,
@@ -334,11 +703,12 @@ namespace PROGRAM_NAMESPACE {
 
 			// Attempt to match the Virtual Terminal Sequence and update the Output Buffer accordingly.
 			if (currentChar == VIRTUAL_TERMINAL_SEQUENCE_ESCAPE) {
-				std::wcmatch matches = {};
+				// The length of the Virtual Terminal Sequence beginning at the current Wide Character, if any.
+				size_t detectedSequenceLength = UTILS_NAMESPACE::VirtualTerminalSequenceScanner::getSequenceLength(&str[strPos]);
 
-				if ( std::regex_search(&str[strPos], matches, TERMINAL_SEQUENCE_REGEX) ) {
+				if (detectedSequenceLength > 0ULL) {
 					isDetectedTerminalSequence = true;
-					termSeqEndPos = (strPos + (size_t) matches.length() - 1ULL);
+					termSeqEndPos = (strPos + detectedSequenceLength - 1ULL);
 				}
 			}
 
@@ -346,101 +716,104 @@ namespace PROGRAM_NAMESPACE {
 				// The Vertical Cursor Position, relative to the Starting Cursor Position.
 				short cursorYPos = (currentCursorPos.Y - this->getCurrentBufferData(true).cursorStartPos.Y);
 
-				// Populate the `contents` and `contentsCursorData` arrays if necessary.
-				while ( (size_t) cursorYPos >= bufferData.contents.size() ) {
-					bufferData.contents.emplace_back();
-					bufferData.contentsCursorData.emplace_back();
-				}
-				
-				// The Output Buffer Contents Buffer for the Current Line.
-				auto& bufferDataContents = bufferData.contents[cursorYPos];
-				// The Output Buffer Contents Cursor Position Array for the Current Line. 
-				auto& bufferDataContentsCursorPos = bufferData.contentsCursorData[cursorYPos];
+				// The `BufferContents` for the Current Output Buffer.
+				auto& contents = bufferData.contents;
+				// The index of the row of the `contents` corresponding to the Current Line.
+				size_t rowNum = (size_t) cursorYPos;
+
+				// Populate the rows of the `contents` if necessary.
+				contents.ensureRows(rowNum + 1ULL);
 
 				if ( !atEndOfBuffer )
-					atEndOfBuffer = ( bufferDataContentsCursorPos.size() <= (currentCursorPos.X + 1ULL) );
+					atEndOfBuffer = ( contents.getCursorOffsetCount(rowNum) <= (currentCursorPos.X + 1ULL) );
 
-				// Populate the `bufferDataContents` and `bufferDataContentsCursorPos`
-				// arrays if necessary.
-				while ( (size_t) currentCursorPos.X > bufferDataContents.size() ) {
-					bufferDataContentsCursorPos.push_back(bufferDataContents.size());
-					bufferDataContents.push_back(L' ');
+				// Populate the characters and Cursor Offsets of the Current Line if necessary.
+				while ( (size_t) currentCursorPos.X > contents.getRowLength(rowNum) ) {
+					contents.appendCursorOffset(rowNum, contents.getRowLength(rowNum));
+					contents.appendChar(rowNum, L' ');
 				}
-				// Continue populating the `bufferDataContentsCursorPos` array if necessary.
-				while ( (size_t) currentCursorPos.X > bufferDataContentsCursorPos.size() ) {
-					bufferDataContentsCursorPos.push_back(
-						!bufferDataContentsCursorPos.empty()
-							? (bufferDataContentsCursorPos.back() + 1ULL)
+				// Continue populating the Cursor Offsets of the Current Line if necessary.
+				while ( (size_t) currentCursorPos.X > contents.getCursorOffsetCount(rowNum) ) {
+					size_t cursorOffsetCount = contents.getCursorOffsetCount(rowNum);	// The current number of Cursor Offsets.
+
+					contents.appendCursorOffset(
+						rowNum,
+						cursorOffsetCount > 0ULL
+							? (contents.getCursorOffset(rowNum, cursorOffsetCount - 1ULL) + 1ULL)
 							: (0ULL)
-						);
+					);
 				}
 
 				// If the Console Cursor is located at the end of the Output Buffer, 
-				// we can append the current Wide Character to the end of the character buffer.
+				// we can append the current Wide Character to the end of the Current Line.
 				if ( *atEndOfBuffer ) {
 					if ( !isDetectedTerminalSequence ) {
-						bufferDataContentsCursorPos.push_back(bufferDataContents.size());
+						contents.appendCursorOffset(rowNum, contents.getRowLength(rowNum));
 					}
 					if ( currentChar != L'\n' ) {
-						bufferDataContents.push_back(currentChar);
+						contents.appendChar(rowNum, currentChar);
 					}
 				}
-				// Otherwise, we can insert the current Wide Character into the character buffer
+				// Otherwise, we can insert the current Wide Character into the Current Line
 				// at the location corresponding to the Current Console Cursor Position.
 				else {
-					// The current Character Buffer Cursor Position, according to
-					// the `bufferDataContentsCursorPos` array.
-					auto& currentCharCursorPos = bufferDataContentsCursorPos[currentCursorPos.X];
 					// The index of the first Wide Character in the potential Virtual Terminal Sequence.
 					size_t startPos = (
 						currentCursorPos.X > 0ULL
-							? bufferDataContentsCursorPos[currentCursorPos.X - 1]
+							? contents.getCursorOffset(rowNum, currentCursorPos.X - 1)
 							: 0ULL
 					);
 					// The total length of the potential Virtual Terminal Sequence.
-					size_t sequenceLength = (currentCharCursorPos - startPos);
+					size_t sequenceLength = (contents.getCursorOffset(rowNum, currentCursorPos.X) - startPos);
+					// The number of Cursor Offsets in the Current Line.
+					size_t cursorOffsetCount = contents.getCursorOffsetCount(rowNum);
 
 					// Erase existing Virtual Terminal Sequences that are being overwritten.
 					if (sequenceLength > 1ULL) {
-						bufferDataContents.erase(startPos, sequenceLength);
-
-						for ( size_t j = startPos; j < bufferDataContentsCursorPos.size(); j++ ) {
-							bufferDataContentsCursorPos[j] -= sequenceLength;
-						}
+						contents.eraseChars(rowNum, startPos, sequenceLength);
+						contents.shiftCursorOffsets(rowNum, startPos, sequenceLength);
 					}
-					else if ( currentCursorPos.X == (bufferDataContentsCursorPos.size() - 1ULL) ) {
-						if ( bufferDataContents.size() > bufferDataContentsCursorPos.back() ) {
-							bufferDataContents.erase( bufferDataContentsCursorPos.back() + 1ULL );
+					else if ( currentCursorPos.X == (cursorOffsetCount - 1ULL) ) {
+						// The Cursor Offset of the last Wide Character of the Current Line.
+						size_t lastCursorOffset = contents.getCursorOffset(rowNum, cursorOffsetCount - 1ULL);
+
+						if ( contents.getRowLength(rowNum) > lastCursorOffset ) {
+							contents.eraseChars(rowNum, lastCursorOffset + 1ULL);
 						}
 					}
 
 					if (currentChar != L'\n') {
-						// Add the current Wide Character to the Current Output Buffer Contents Buffer.
-						bufferDataContents[currentCharCursorPos + termSeqLength] = currentChar;
+						// Add the current Wide Character to the Current Line.
+						contents.setChar(
+							rowNum,
+							contents.getCursorOffset(rowNum, currentCursorPos.X) + termSeqLength,
+							currentChar
+						);
 					}
 				}
+			}
 
-				if (currentChar != L'\n') {
-					if ( !isDetectedTerminalSequence ) {
-						currentCursorPos.X++;
-						termSeqLength = 0ULL;
+			// Advance the Console Cursor Position past the current Wide Character.
+			if (currentChar != L'\n') {
+				if ( !isDetectedTerminalSequence ) {
+					currentCursorPos.X++;
+					termSeqLength = 0ULL;
 
-						if (currentCursorPos.X == bufferInfo.dwMaximumWindowSize.X) {
-							currentCursorPos.X = 0;
-							currentCursorPos.Y++;
-						}
-					}
-					else {
-						termSeqLength++;
+					if (currentCursorPos.X == bufferInfo.dwMaximumWindowSize.X) {
+						currentCursorPos.X = 0;
+						currentCursorPos.Y++;
 					}
 				}
 				else {
-					currentCursorPos.X = 0;
-					currentCursorPos.Y++;
-					termSeqLength = 0ULL;
+					termSeqLength++;
 				}
-
 			}
+			else {
+				currentCursorPos.X = 0;
+				currentCursorPos.Y++;
+				termSeqLength = 0ULL;
+			}
+
 			if (currentChar == L'\n')
 				newlineCount++;
 
@@ -448,30 +821,30 @@ namespace PROGRAM_NAMESPACE {
 			strPos++;
 		}
 
+		// While an Output Frame is in progress, the specified `str` is only added to the Current Output Frame
+		// and the console is expected to scroll once the Console Cursor moves past the last row of the Output Buffer.
+		if (isFrameActive) {
+			// The last row of the Current Output Buffer.
+			short lastRow = std::max<short>(bufferInfo.dwSize.Y - 1, 0);
+
+			this->frameData.contents.append(str, strLength);
+
+			if (currentCursorPos.Y > lastRow) {
+				scrolledLines = (currentCursorPos.Y - lastRow);
+				currentCursorPos.Y = lastRow;
+			}
+
+			this->frameData.cursorPos = currentCursorPos;
+		}
 		// If there are one or more newlines in the specified `str`, we need
 		// to check if the newlines caused the console to scroll.
-		if (newlineCount > 0) {
+		else if (newlineCount > 0) {
 			WinConsoleCursorCoordinates initialCursorPos = this->getCursorPos();
 			writeToConsole();
 			WinConsoleCursorCoordinates finalCursorPos = this->getCursorPos();
 
 			// Calculate the number of lines scrolled in the console by the newlines.
-			short scrolledLines = ( newlineCount - (finalCursorPos.Y - initialCursorPos.Y) );
-			
-			if (scrolledLines > 0 && this->getCurrentBufferData(true).cursorStartPos.Y > 0) {
-				bufferData.cursorScrollOffset += scrolledLines;
-
-				if (programSettings.useCustomBufferBehavior)
-					this->mainBufferData.cursorStartPos.Y = std::max<short>(
-						this->mainBufferData.cursorStartPos.Y - scrolledLines,
-						0
-					);
-
-				// Update the position of any Saved Cursors in the current Output Buffer
-				// to reflect the console being scrolled.
-				for ( auto& savedCursorPos : bufferData.savedCursors )
-					savedCursorPos.Y = std::max<short>(savedCursorPos.Y - scrolledLines, 0);
-			}
+			scrolledLines = ( newlineCount - (finalCursorPos.Y - initialCursorPos.Y) );
 		}
 		// If there are no newlines in the specified `str`, we can 
 		// simply write the contents of the `str` to the console.
@@ -479,6 +852,21 @@ namespace PROGRAM_NAMESPACE {
 			writeToConsole();
 		}
 
+		if (scrolledLines > 0 && this->getCurrentBufferData(true).cursorStartPos.Y > 0) {
+			bufferData.cursorScrollOffset += scrolledLines;
+
+			if (programSettings.useCustomBufferBehavior)
+				this->mainBufferData.cursorStartPos.Y = std::max<short>(
+					this->mainBufferData.cursorStartPos.Y - scrolledLines,
+					0
+				);
+
+			// Update the position of any Saved Cursors in the current Output Buffer
+			// to reflect the console being scrolled.
+			for ( auto& savedCursorPos : bufferData.savedCursors )
+				savedCursorPos.Y = std::max<short>(savedCursorPos.Y - scrolledLines, 0);
+		}
+
 		return *this;
 
 	}
@@ -519,50 +907,235 @@ namespace PROGRAM_NAMESPACE {
 
 	}
 
+	void Console::OutputBuffer::takeSnapshot ( BufferData& bufferData ) const {
+
+		// The Cursor Starting Position of the Current Output Buffer.
+		const WinConsoleCursorCoordinates& cursorStartPos = this->getCurrentBufferData(true).cursorStartPos;
+		CONSOLE_SCREEN_BUFFER_INFO bufferInfo = {};		// Contains information about the underlying Console Output Buffer.
+		BufferSnapshot snapshot = {};					// The Snapshot being taken.
+		short lastRow = 0;								// The last row of the underlying Console Output Buffer included in the `snapshot`.
+		short blockRows = 0;							// The number of rows read by each call to `ReadConsoleOutputW()`.
+
+		bufferData.snapshot.reset();
+
+		// Any output assembled by the Current Output Frame has to be written before the cells can be read.
+		if ( this->isFrameActive() )
+			this->flushFrame(true);
+
+		if ( !GetConsoleScreenBufferInfo(this->getBufferHandle(), &bufferInfo) || bufferInfo.dwSize.X <= 0 )
+			return;
+
+		lastRow = std::max<short>( bufferInfo.dwCursorPosition.Y, (short) (cursorStartPos.Y + (short) bufferData.contents.size() - 1) );
+		lastRow = std::min<short>( lastRow, bufferInfo.dwSize.Y - 1 );
+
+		if ( lastRow < cursorStartPos.Y )
+			return;
+
+		snapshot.size = {
+			.X = bufferInfo.dwSize.X,
+			.Y = (short) (lastRow - cursorStartPos.Y + 1)
+		};
+		snapshot.cursorPos = {
+			.X = bufferInfo.dwCursorPosition.X,
+			.Y = (short) (bufferInfo.dwCursorPosition.Y - cursorStartPos.Y)
+		};
+		snapshot.textAttributes = bufferInfo.wAttributes;
+		snapshot.cells.resize( (size_t) snapshot.size.X * (size_t) snapshot.size.Y );
+		blockRows = (short) std::max<size_t>( BufferSnapshot::MAX_BLOCK_CELLS / (size_t) snapshot.size.X, 1ULL );
+
+		for ( short row = 0; row < snapshot.size.Y; row += blockRows ) {
+			short rowCount = std::min<short>(blockRows, snapshot.size.Y - row);	// The number of rows being read.
+			SMALL_RECT region = {												// The region of the underlying Console Output Buffer being read.
+				.Left = 0,
+				.Top = (short) (cursorStartPos.Y + row),
+				.Right = (short) (snapshot.size.X - 1),
+				.Bottom = (short) (cursorStartPos.Y + row + rowCount - 1)
+			};
+
+			if ( !ReadConsoleOutputW(this->getBufferHandle(), &snapshot.cells[(size_t) row * (size_t) snapshot.size.X], { .X = snapshot.size.X, .Y = rowCount }, { .X = 0, .Y = 0 }, &region) )
+				return;
+		}
+
+		bufferData.snapshot = std::move(snapshot);
+
+	}
+
+	bool Console::OutputBuffer::restoreSnapshot ( BufferData& bufferData ) {
+
+		// The Cursor Starting Position of the Current Output Buffer, which accounts for any scrolling since the `snapshot` was taken.
+		const WinConsoleCursorCoordinates& cursorStartPos = this->getCurrentBufferData(true).cursorStartPos;
+		CONSOLE_SCREEN_BUFFER_INFO bufferInfo = {};							// Contains information about the underlying Console Output Buffer.
+		std::optional<BufferSnapshot> snapshot = std::move(bufferData.snapshot);	// The Snapshot being restored.
+		short blockRows = 0;												// The number of rows written by each call to `WriteConsoleOutputW()`.
+
+		bufferData.snapshot.reset();
+
+		if ( !snapshot )
+			return false;
+
+		// Any output assembled by the Current Output Frame, such as the Alternate Output Buffer being cleared, has to be written first.
+		if ( this->isFrameActive() )
+			this->flushFrame();
+
+		if (
+			   !GetConsoleScreenBufferInfo(this->getBufferHandle(), &bufferInfo)
+			|| bufferInfo.dwSize.X != snapshot->size.X
+			|| cursorStartPos.Y + snapshot->size.Y > bufferInfo.dwSize.Y
+		) {
+			return false;
+		}
+
+		blockRows = (short) std::max<size_t>( BufferSnapshot::MAX_BLOCK_CELLS / (size_t) snapshot->size.X, 1ULL );
+
+		for ( short row = 0; row < snapshot->size.Y; row += blockRows ) {
+			short rowCount = std::min<short>(blockRows, snapshot->size.Y - row);	// The number of rows being written.
+			SMALL_RECT region = {													// The region of the underlying Console Output Buffer being written.
+				.Left = 0,
+				.Top = (short) (cursorStartPos.Y + row),
+				.Right = (short) (snapshot->size.X - 1),
+				.Bottom = (short) (cursorStartPos.Y + row + rowCount - 1)
+			};
+
+			TraceRecorder::incrementCounter(TraceRecorder::CONSOLE_WRITE_CALLS);
+			TraceRecorder::incrementCounter(TraceRecorder::CONSOLE_BYTES_WRITTEN, (size_t) rowCount * (size_t) snapshot->size.X * sizeof(CHAR_INFO));
+
+			if ( !WriteConsoleOutputW(this->getBufferHandle(), &snapshot->cells[(size_t) row * (size_t) snapshot->size.X], { .X = snapshot->size.X, .Y = rowCount }, { .X = 0, .Y = 0 }, &region) )
+				return false;
+		}
+
+		SetConsoleTextAttribute(this->getBufferHandle(), snapshot->textAttributes);
+		this->setCursorPos({
+			.X = snapshot->cursorPos.X,
+			.Y = (short) (cursorStartPos.Y + snapshot->cursorPos.Y)
+		});
+
+		return true;
+
+	}
+
+	const Console::OutputBuffer& Console::OutputBuffer::flushFrame ( bool synchronizeCursor ) const {
+
+		if ( !this->frameData.contents.empty() ) {
+			TraceRecorder::incrementCounter(TraceRecorder::CONSOLE_WRITE_CALLS);
+			TraceRecorder::incrementCounter(TraceRecorder::CONSOLE_BYTES_WRITTEN, this->frameData.contents.size() * sizeof(wchar_t));
+
+			WriteConsoleW(
+				this->getBufferHandle(),
+				this->frameData.contents.data(),
+				(DWORD) this->frameData.contents.size(),
+				NULL,
+				NULL
+			);
+			this->frameData.contents.clear();
+		}
+
+		if (synchronizeCursor) {
+			// A structure containing details about the Console Output Buffer returned by the Windows API.
+			CONSOLE_SCREEN_BUFFER_INFO bufferInfo = {};
+
+			GetConsoleScreenBufferInfo(this->getBufferHandle(), &bufferInfo);
+
+			this->frameData.cursorPos = bufferInfo.dwCursorPosition;
+			this->frameData.bufferSize = bufferInfo.dwSize;
+			this->frameData.maxWindowWidth = bufferInfo.dwMaximumWindowSize.X;
+			this->frameData.window = bufferInfo.srWindow;
+		}
+
+		return *this;
+
+	}
+
 
 	/* Console::InputBuffer */
 	// Class Constants
 
-	const DWORD Console::InputBuffer::MAX_INPUT_EVENT_BUFFER_SIZE = 10UL;
+	const DWORD Console::InputBuffer::MAX_INPUT_EVENT_BUFFER_SIZE = 64UL;
 
 	// Class Constructors
 
 	Console::InputBuffer::InputBuffer ( win_conbuf_t iBufferHandle ) : AConsoleBuffer(iBufferHandle) {}
 
-	// Implemented Instance Methods
+	// Instance Methods
 
-	std::optional<Console::InputBuffer::WinConsoleInputKey> Console::InputBuffer::waitForInput ( bool flushBuffer, DWORD maxWaitTime ) const {
+	std::optional<Console::InputBuffer::WinConsoleInputKey> Console::InputBuffer::waitForInputEvent (
+		bool flushBuffer,
+		DWORD maxWaitTime,
+		_Out_ bool& oBufferResized,
+		HANDLE wakeEvent
+	) const {
 	
-		static WinConsoleInput inputBuf[MAX_INPUT_EVENT_BUFFER_SIZE];	// A buffer containing recently-emitted Console Input Records.
-		static DWORD inputBufSize = 0UL;								// The current size of the `inputBuf`.
-		static DWORD inputBufPos = 0UL;									// The current index in the `inputBuf`.
-		static bool inputBufIsEmpty = true;								// Indicates whether or not the `inputBuf` is considered to be empty.
+		static WinConsoleInput inputBuf[MAX_INPUT_EVENT_BUFFER_SIZE];	// A buffer receiving Console Input Records from the Windows API.
+		static std::deque<WinConsoleInputKey> pendingKeys = {};			// The coalesced Key Down Events that have not been returned yet.
+		static bool bufferResized = false;								// Indicates whether a Buffer Resize Event has not been reported yet.
 
 		const win_conbuf_t& bufferHandle = this->getBufferHandle();		// The handle to the underlying Console Input Buffer.
 
+		/**
+		 * A lambda function used to add a Key Down Event to the `pendingKeys`.
+		 * 
+		 * Consecutive Navigation Keys (`UP` and `DOWN`) are merged into a single Key Down Event
+		 * whose `wRepeatCount` represents the net number of steps in the direction of its key,
+		 * so that a burst of Navigation Keys only has to be processed and redrawn once.
+		 * 
+		 * @param keyEvent	The Key Down Event being added.
+		 */
+		auto addPendingKey = [] ( const WinConsoleInputKey& keyEvent ) {
+
+			// Indicates whether the `keyEvent` is for a Navigation Key.
+			bool isNavigationKey = ( keyEvent.wVirtualKeyCode == VK_UP || keyEvent.wVirtualKeyCode == VK_DOWN );
+
+			if ( isNavigationKey && !pendingKeys.empty() ) {
+				WinConsoleInputKey& lastKey = pendingKeys.back();	// The most recent pending Key Down Event.
+				WORD keyRepeatCount = std::max<WORD>(keyEvent.wRepeatCount, 1U);
+				WORD lastKeyRepeatCount = std::max<WORD>(lastKey.wRepeatCount, 1U);
+
+				if ( ( lastKey.wVirtualKeyCode == VK_UP || lastKey.wVirtualKeyCode == VK_DOWN ) && lastKey.dwControlKeyState == keyEvent.dwControlKeyState ) {
+					if ( lastKey.wVirtualKeyCode == keyEvent.wVirtualKeyCode ) {
+						lastKey.wRepeatCount = lastKeyRepeatCount + keyRepeatCount;
+					}
+					else if ( lastKeyRepeatCount > keyRepeatCount ) {
+						lastKey.wRepeatCount = lastKeyRepeatCount - keyRepeatCount;
+					}
+					else if ( lastKeyRepeatCount < keyRepeatCount ) {
+						lastKey = keyEvent;
+						lastKey.wRepeatCount = keyRepeatCount - lastKeyRepeatCount;
+					}
+					else {
+						pendingKeys.pop_back();
+					}
+
+					return;
+				}
+			}
+
+			pendingKeys.push_back(keyEvent);
+
+		};
+
+		oBufferResized = false;
+
 		if (flushBuffer) {
 			FlushConsoleInputBuffer(bufferHandle);
-			inputBufIsEmpty = true;
+			pendingKeys.clear();
+			bufferResized = false;
 		}
 
 		// Wait until valid console input is received.
 		while (true) {
-			// As long as the local `inputBuf` is not empty or fully-traversed,
-			// it will take priority over calling the Windows API.
-			if (!inputBufIsEmpty) {
-				// Continue iterating through the `inputBuf` looking for valid Input Records.
-				for ( ; inputBufPos < inputBufSize; inputBufPos++ ) {
-					// The current Console Input Record being evaluated.
-					WinConsoleInput& input = inputBuf[inputBufPos];
-
-					// Only Key Input Records and Key Down Events are considered to be valid.
-					if ( input.EventType == KEY_EVENT && input.Event.KeyEvent.bKeyDown ) {
-						inputBufPos++;
-						return std::make_optional( std::move(input.Event.KeyEvent) );
-					}
-				}
+			// Any Buffer Resize Events take priority over the pending Key Down Events,
+			// so that the keys are processed against the new size of the Console Screen Buffer.
+			if (bufferResized) {
+				bufferResized = false;
+				oBufferResized = true;
+				return std::optional<WinConsoleInputKey>();
+			}
+			// As long as there are pending Key Down Events, 
+			// they will take priority over calling the Windows API.
+			else if ( !pendingKeys.empty() ) {
+				WinConsoleInputKey key = std::move( pendingKeys.front() );
 
-				inputBufIsEmpty = true;
+				pendingKeys.pop_front();
+				return std::make_optional( std::move(key) );
 			}
 			else {
 				// The number of Console Event Records available in the underlying Console Input Buffer.
@@ -571,18 +1144,37 @@ namespace PROGRAM_NAMESPACE {
 				GetNumberOfConsoleInputEvents(bufferHandle, &inputRecordsAvailable);
 
 				if (inputRecordsAvailable > 0UL) {
-					inputBufSize = 0UL;
-					inputBufPos = 0UL;
+					// Drain all of the Console Event Records available in the underlying Console Input Buffer
+					// in a single pass, so that an entire burst of input can be coalesced together.
+					while (inputRecordsAvailable > 0UL) {
+						DWORD inputBufSize = 0UL;	// The number of Console Input Records retrieved into the `inputBuf`.
+
+						if ( !ReadConsoleInputW(bufferHandle, inputBuf, MAX_INPUT_EVENT_BUFFER_SIZE, &inputBufSize) || inputBufSize == 0UL )
+							break;
+
+						for ( DWORD inputBufPos = 0UL; inputBufPos < inputBufSize; inputBufPos++ ) {
+							// The current Console Input Record being evaluated.
+							const WinConsoleInput& input = inputBuf[inputBufPos];
+
+							// Only Key Down Events and Buffer Resize Events are considered to be valid.
+							if ( input.EventType == KEY_EVENT && input.Event.KeyEvent.bKeyDown )
+								addPendingKey(input.Event.KeyEvent);
+							else if ( input.EventType == WINDOW_BUFFER_SIZE_EVENT )
+								bufferResized = true;
+						}
 
-					// Retrieve Console Event Records from the underlying Console Input Buffer and
-					// store them in the internal record buffer for processing. 
-					ReadConsoleInputW(bufferHandle, inputBuf, MAX_INPUT_EVENT_BUFFER_SIZE, &inputBufSize);
-					inputBufIsEmpty = (inputBufSize == 0UL);
+						GetNumberOfConsoleInputEvents(bufferHandle, &inputRecordsAvailable);
+					}
 				}
 				else {
+					// The objects being waited on, which include the `wakeEvent` if one was specified.
+					const HANDLE waitHandles[2] = { bufferHandle, wakeEvent };
+					// The result of waiting on the `waitHandles`.
+					DWORD waitResult = WaitForMultipleObjects( (wakeEvent != NULL ? 2UL : 1UL), waitHandles, FALSE, maxWaitTime );
+
 					// If no Console Input Records are available, we can idle the Current Thread
-					// until the user interacts with the console again.
-					if ( WaitForSingleObject(bufferHandle, maxWaitTime) == WAIT_TIMEOUT ) {
+					// until the user interacts with the console again or the `wakeEvent` is signaled.
+					if ( waitResult == WAIT_TIMEOUT || waitResult == (WAIT_OBJECT_0 + 1UL) ) {
 						return std::optional<WinConsoleInputKey>();
 					}
 				}
@@ -591,6 +1183,23 @@ namespace PROGRAM_NAMESPACE {
 
 	}
 
+	// Implemented Instance Methods
+
+	std::optional<Console::InputBuffer::WinConsoleInputKey> Console::InputBuffer::waitForInput ( bool flushBuffer, DWORD maxWaitTime ) const {
+	
+		std::optional<WinConsoleInputKey> key = {};		// The input key received from the user.
+		bool bufferResized = false;						// Indicates whether the Console Screen Buffer was resized instead.
+
+		// Buffer Resize Events are only of interest to `waitForInputEvent()` callers.
+		do {
+			key = this->waitForInputEvent(flushBuffer, maxWaitTime, bufferResized);
+			flushBuffer = false;
+		} while ( !key && bufferResized );
+
+		return key;
+
+	}
+
 	std::optional<size_t> Console::InputBuffer::waitForInputData ( _Out_ wchar_t* oStrBuf, size_t maxInputLength ) const {
 
 		// The number of characters read in from the console.
@@ -646,6 +1255,85 @@ namespace PROGRAM_NAMESPACE {
 	}
 
 
+	/* Console::OutputQueue */
+	// Class Constructors & Destructors
+
+	Console::OutputQueue::OutputQueue () {
+
+		for ( size_t i = 0ULL; i < CAPACITY; i++ )
+			this->slots[i].sequence.store(i, std::memory_order_relaxed);
+
+	}
+
+	Console::OutputQueue::~OutputQueue () {
+
+		if (this->postEvent != NULL)
+			CloseHandle(this->postEvent);
+
+	}
+
+	// Instance Methods
+
+	bool Console::OutputQueue::push ( OutputRecord&& record ) {
+
+		static_assert( (CAPACITY & (CAPACITY - 1ULL)) == 0ULL, "The CAPACITY of the OutputQueue must be a power of two." );
+
+		size_t pos = this->pushPos.load(std::memory_order_relaxed);		// The position of the record being pushed.
+		Slot* slot = nullptr;												// The slot the record is being pushed to.
+
+		// Claim the slot at the current `pushPos`, retrying whenever another producer claims it first.
+		while (true) {
+			slot = &this->slots[pos & (CAPACITY - 1ULL)];
+
+			// The difference between the `sequence` of the slot and the `pos`, which is only zero once the slot is free.
+			std::ptrdiff_t sequenceDiff = (std::ptrdiff_t) slot->sequence.load(std::memory_order_acquire) - (std::ptrdiff_t) pos;
+
+			if ( sequenceDiff == 0 ) {
+				if ( this->pushPos.compare_exchange_weak(pos, pos + 1ULL, std::memory_order_relaxed) )
+					break;
+			}
+			// The slot still holds a record from the previous lap, so the `OutputQueue` is full.
+			else if ( sequenceDiff < 0 ) {
+				this->droppedCount.fetch_add(1ULL, std::memory_order_relaxed);
+				return false;
+			}
+			else {
+				pos = this->pushPos.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->record = std::move(record);
+		slot->sequence.store(pos + 1ULL, std::memory_order_release);
+		SetEvent(this->postEvent);
+		return true;
+
+	}
+	bool Console::OutputQueue::pop ( _Out_ OutputRecord& oRecord ) {
+
+		Slot& slot = this->slots[this->popPos & (CAPACITY - 1ULL)];	// The slot of the oldest record.
+
+		// The record has not finished being pushed yet, or the `OutputQueue` is empty.
+		if ( slot.sequence.load(std::memory_order_acquire) != (this->popPos + 1ULL) )
+			return false;
+
+		oRecord = std::move(slot.record);
+		slot.sequence.store(this->popPos + CAPACITY, std::memory_order_release);
+		this->popPos++;
+		return true;
+
+	}
+	size_t Console::OutputQueue::takeDroppedCount () {
+
+		return this->droppedCount.exchange(0ULL, std::memory_order_relaxed);
+
+	}
+	HANDLE Console::OutputQueue::getPostEvent () const {
+
+		return this->postEvent;
+
+	}
+
+
 	/* Console::MenuOptionStruct */
 	// Structure Constructors
 
@@ -678,39 +1366,45 @@ namespace PROGRAM_NAMESPACE {
 	Console::MenuOptionList::MenuOptionListActionStruct::MenuOptionListActionStruct (
 		ActionCallbackFunction iActionFn, 
 		const std::wstring& instructionLine
-	) : MenuOptionListActionStruct( iActionFn, InstructionLineList({ instructionLine }) ) {}
+	) : MenuOptionListActionStruct( std::move(iActionFn), InstructionLineList({ instructionLine }) ) {}
 
 	Console::MenuOptionList::MenuOptionListActionStruct::MenuOptionListActionStruct (
 		ActionCallbackFunction iActionFn, 
 		const InstructionLineList& iInstructions
-	) : actionFn(iActionFn), instructions(iInstructions) {}
+	) : actionFn( std::move(iActionFn) ), instructions(iInstructions) {}
 
 
-	/* Console::MenuOptionList */
-	// Class Constants
+	/* Console::MenuOptionList::NavigationActionStruct */
+	// Structure Constants
+
+	const std::wstring_view Console::MenuOptionList::NavigationActionStruct::INSTRUCTION = L"Use a Hotkey or the Up/Down Key and Enter to select an option.";
+
+	// Structure Methods
+
+	Console::MenuOptionList::MenuOptionListAction::InputProcessingResult Console::MenuOptionList::NavigationActionStruct::process (
+		const WinConsoleInputKey& key,
+		MenuOptionList& menuOptions,
+		Console& console,
+		std::optional<size_t>& currentSelectionNum
+	) {
+
+		// The index of the previous `MenuOption` that was selected prior to invoking this function.
+		size_t prevSelectionNum = currentSelectionNum ? *currentSelectionNum : 1ULL;
+		// The index of the new `MenuOption` to be selected after invoking this function.
+		size_t newSelectionNum = prevSelectionNum;
+		// The index of the `MenuOption` at the top of the Visible Console Viewport.
+		const size_t& topMenuOptionNum = menuOptions.getTopMenuOptionNum();
+		// The index of the `MenuOption` at the bottom of the Visible Console Viewport.
+		const size_t& bottomMenuOptionNum = menuOptions.getBottomMenuOptionNum();
+		// The value returned by the function.
+		Console::MenuOptionList::MenuOptionListAction::InputProcessingResult stopProcessingInput = std::make_pair(false, false);
+
+		// Move the cursor up or down using the arrow keys.
+		if (key.wVirtualKeyCode == VK_DOWN || key.wVirtualKeyCode == VK_UP) {
+			// The number of steps to move the cursor, as consecutive Navigation Keys are coalesced by `waitForInputEvent()`.
+			WORD stepCount = std::max<WORD>(key.wRepeatCount, 1U);
 
-	const Console::MenuOptionList::MenuOptionListAction
-	Console::MenuOptionList::DEFAULT_NAVIGATION_ACTIONS = {
-		[](
-			const WinConsoleInputKey& key,
-			MenuOptionList& menuOptions,
-			Console& console,
-			std::optional<size_t>& currentSelectionNum
-		) -> Console::MenuOptionList::MenuOptionListAction::InputProcessingResult {
-
-			// The index of the previous `MenuOption` that was selected prior to invoking this function.
-			size_t prevSelectionNum = currentSelectionNum ? *currentSelectionNum : 1ULL;
-			// The index of the new `MenuOption` to be selected after invoking this function.
-			size_t newSelectionNum = prevSelectionNum;
-			// The index of the `MenuOption` at the top of the Visible Console Viewport.
-			const size_t& topMenuOptionNum = menuOptions.getTopMenuOptionNum();
-			// The index of the `MenuOption` at the bottom of the Visible Console Viewport.
-			const size_t& bottomMenuOptionNum = menuOptions.getBottomMenuOptionNum();
-			// The value returned by the lambda function.
-			Console::MenuOptionList::MenuOptionListAction::InputProcessingResult stopProcessingInput = std::make_pair(false, false);
-
-			// Move the cursor up or down using the arrow keys.
-			if (key.wVirtualKeyCode == VK_DOWN || key.wVirtualKeyCode == VK_UP) {
+			for ( WORD step = 0U; step < stepCount; step++ ) {
 				// Avoid selecting disabled `MenuOption`s.
 				do {
 					// Move the cursor down using the down arrow.
@@ -732,179 +1426,203 @@ namespace PROGRAM_NAMESPACE {
 				}
 				while ( menuOptions[newSelectionNum].disabled && newSelectionNum > 0U && newSelectionNum < (menuOptions.size() - 1ULL) );
 			}
-			// Select one of the visible options without a dedicated hotkey using a numeric hotkey.
-			else if ( 0x31 <= key.wVirtualKeyCode && key.wVirtualKeyCode <= 0x39 ) {
-				// The integer corresponding to the number key that was used.
-				size_t numberKey = (key.wVirtualKeyCode - 0x30ULL);
-
-				newSelectionNum = topMenuOptionNum;
-
-				// Determine which `MenuOption` in the list of `menuOptions` corresponds
-				// to the specified `numberKey`, if possible.
-				for (
-					size_t i = 1U;
-					( newSelectionNum < menuOptions.size() && i < numberKey );
-					i++
-				) {
-					if (menuOptions[newSelectionNum].hotkey)
-						continue;
+		}
+		// Select one of the visible options without a dedicated hotkey using a numeric hotkey.
+		else if ( 0x31 <= key.wVirtualKeyCode && key.wVirtualKeyCode <= 0x39 ) {
+			// The integer corresponding to the number key that was used.
+			size_t numberKey = (key.wVirtualKeyCode - 0x30ULL);
+
+			newSelectionNum = topMenuOptionNum;
+
+			// Determine which `MenuOption` in the list of `menuOptions` corresponds
+			// to the specified `numberKey`, if possible.
+			for (
+				size_t i = 1U;
+				( newSelectionNum < menuOptions.size() && i < numberKey );
+				i++
+			) {
+				if (menuOptions[newSelectionNum].hotkey)
+					continue;
+
+				newSelectionNum++;
+			}
+
+			// If a valid selection is made, stop further processing of the list of `menuOptions`.
+			if ( newSelectionNum < menuOptions.size() )
+				stopProcessingInput = std::make_pair(true, true);
+		}
+		// Select one of the options using a dedicated hotkey.
+		else if ( key.uChar.UnicodeChar != L'\0' ) {
+			// The character that was specified, converted to its lowercase equivalent if applicable.
+			wchar_t keyChar = std::towlower(key.uChar.UnicodeChar);
+
+			// Determine which `MenuOption` in the list of `menuOptions` corresponds
+			// to the specified `keyChar`, if possible.
+			for ( size_t i = 0ULL; i < menuOptions.size(); i++ ) {
+				const MenuOption& menuOption = menuOptions[i];
+
+				if ( menuOption.hotkey && *menuOption.hotkey == keyChar && !menuOption.disabled ) {
+					newSelectionNum = i;
+
+					// If a valid selection is made, stop further processing of the list of `menuOptions`.
+					stopProcessingInput = std::make_pair(true, true);
+					break;
+				}
+			}
+		}
+
+		// Only bother updating the User Interface if the selection has actually changed.
+		if (newSelectionNum != prevSelectionNum) {
+			// Update the Selected `MenuOption` in the list of `menuOptions`.
+			menuOptions.setSelectedOption(newSelectionNum);
+
+			// The cursor is moving to a new location outside of the Visible Console Viewport
+			if ( newSelectionNum < topMenuOptionNum || bottomMenuOptionNum < newSelectionNum ) {
+				// Determine the new `MenuOption` that should appear at
+				// the top of the Visible Console Viewport after scrolling.
+				if (newSelectionNum < topMenuOptionNum) {
+					if (topMenuOptionNum > 0ULL) {
+						size_t diff = std::min(prevSelectionNum - newSelectionNum, topMenuOptionNum);
+
+						menuOptions.setTopMenuOptionNum(topMenuOptionNum - diff);
+					}
+				}
+				else {
+					size_t lastMenuOptionNum = (menuOptions.size() - 1ULL);
+
+					if (bottomMenuOptionNum < lastMenuOptionNum) {
+						size_t diff = (newSelectionNum - prevSelectionNum);
+						size_t newTopMenuOptionNum = topMenuOptionNum;
+						size_t newBottomMenuOptionNum = bottomMenuOptionNum;
+
+						/*
+						 * There is probably a better way to do this, but we are currently repeatedly manually calculating
+						 * the expected number of lines taken up by each `MenuOption` in the list of `menuOptions`
+						 * until the selected `MenuOption` is expected to be visible in the Visible Console Viewport.
+						 */
+						while (true) {
+							newTopMenuOptionNum++;
+
+							unsigned short lineCount = 0U;
+							size_t i = newTopMenuOptionNum;
+
+							for ( ; i <= newSelectionNum; i++ ) {
+								lineCount += menuOptions[i].getTotalLineCount();
+
+								if (i == newTopMenuOptionNum && menuOptions[newTopMenuOptionNum].padding.top)
+									lineCount--;
+								else if (i == newSelectionNum && menuOptions[newSelectionNum].padding.bottom)
+									lineCount--;
+
+								if ( lineCount >= menuOptions.getViewportMenuOptionLines() )
+									break;
+							}
+
+							// Only break out of the loop once the selected `MenuOption` is
+							// expected to be visible in the Visible Console Viewport.
+							if ( i > newSelectionNum || (lineCount < menuOptions.getViewportMenuOptionLines() && !menuOptions[i].padding.top) )
+								break;
+						}
+
+						menuOptions.setTopMenuOptionNum(newTopMenuOptionNum);
+					}
+				}
+			}
+
+			// Re-draw the Main Menu Options to reflect the Menu Cursor having moved to a new `MenuOption`.
+			// Only the rows that have actually changed are repainted, which is typically only the
+			// Selection Markers when the cursor is moving to a new location within the Visible Console Viewport.
+			console.redrawMenuOptions(menuOptions);
+
+			currentSelectionNum = newSelectionNum;
+		}
+
+		return stopProcessingInput;
+
+	}
+
+
+	/* Console::MenuOptionList::EscapeActionStruct */
+	// Structure Constants
+
+	const std::wstring_view Console::MenuOptionList::EscapeActionStruct::INSTRUCTION = L"Press ESC to return to the previous menu.";
+
+	// Structure Methods
+
+	Console::MenuOptionList::MenuOptionListAction::InputProcessingResult Console::MenuOptionList::EscapeActionStruct::process (
+		const WinConsoleInputKey& key,
+		MenuOptionList& menuOptions,
+		Console& console,
+		std::optional<size_t>& currentSelectionNum
+	) {
+
+		if ( key.wVirtualKeyCode == VK_ESCAPE ) {
+			currentSelectionNum = std::optional<size_t>();
+			// Halt processing for the `MenuOptionList` entirely.
+			return std::make_pair(true, true);
+		}
+
+		return std::make_pair(false, false);
 
-					newSelectionNum++;
-				}
+	}
 
-				// If a valid selection is made, stop further processing of the list of `menuOptions`.
-				if ( newSelectionNum < menuOptions.size() )
-					stopProcessingInput = std::make_pair(true, true);
-			}
-			// Select one of the options using a dedicated hotkey.
-			else if ( key.uChar.UnicodeChar != L'\0' ) {
-				// The character that was specified, converted to its lowercase equivalent if applicable.
-				wchar_t keyChar = std::towlower(key.uChar.UnicodeChar);
-
-				// Determine which `MenuOption` in the list of `menuOptions` corresponds
-				// to the specified `keyChar`, if possible.
-				for ( size_t i = 0ULL; i < menuOptions.size(); i++ ) {
-					const MenuOption& menuOption = menuOptions[i];
-
-					if ( menuOption.hotkey && *menuOption.hotkey == keyChar && !menuOption.disabled ) {
-						newSelectionNum = i;
-
-						// If a valid selection is made, stop further processing of the list of `menuOptions`.
-						stopProcessingInput = std::make_pair(true, true);
-						break;
-					}
-				}
-			}
 
-			// Only bother updating the User Interface if the selection has actually changed.
-			if (newSelectionNum != prevSelectionNum) {
-				// Update the Selected `MenuOption` in the list of `menuOptions`.
-				menuOptions.setSelectedOption(newSelectionNum);
+	/* Console::MenuOptionList::UpdateQueue */
+	// Class Destructors
 
-				// The cursor is moving to a new location outside of the Visible Console Viewport
-				if ( newSelectionNum < topMenuOptionNum || bottomMenuOptionNum < newSelectionNum ) {
-					// The position of the Console Cursor where the Main Menu is to be re-drawn from.
-					WinConsoleCursorCoordinates menuStartPos = *menuOptions.getCursorStartPos();
-												menuStartPos.X -= 2;
+	Console::MenuOptionList::UpdateQueue::~UpdateQueue () {
 
-					console.saveCursorPos();
-					console.setCursorPos(menuStartPos);
+		if (this->updateEvent != NULL)
+			CloseHandle(this->updateEvent);
 
-					// Determine the new `MenuOption` that should appear at
-					// the top of the Visible Console Viewport after scrolling.
-					if (newSelectionNum < topMenuOptionNum) {
-						if (topMenuOptionNum > 0ULL) {
-							size_t diff = (prevSelectionNum - newSelectionNum);
+	}
 
-							menuOptions.setTopMenuOptionNum(topMenuOptionNum - diff);
-						}
-					}
-					else {
-						size_t lastMenuOptionNum = (menuOptions.size() - 1ULL);
-
-						if (bottomMenuOptionNum < lastMenuOptionNum) {
-							size_t diff = (newSelectionNum - prevSelectionNum);
-							size_t newTopMenuOptionNum = topMenuOptionNum;
-							size_t newBottomMenuOptionNum = bottomMenuOptionNum;
-
-							/*
-							 * There is probably a better way to do this, but we are currently repeatedly manually calculating
-							 * the expected number of lines taken up by each `MenuOption` in the list of `menuOptions`
-							 * until the selected `MenuOption` is expected to be visible in the Visible Console Viewport.
-							 */
-							while (true) {
-								newTopMenuOptionNum++;
-
-								unsigned short lineCount = 0U;
-								size_t i = newTopMenuOptionNum;
-
-								for ( ; i <= newSelectionNum; i++ ) {
-									lineCount += menuOptions[i].getTotalLineCount();
-
-									if (i == newTopMenuOptionNum && menuOptions[newTopMenuOptionNum].padding.top)
-										lineCount--;
-									else if (i == newSelectionNum && menuOptions[newSelectionNum].padding.bottom)
-										lineCount--;
-
-									if (lineCount >= MAX_MENU_OPTION_LINES)
-										break;
-								}
-
-								// Only break out of the loop once the selected `MenuOption` is
-								// expected to be visible in the Visible Console Viewport.
-								if (i > newSelectionNum || (lineCount < MAX_MENU_OPTION_LINES && !menuOptions[i].padding.top))
-									break;
-							}
+	// Instance Methods
 
-							menuOptions.setTopMenuOptionNum(newTopMenuOptionNum);
-						}
-					}
+	void Console::MenuOptionList::UpdateQueue::post ( UpdateFunction update ) {
 
-					// Re-draw the Main Menu Options to reflect the
-					// Menu Cursor having moved to a new `MenuOption`.
-					console.printMenuOptions(menuOptions, false);
-					console.restoreSavedCursorPos();
-				}
-				// The cursor is moving to a new location within the Visible Console Viewport.
-				else {
-					WinConsoleCursorCoordinates prevCursorPos = *menuOptions.getCursorPos(prevSelectionNum);
-					WinConsoleCursorCoordinates newCursorPos = *menuOptions.getCursorPos(newSelectionNum);
-
-					console.saveCursorPos();
-					console.setCursorPos(prevCursorPos);
-					console.print(L" ");
-					console.setCursorPos(newCursorPos);
-					console.print(L">");
-					console.restoreSavedCursorPos();
-				}
+		std::lock_guard<std::mutex> lock(this->updateMutex);	// Held while the `pendingUpdates` are modified.
 
-				currentSelectionNum = newSelectionNum;
-			}
+		this->pendingUpdates.push_back( std::move(update) );
+		SetEvent(this->updateEvent);
 
-			return stopProcessingInput;
-
-		},
-		 L"Use a Hotkey or the Up/Down Key and Enter to select an option."
-		//std::wstring(L"Use a Hotkey or ") + ARROW_UP_DOWN + L" and press Enter to select an option."
-	};
-
-	const Console::MenuOptionList::MenuOptionListAction
-	Console::MenuOptionList::DEFAULT_ESCAPE_ACTION = {
-		[](
-			const WinConsoleInputKey& key,
-			MenuOptionList& menuOptions,
-			Console& console,
-			std::optional<size_t>& currentSelectionNum
-		) -> Console::MenuOptionList::MenuOptionListAction::InputProcessingResult {
-
-			if ( key.wVirtualKeyCode == VK_ESCAPE ) {
-				currentSelectionNum = std::optional<size_t>();
-				// Halt processing for the `MenuOptionList` entirely.
-				return std::make_pair(true, true);
-			}
+	}
+	HANDLE Console::MenuOptionList::UpdateQueue::getUpdateEvent () const {
+
+		return this->updateEvent;
+
+	}
+	bool Console::MenuOptionList::UpdateQueue::applyPendingUpdates ( MenuOptionList& menuOptions ) {
+
+		std::vector<UpdateFunction> updates = {};	// The updates being applied.
+
+		// The updates are applied outside of the lock, so that they can be posted while others are being applied.
+		{
+			std::lock_guard<std::mutex> lock(this->updateMutex);
+			updates.swap(this->pendingUpdates);
+		}
 
-			return std::make_pair(false, false);
+		for ( const UpdateFunction& update : updates )
+			update(menuOptions);
 
-		},
-		L"Press ESC to return to the previous menu."
-	};
+		return !updates.empty();
+
+	}
 
-	const std::vector<Console::MenuOptionList::MenuOptionListAction> Console::MenuOptionList::DEFAULT_ACTIONS = {
-		Console::MenuOptionList::DEFAULT_NAVIGATION_ACTIONS,
-		Console::MenuOptionList::DEFAULT_ESCAPE_ACTION
-	};
 
+	/* Console::MenuOptionList */
 	// Class Constructors
 
 	Console::MenuOptionList::MenuOptionList (
-		const std::vector<MenuOptionListAction>& iActions,
+		std::vector<MenuOptionListAction> iActions,
 		const std::wstring& iPrefix,
 		const std::wstring& iSuffix,
 		const std::wstring& iSeparator,
 		unsigned short iWidth,
 		unsigned short iMaxMenuOptionLines
 	) : vector(), 
-		actions(iActions), 
+		actions( std::move(iActions) ), 
+		escapeInstruction(EscapeAction::INSTRUCTION), 
 		prefix(iPrefix), 
 		suffix(iSuffix), 
 		separator(iSeparator), 
@@ -913,14 +1631,15 @@ namespace PROGRAM_NAMESPACE {
 	{}
 	Console::MenuOptionList::MenuOptionList (
 		std::initializer_list<MenuOption> initList,
-		const std::vector<MenuOptionListAction>& iActions,
+		std::vector<MenuOptionListAction> iActions,
 		const std::wstring& iPrefix,
 		const std::wstring& iSuffix,
 		const std::wstring& iSeparator,
 		unsigned short iWidth,
 		unsigned short iMaxMenuOptionLines
 	) : vector(initList), 
-		actions(iActions), 
+		actions( std::move(iActions) ), 
+		escapeInstruction(EscapeAction::INSTRUCTION), 
 		prefix(iPrefix), 
 		suffix(iSuffix), 
 		separator(iSeparator), 
@@ -939,6 +1658,17 @@ namespace PROGRAM_NAMESPACE {
 	
 		return this->actions;
 	
+	}
+	std::wstring_view Console::MenuOptionList::getEscapeInstruction () const {
+
+		return this->escapeInstruction;
+
+	}
+	Console::MenuOptionList& Console::MenuOptionList::setEscapeInstruction ( std::wstring_view instruction ) {
+
+		this->escapeInstruction = instruction;
+		return *this;
+
 	}
 	
 	const std::wstring& Console::MenuOptionList::getPrefix () const {
@@ -976,6 +1706,16 @@ namespace PROGRAM_NAMESPACE {
 	
 		return this->maxMenuOptionLines;
 		
+	}
+	const std::shared_ptr<Console::MenuOptionList::UpdateQueue>& Console::MenuOptionList::getUpdateQueue () const {
+
+		return this->updateQueue;
+
+	}
+	unsigned short Console::MenuOptionList::getViewportMenuOptionLines () const {
+
+		return ( this->viewportMenuOptionLines > 0U ? this->viewportMenuOptionLines : this->maxMenuOptionLines );
+
 	}
 
 	const std::optional<Console::WinConsoleCursorCoordinates>& Console::MenuOptionList::getCursorStartPos () const {
@@ -1118,15 +1858,30 @@ namespace PROGRAM_NAMESPACE {
 		instructions += this->separator;
 		instructions.push_back(L'\n');
 
+		/**
+		 * A lambda helper function used to append a single instruction to the `instructions`.
+		 * 
+		 * @param instruction	The Human-Readable Instruction being appended.
+		 */
+		auto appendInstruction = [this, &instructions]( std::wstring_view instruction ) {
+
+			instructions += std::format(
+				L"{:} - {:{}} {:}\n",
+				this->prefix,
+				instruction,
+				std::max<unsigned short>(this->width - 4U, 0U),
+				this->suffix
+			);
+
+		};
+
+		// The instructions of the `DefaultActionPipeline` always come first, as they are processed first.
+		appendInstruction(NavigationAction::INSTRUCTION);
+		appendInstruction(this->escapeInstruction);
+
 		for (const MenuOptionListAction& action : this->actions)
-			for (const std::wstring instruction : action.instructions)
-				instructions += std::format(
-					L"{:} - {:{}} {:}\n",
-					this->prefix,
-					instruction,
-					std::max<unsigned short>(this->width - 4U, 0U),
-					this->suffix
-				);
+			for (const std::wstring& instruction : action.instructions)
+				appendInstruction(instruction);
 
 		instructions += this->separator;
 		return instructions;
@@ -1152,7 +1907,9 @@ namespace PROGRAM_NAMESPACE {
 	Console::Console () : 
 		conInBuf( GetStdHandle(STD_INPUT_HANDLE) ),
 		conOutBuf( GetStdHandle(STD_OUTPUT_HANDLE) ),
-		conErrBuf( GetStdHandle(STD_ERROR_HANDLE) )
+		conErrBuf( GetStdHandle(STD_ERROR_HANDLE) ),
+		postedOutput(),
+		ownerThreadId( GetCurrentThreadId() )
 	{
 
 		// An array of Raw Pointers to the handles being validated.
@@ -1174,6 +1931,12 @@ namespace PROGRAM_NAMESPACE {
 	
 		wchar_t originalTitle[512] = {};
 
+		// Records posted right before the program exits are still printed.
+		while ( this->getCurrentBufferNum() > 0ULL )
+			this->restorePreviousBuffer();
+
+		this->flushPostedOutput();
+
 		GetConsoleOriginalTitle(originalTitle, 512);
 		SetConsoleTitle(originalTitle);
 		SetConsoleCtrlHandler(consoleCtrlHandler, false);
@@ -1184,6 +1947,11 @@ namespace PROGRAM_NAMESPACE {
 
 	Console::console_ptr_t Console::getConsole () {
 
+		// Serializes the creation of the shared `Console` instance.
+		static std::mutex instanceMutex = {};
+
+		std::lock_guard<std::mutex> lock(instanceMutex);
+
 		if ( !Console::instancePtr ) {
 			try {
 				Console::instancePtr = Console::console_ptr_t(new Console());
@@ -1217,11 +1985,14 @@ namespace PROGRAM_NAMESPACE {
 
 	Console& Console::printMenuOption ( MenuOption& menuOption, unsigned int optionNum, unsigned short width ) {
 
-		// Print Disabled `MenuOption`s in a gray color.
-		if (menuOption.disabled)
-			this->print(getVirtualTerminalSequence(L"[90m"));
+		this->print( this->formatMenuOption(menuOption, optionNum, width) );
+		return *this;
+	
+	}
+	std::wstring Console::formatMenuOption ( const MenuOption& menuOption, unsigned int optionNum, unsigned short width ) const {
 
-		this->printf(
+		// The formatted `MenuOption`.
+		std::wstring formattedMenuOption = std::format(
 			L"{:<{}}",
 			std::format(
 				L"{:1}) {:}",
@@ -1231,38 +2002,25 @@ namespace PROGRAM_NAMESPACE {
 			width
 		);
 
-		// Revert the text color to the default value if needed.
-		if (menuOption.disabled)
-			this->print(getVirtualTerminalSequence(L"[39m"));
+		// Print Disabled and Dimmed `MenuOption`s in a gray color, reverting
+		// the text color to the default value afterwards.
+		if (menuOption.disabled || menuOption.dimmed) {
+			formattedMenuOption.insert(0, getVirtualTerminalSequence(L"[90m"));
+			formattedMenuOption.append(getVirtualTerminalSequence(L"[39m"));
+		}
+
+		return formattedMenuOption;
 
-		return *this;
-	
 	}
 
 	Console& Console::printMenuOptions ( MenuOptionList& menuOptions, bool printInstructions ) {
 
-		std::wstring prefix = menuOptions.getPrefix();		// Menu Option Prefix
-		std::wstring suffix = menuOptions.getSuffix();		// Menu Option Suffix
-		unsigned short width = menuOptions.getWidth();		// Minimum Menu Option Width
-		std::wstring spaceStr = menuOptions.getSpace();		// Menu Option Space String
-		
-		// The Top `MenuOption` number for the list of `menuOptions`
-		const size_t& topMenuOptionNum = menuOptions.getTopMenuOptionNum();
-		// The Bottom `MenuOption` number for the list of `menuOptions`
-		size_t bottomMenuOptionNum = topMenuOptionNum;
-		// The Selected `MenuOption` number for the list of `menuOptions`
-		size_t selectedOptionNum = menuOptions.getSelectedOption() ? *menuOptions.getSelectedOption() : 0ULL;
-		// The Current Unassigned `MenuOption` Hotkey Number
-		unsigned short currentOptionHotkeyNum = 1U;
-
+		ScopedTraceTimer traceTimer = { "printMenuOptions", "console" };
 		short initialScrollOffset = this->getCursorScrollOffset();	// The Cursor Scroll Offset prior to printing the `menuOptions`
 		short finalScrollOffset = initialScrollOffset;				// The Cursor Scroll Offset after printing the `menuOptions`
-		unsigned short menuOptionLines = 0U;						// The total number of lines that have been used to render the list of `menuOptions`
-		unsigned short maxMenuLines = (								// The maximum number of lines that can be used to render the list of `menuOptions`.
-			selectedOptionNum < (menuOptions.size() - 1ULL)
-				? (menuOptions.maxMenuOptionLines - 1U)
-				: menuOptions.maxMenuOptionLines
-		);
+
+		// The entire list of `menuOptions` is assembled and written to the console at once.
+		this->beginFrame();
 
 		// Set the Cursor Starting Position in the `menuOptions` list if
 		// it has not already been set.
@@ -1273,71 +2031,22 @@ namespace PROGRAM_NAMESPACE {
 			menuOptions.setCursorStartPos(cursorStartPos);
 		}
 
-		// Ensure each `MenuOption` is terminated by a Newline Character.
-		if ( !suffix.ends_with(L"\n") )
-			suffix.push_back(L'\n');
-
-		// Print an Up Arrow if there are one or more `MenuOptions`
-		// currently above the Visible Console Viewport.
-		if (topMenuOptionNum > 0ULL) {
-			this->print(prefix)
-				 .printf(L"  {:<{}}", ARROW_UP, width - 2U)
-				 .print(suffix);
-			menuOptionLines++;
-		}
-
-		// Print the `MenuOption`s within the Visible Console Viewport.
-		for ( size_t i = topMenuOptionNum; i < menuOptions.size(); i++ ) {
-			// Break out of the loop once we have exceeded the Expected Visible Console Viewport.
-			if (menuOptionLines >= maxMenuLines)
-				break;
-
-			// The current `MenuOption` being printed.
-			MenuOption& menuOption = menuOptions[i];
-
-			// Print Top Padding for the Current `MenuOption` if applicable.
-			if ( menuOption.padding.top && i > topMenuOptionNum && menuOptionLines < maxMenuLines ) {
-				this->println(spaceStr);
-				menuOptionLines++;
-			}
-
-			// Print the contents of the `MenuOption`.
-			if (menuOptionLines < maxMenuLines) {
-				this->print(prefix)
-					 .printsp( ((i != selectedOptionNum) ? L' ' : L'>') )
-					 .printMenuOption(menuOption, currentOptionHotkeyNum, width - 2U)
-					 .print(suffix);
-			
-				if (!menuOption.hotkey)
-					currentOptionHotkeyNum++;
-
-				menuOptionLines++;
-
-				if (i != topMenuOptionNum)
-					bottomMenuOptionNum++;
-			}
-
-			// Print Bottom Padding for the Current `MenuOption` if applicable.
-			if ( menuOption.padding.bottom && menuOptionLines < maxMenuLines ) {
-				this->println(spaceStr);
-				menuOptionLines++;
-			}
-		}
+		// Only as many lines as fit within the Console Window are used to render the `menuOptions`.
+		this->updateMenuOptionViewport(menuOptions, menuOptions.maxMenuOptionLines);
+		menuOptions.printedMenuOptionLines = menuOptions.viewportMenuOptionLines;
 
-		menuOptions.setBottomMenuOptionNum(bottomMenuOptionNum);
+		// Keep track of the printed rows so the `menuOptions` can later be redrawn incrementally.
+		menuOptions.renderedRows = this->formatMenuOptionRows(menuOptions);
 
-		// Print a Down Arrow if there are one or more `MenuOptions`
-		// currently below the Visible Console Viewport.
-		if ( bottomMenuOptionNum < (menuOptions.size() - 1ULL) ) {
-			this->print(prefix)
-				 .printf(L"  {:<{}}", ARROW_DOWN, width - 2U)
-				 .print(suffix);
-			menuOptionLines++;
-		}
+		// The `renderedRows` never include a trailing Newline Character so that they can be redrawn in place,
+		// and are each terminated using `println()` instead.
+		for ( const std::wstring& row : menuOptions.renderedRows )
+			this->println(row);
 
 		if (printInstructions)
 			this->print(menuOptions.getInstructionString());
 
+		this->commitFrame();
 		finalScrollOffset = this->getCursorScrollOffset();
 
 		if (finalScrollOffset > initialScrollOffset) {
@@ -1353,6 +2062,70 @@ namespace PROGRAM_NAMESPACE {
 
 		return *this;
 	
+	}
+	Console& Console::redrawMenuOptions ( MenuOptionList& menuOptions, bool repaintAll ) {
+
+		// The rows of the `menuOptions` as they were last written to the console.
+		const std::vector<std::wstring>& prevRows = menuOptions.renderedRows;
+		// The rows of the `menuOptions` as they are to be redrawn.
+		std::vector<std::wstring> newRows = {};
+		// The Position of the Console Cursor corresponding to the first column of the first row of the `menuOptions`.
+		WinConsoleCursorCoordinates menuStartPos = {};
+
+		// Without a Cursor Starting Position, there is nothing to compare against.
+		if ( !menuOptions.getCursorStartPos() )
+			return this->printMenuOptions(menuOptions);
+
+		menuStartPos = *menuOptions.getCursorStartPos();
+		menuStartPos.X -= 2;
+		newRows = this->formatMenuOptionRows(menuOptions);
+
+		this->saveCursorPos();
+		this->beginFrame();
+
+		for ( size_t i = 0ULL; i < std::max(newRows.size(), prevRows.size()); i++ ) {
+			// The row that was last written to the console, or an empty string if the row is new.
+			std::wstring prevRow = ( i < prevRows.size() ? prevRows[i] : std::wstring() );
+			// The new row to be written, or an empty string if the row is no longer needed.
+			std::wstring newRow = ( i < newRows.size() ? newRows[i] : std::wstring() );
+			// The number of columns occupied by each of the rows in the console.
+			size_t prevRowWidth = getPrintedWidth(prevRow);
+			size_t newRowWidth = getPrintedWidth(newRow);
+			// The range of characters in the `newRow` that differs from the `prevRow`.
+			size_t diffStartPos = 0ULL;
+			size_t diffEndPos = newRow.size();
+
+			if ( newRow == prevRow && !repaintAll )
+				continue;
+
+			// Columns only correspond to character indices if neither row contains a Virtual Terminal Sequence,
+			// in which case only the differing range of characters needs to be repainted.
+			if ( prevRowWidth == prevRow.size() && newRowWidth == newRow.size() && !repaintAll ) {
+				while ( diffStartPos < std::min(prevRow.size(), newRow.size()) && prevRow[diffStartPos] == newRow[diffStartPos] )
+					diffStartPos++;
+
+				if ( prevRow.size() == newRow.size() )
+					while ( diffEndPos > diffStartPos && prevRow[diffEndPos - 1ULL] == newRow[diffEndPos - 1ULL] )
+						diffEndPos--;
+			}
+
+			this->setCursorPos({
+				.X = (short) (menuStartPos.X + diffStartPos),
+				.Y = (short) (menuStartPos.Y + i)
+			});
+			this->print( newRow.substr(diffStartPos, diffEndPos - diffStartPos) );
+
+			// Erase any columns left over from a longer `prevRow`.
+			if (prevRowWidth > newRowWidth)
+				this->print( std::wstring(prevRowWidth - newRowWidth, L' ') );
+		}
+
+		this->commitFrame();
+		this->restoreSavedCursorPos();
+
+		menuOptions.renderedRows = std::move(newRows);
+		return *this;
+
 	}
 
 	std::optional<size_t> Console::waitForSelection ( MenuOptionList& menuOptions, DWORD maxWaitTime ) {
@@ -1409,16 +2182,44 @@ namespace PROGRAM_NAMESPACE {
 		/**
 		 * A lambda function to wait for input from the user.
 		 * 
-		 * Depends on this object, as well as the `key`, `menuOptions`,
-		 * and `maxWaitTime` variables, of which the `key` variable may
-		 * be modified by this function.
+		 * Depends on this object, as well as the `key`, `menuOptions`, `currentSelectionNum`,
+		 * and `maxWaitTime` variables, of which the `key` and `currentSelectionNum` variables
+		 * may be modified by this function.
+		 * 
+		 * If the Console Screen Buffer is resized while waiting, the `menuOptions` are
+		 * repainted in full once for the entire burst of Buffer Resize Events before waiting again.
 		 * 
 		 * @param flushBuffer	Indicates whether or not to flush the Console Input Buffer
 		 * 						prior to waiting for user input.
 		 */
-		auto waitForValidInput = [this, &key, &menuOptions, maxWaitTime] ( bool flushBuffer = false ) -> void {
+		auto waitForValidInput = [this, &key, &menuOptions, &currentSelectionNum, maxWaitTime] ( bool flushBuffer = false ) -> void {
+
+			bool bufferResized = false;		// Indicates whether the Console Screen Buffer was resized while waiting.
+			bool updatesApplied = false;	// Indicates whether any updates posted to the `menuOptions` were applied while waiting.
+
+			do {
+				key = this->conInBuf.waitForInputEvent(
+					flushBuffer,
+					(menuOptions.hasActiveStatusMessage() ? 1UL : maxWaitTime),
+					bufferResized,
+					menuOptions.updateQueue->getUpdateEvent()
+				);
+				flushBuffer = false;
+				updatesApplied = menuOptions.updateQueue->applyPendingUpdates(menuOptions);
 
-			key = this->waitForInput( flushBuffer, (menuOptions.hasActiveStatusMessage() ? 1UL : maxWaitTime) );
+				// An update may have inserted `MenuOption`s above the Currently-Selected `MenuOption`, moving the selection.
+				if ( updatesApplied && menuOptions.getSelectedOption() )
+					currentSelectionNum = menuOptions.getSelectedOption();
+
+				if (bufferResized) {
+					// Fit the `menuOptions` to the new Console Window, without growing past the lines that were originally printed.
+					this->updateMenuOptionViewport(menuOptions, menuOptions.printedMenuOptionLines);
+					this->redrawMenuOptions(menuOptions, true);
+				}
+				else if (updatesApplied) {
+					this->redrawMenuOptions(menuOptions);
+				}
+			} while ( !key && (bufferResized || updatesApplied) );
 
 		};
 
@@ -1427,13 +2228,15 @@ namespace PROGRAM_NAMESPACE {
 
 		while ( !stopProcessingInput.second && ( ( key && key->wVirtualKeyCode != VK_RETURN ) || ( !key && menuOptions.hasActiveStatusMessage() ) ) ) {
 			if (key) {
-				auto actions(menuOptions.getActions());
-			
-				for ( const MenuOptionList::MenuOptionListAction& action : actions ) {
-					stopProcessingInput = action.actionFn(*key, menuOptions, *this, currentSelectionNum);
+				// The Default Actions are called directly, without going through an Action Callback Function.
+				stopProcessingInput = MenuOptionList::DefaultActionPipeline::process(*key, menuOptions, *this, currentSelectionNum);
 
-					if (stopProcessingInput.first || stopProcessingInput.second)
-						break;
+				// An Action may add or remove Actions from the `menuOptions`, including itself, so each one is invoked
+				// through a copy of its Action Callback Function, which only allocates if its captures do not fit inline.
+				for ( size_t actionNum = 0ULL; !stopProcessingInput.first && !stopProcessingInput.second && actionNum < menuOptions.getActions().size(); actionNum++ ) {
+					MenuOptionList::MenuOptionListAction::ActionCallbackFunction actionFn = menuOptions.getActions()[actionNum].actionFn;
+
+					stopProcessingInput = actionFn(*key, menuOptions, *this, currentSelectionNum);
 				}
 			}
 
@@ -1449,6 +2252,74 @@ namespace PROGRAM_NAMESPACE {
 
 	}
 
+	void Console::post ( std::wstring record, bool isError ) {
+
+		this->postedOutput.push({ .contents = std::move(record), .isError = isError });
+
+		// Records posted from the thread that owns the `Console` are printed right away, when possible.
+		if ( GetCurrentThreadId() == this->ownerThreadId )
+			this->flushPostedOutput();
+
+	}
+	bool Console::flushPostedOutput () {
+
+		OutputQueue::OutputRecord record = {};		// The record most recently popped off of the `postedOutput`.
+		std::wstring batch = {};					// The records being printed together to the same Output Buffer.
+		bool batchIsError = false;					// Indicates if the `batch` is being printed to the Error Output Buffer.
+		bool printedAny = false;					// Indicates if any records were printed.
+		size_t droppedCount = 0ULL;					// The number of records that were dropped because the `postedOutput` was full.
+
+		/**
+		 * A lambda function used to print the current `batch` to its Output Buffer, if it is not empty.
+		 * 
+		 * Depends on this object, as well as the `batch`, `batchIsError`, and `printedAny` variables,
+		 * of which the `batch` and `printedAny` variables may be modified by this function.
+		 */
+		auto printBatch = [this, &batch, &batchIsError, &printedAny] () -> void {
+
+			if ( batch.empty() )
+				return;
+
+			if (batchIsError)
+				this->conErrBuf.print(batch);
+			else
+				this->conOutBuf.print(batch);
+
+			batch.clear();
+			printedAny = true;
+
+		};
+
+		// Records posted while an Interactive Menu is being displayed are held until it has been removed.
+		if ( this->getCurrentBufferNum() > 0ULL || this->isFrameActive() )
+			return false;
+
+		while ( this->postedOutput.pop(record) ) {
+			if ( record.isError != batchIsError )
+				printBatch();
+
+			batchIsError = record.isError;
+			batch.append(record.contents).push_back(L'\n');
+		}
+
+		if ( (droppedCount = this->postedOutput.takeDroppedCount()) > 0ULL ) {
+			if (!batchIsError)
+				printBatch();
+
+			batchIsError = true;
+			std::format_to( std::back_inserter(batch), L"({:d} posted records were dropped because too many were posted at once.)\n", droppedCount );
+		}
+
+		printBatch();
+		return printedAny;
+
+	}
+	HANDLE Console::getPostedOutputEvent () const {
+
+		return this->postedOutput.getPostEvent();
+
+	}
+
 	// Implemented Instance Methods
 
 	std::optional<Console::WinConsoleInputKey> Console::waitForInput ( bool flushBuffer, DWORD maxWaitTime ) const {
@@ -1474,10 +2345,35 @@ namespace PROGRAM_NAMESPACE {
 	}
 	Console::buffer_number_t Console::restorePreviousBuffer () {
 	
-		return this->conOutBuf.restorePreviousBuffer();
+		// The Output Buffer now being used by the `Console`.
+		buffer_number_t bufferNum = this->conOutBuf.restorePreviousBuffer();
+
+		// Any records that were held while the Alternate Output Buffers were in use can now be printed.
+		if ( bufferNum == 0ULL && GetCurrentThreadId() == this->ownerThreadId )
+			this->flushPostedOutput();
+
+		return bufferNum;
 	
 	}
 
+	Console& Console::beginFrame () {
+
+		this->conOutBuf.beginFrame();
+		return *this;
+
+	}
+	Console& Console::commitFrame () {
+
+		this->conOutBuf.commitFrame();
+		return *this;
+
+	}
+	bool Console::isFrameActive () const {
+
+		return this->conOutBuf.isFrameActive();
+
+	}
+
 	Console::WinConsoleCursorCoordinates Console::getCursorPos () const {
 	
 		return this->conOutBuf.getCursorPos();
@@ -1541,4 +2437,160 @@ namespace PROGRAM_NAMESPACE {
 	
 	}
 
+	// Helper Methods
+
+	std::vector<std::wstring> Console::formatMenuOptionRows ( MenuOptionList& menuOptions ) const {
+
+		const std::wstring& prefix = menuOptions.getPrefix();	// Menu Option Prefix
+		std::wstring suffix = menuOptions.getSuffix();			// Menu Option Suffix
+		unsigned short width = menuOptions.getWidth();			// Minimum Menu Option Width
+		std::wstring spaceStr = menuOptions.getSpace();			// Menu Option Space String
+		std::vector<std::wstring> rows = {};					// The formatted rows of the `menuOptions`
+		
+		// The Top `MenuOption` number for the list of `menuOptions`
+		const size_t& topMenuOptionNum = menuOptions.getTopMenuOptionNum();
+		// The Bottom `MenuOption` number for the list of `menuOptions`
+		size_t bottomMenuOptionNum = topMenuOptionNum;
+		// The Selected `MenuOption` number for the list of `menuOptions`
+		size_t selectedOptionNum = menuOptions.getSelectedOption() ? *menuOptions.getSelectedOption() : 0ULL;
+		// The Current Unassigned `MenuOption` Hotkey Number
+		unsigned short currentOptionHotkeyNum = 1U;
+
+		unsigned short menuOptionLines = 0U;						// The total number of lines that have been used to render the list of `menuOptions`
+		unsigned short maxMenuLines = (								// The maximum number of lines that can be used to render the list of `menuOptions`.
+			selectedOptionNum < (menuOptions.size() - 1ULL)
+				? (menuOptions.getViewportMenuOptionLines() - 1U)
+				: menuOptions.getViewportMenuOptionLines()
+		);
+
+		// Each row is terminated by a single Newline Character when it is printed.
+		if ( suffix.ends_with(L"\n") )
+			suffix.pop_back();
+		if ( spaceStr.ends_with(L"\n") )
+			spaceStr.pop_back();
+
+		rows.reserve(maxMenuLines + 2ULL);
+		menuOptions.formattedMenuOptions.resize( menuOptions.size() );
+
+		// Add an Up Arrow if there are one or more `MenuOptions`
+		// currently above the Visible Console Viewport.
+		if (topMenuOptionNum > 0ULL) {
+			rows.push_back( prefix + std::format(L"  {:<{}}", ARROW_UP, width - 2U) + suffix );
+			menuOptionLines++;
+		}
+
+		// Add the `MenuOption`s within the Visible Console Viewport.
+		for ( size_t i = topMenuOptionNum; i < menuOptions.size(); i++ ) {
+			// Break out of the loop once we have exceeded the Expected Visible Console Viewport.
+			if (menuOptionLines >= maxMenuLines)
+				break;
+
+			// The current `MenuOption` being formatted.
+			const MenuOption& menuOption = menuOptions[i];
+
+			// Add Top Padding for the Current `MenuOption` if applicable.
+			if ( menuOption.padding.top && i > topMenuOptionNum && menuOptionLines < maxMenuLines ) {
+				rows.push_back(spaceStr);
+				menuOptionLines++;
+			}
+
+			// Add the contents of the `MenuOption`.
+			if (menuOptionLines < maxMenuLines) {
+				// The cached formatted `MenuOption`, which is only formatted again if anything it depends on has changed.
+				std::optional<MenuOptionList::FormattedMenuOption>& formattedMenuOption = menuOptions.formattedMenuOptions[i];
+
+				if (
+					!formattedMenuOption
+					|| formattedMenuOption->optionNum != currentOptionHotkeyNum
+					|| formattedMenuOption->width != (unsigned short) (width - 2U)
+					|| formattedMenuOption->menuOption.disabled != menuOption.disabled
+					|| formattedMenuOption->menuOption.dimmed != menuOption.dimmed
+					|| formattedMenuOption->menuOption.hotkey != menuOption.hotkey
+					|| formattedMenuOption->menuOption.option != menuOption.option
+				) {
+					formattedMenuOption = MenuOptionList::FormattedMenuOption{
+						.menuOption = menuOption,
+						.optionNum = currentOptionHotkeyNum,
+						.width = (unsigned short) (width - 2U),
+						.contents = this->formatMenuOption(menuOption, currentOptionHotkeyNum, width - 2U)
+					};
+				}
+
+				rows.push_back(
+					std::format(
+						L"{:}{:} {:}{:}",
+						prefix,
+						( (i != selectedOptionNum) ? L' ' : L'>' ),
+						formattedMenuOption->contents,
+						suffix
+					)
+				);
+			
+				if (!menuOption.hotkey)
+					currentOptionHotkeyNum++;
+
+				menuOptionLines++;
+
+				if (i != topMenuOptionNum)
+					bottomMenuOptionNum++;
+			}
+
+			// Add Bottom Padding for the Current `MenuOption` if applicable.
+			if ( menuOption.padding.bottom && menuOptionLines < maxMenuLines ) {
+				rows.push_back(spaceStr);
+				menuOptionLines++;
+			}
+		}
+
+		menuOptions.setBottomMenuOptionNum(bottomMenuOptionNum);
+
+		// Add a Down Arrow if there are one or more `MenuOptions`
+		// currently below the Visible Console Viewport.
+		if ( bottomMenuOptionNum < (menuOptions.size() - 1ULL) ) {
+			rows.push_back( prefix + std::format(L"  {:<{}}", ARROW_DOWN, width - 2U) + suffix );
+			menuOptionLines++;
+		}
+
+		return rows;
+
+	}
+	void Console::updateMenuOptionViewport ( MenuOptionList& menuOptions, unsigned short maxLines ) const {
+
+		// A structure containing details about the Console Output Buffer returned by the Windows API.
+		CONSOLE_SCREEN_BUFFER_INFO bufferInfo = {};
+		// The fewest number of lines that can render a `MenuOption` along with both Scroll Arrows.
+		const unsigned short minLines = std::min<unsigned short>(3U, menuOptions.maxMenuOptionLines);
+		// The number of lines reserved below the `menuOptions` for their instructions and Status Message.
+		unsigned short reservedLines = (unsigned short) ( std::ranges::count(menuOptions.getInstructionString(), L'\n') + 2 );
+		// The Selected `MenuOption` number for the list of `menuOptions`
+		size_t selectedOptionNum = menuOptions.getSelectedOption() ? *menuOptions.getSelectedOption() : 0ULL;
+
+		if ( GetConsoleScreenBufferInfo(this->conOutBuf.getBufferHandle(), &bufferInfo) ) {
+			// The number of rows visible in the Console Window.
+			short windowHeight = (bufferInfo.srWindow.Bottom - bufferInfo.srWindow.Top + 1);
+
+			if (windowHeight > reservedLines)
+				maxLines = std::min<unsigned short>(maxLines, windowHeight - reservedLines);
+			else
+				maxLines = minLines;
+		}
+
+		menuOptions.viewportMenuOptionLines = std::max( std::min(maxLines, menuOptions.maxMenuOptionLines), minLines );
+
+		if ( menuOptions.empty() )
+			return;
+
+		// Scroll the `menuOptions` until the Selected `MenuOption` is within the Visible Console Viewport.
+		if (selectedOptionNum < menuOptions.topMenuOptionNum)
+			menuOptions.topMenuOptionNum = selectedOptionNum;
+
+		this->formatMenuOptionRows(menuOptions);
+
+		while ( menuOptions.bottomMenuOptionNum < selectedOptionNum && menuOptions.topMenuOptionNum < selectedOptionNum ) {
+			menuOptions.topMenuOptionNum++;
+			this->formatMenuOptionRows(menuOptions);
+		}
+
+	}
+
 }
\ No newline at end of file
@@ -7,10 +7,12 @@
 * Header File declaring the `Console` class and all associated
 * Internal and Inner Classes, including:
 *    - `Utils::AConsoleBuffer`
+*    - `Utils::VirtualTerminalSequenceScanner`
 *    - `Utils::AConsoleInput`
 *    - `Utils::AConoleOutput`
 *    - `Console::InputBuffer`
 *    - `Console::OutputBuffer`
+*    - `Console::OutputQueue`
 * 
 * The `Console` class is used frequently throughout the entire program to interact with
 * the Windows Console via reading input writing formatted output.
@@ -19,8 +21,16 @@
 
 #include "framework.h"
 
+#include <array>
+#include <atomic>
+#include <cstddef>		// std::byte, std::max_align_t
 #include <functional>	// std::function
+#include <memory>		// std::shared_ptr
+#include <mutex>
+#include <new>			// std::launder
 #include <stack>
+#include <type_traits>
+#include <utility>		// std::exchange
 #include <variant>
 
 
@@ -72,6 +82,281 @@ namespace PROGRAM_NAMESPACE {
 
 		};
 		
+		/**
+		 * An Internal Utility Class used to detect and measure the Virtual Terminal Sequences
+		 * written to the Console without the overhead of a Regular Expression.
+		 * 
+		 * Sequences are recognized by a small Deterministic State Machine whose Transition Table
+		 * is built entirely at Compile-Time, so scanning a sequence costs a single table lookup
+		 * per Wide Character and never allocates. The recognized grammar is that of the
+		 * Virtual Terminal Sequences produced by `AConsoleOutput::getVirtualTerminalSequence()`:
+		 *		- `ESC` followed by a single Word Character, `=`, or `>`.
+		 *		- `ESC ( 0` and `ESC ( B` (Character Set Designation).
+		 *		- `ESC [ !p` (Soft Reset).
+		 *		- `ESC [ ?<0-4 Digits> <Optional Space><Letter>` (Cursor, Viewport, and Mode Sequences).
+		 *		- `ESC [ <1-3 Digits>;<1-3 Digits>f` and `ESC [ <1-3 Digits>;<1-3 Digits>H` (Cursor Positioning).
+		 *		- `ESC [ 38;2;<r>;<g>;<b>m`, `ESC [ 48;5;<s>;<s>;<s>m`, etc. (Extended Text Formatting).
+		 *		- `ESC ] 4;<i>;rgb;<r>;<g>;<b> BEL` (Screen Color Modification).
+		 * 
+		 * @internal	This class and all of its associated functionality are for
+		 * 				internal use only and are subject to change at any time.
+		 */
+		class VirtualTerminalSequenceScanner {
+
+			/* Type Definitions */
+			protected:
+				// An integer type representing one of the Character Classes recognized by the Scanner.
+				typedef unsigned char char_class_t;
+				// An integer type representing one of the States of the Scanner.
+				typedef unsigned char scanner_state_t;
+
+				// The Character Classes recognized by the Scanner.
+				enum CharClass : char_class_t {
+					CHAR_OTHER, CHAR_DIGIT, CHAR_0, CHAR_2, CHAR_3, CHAR_4, CHAR_5, CHAR_8,
+					CHAR_LETTER, CHAR_B, CHAR_f, CHAR_H, CHAR_m, CHAR_p, CHAR_r, CHAR_g, CHAR_b,
+					CHAR_UNDERSCORE, CHAR_EQUALS, CHAR_GREATER_THAN, CHAR_QUESTION_MARK, CHAR_SPACE,
+					CHAR_SEMICOLON, CHAR_LEFT_BRACKET, CHAR_RIGHT_BRACKET, CHAR_LEFT_PARENTHESIS,
+					CHAR_EXCLAMATION_MARK, CHAR_BELL,
+					CHAR_CLASS_COUNT
+				};
+
+				// The States of the Scanner. Each state is named after the portion of the sequence that has been consumed.
+				enum ScannerState : scanner_state_t {
+					STATE_REJECT, STATE_ACCEPT, STATE_ESCAPE, STATE_CHARSET,
+					// Control Sequence Introducer (`ESC [`)
+					STATE_CSI, STATE_CSI_BANG, STATE_CSI_PRIVATE, STATE_CSI_SPACE,
+					STATE_CSI_D1, STATE_CSI_D1_SGR, STATE_CSI_D2, STATE_CSI_D2_SGR, STATE_CSI_D3,
+					STATE_CSI_PARAM_D1, STATE_CSI_PARAM_D2, STATE_CSI_PARAM_D3, STATE_CSI_PARAM_D4,
+					// Cursor Positioning (`ESC [ <y>;<x>H`)
+					STATE_CUP_SEMICOLON, STATE_CUP_SEMICOLON_SGR, STATE_CUP_D1, STATE_CUP_D1_SGR, STATE_CUP_D2, STATE_CUP_D3,
+					// Extended Text Formatting (`ESC [ 38;2;<r>;<g>;<b>m`)
+					STATE_SGR_RED_D0, STATE_SGR_RED_D1, STATE_SGR_RED_D2, STATE_SGR_RED_D3,
+					STATE_SGR_GREEN_D0, STATE_SGR_GREEN_D1, STATE_SGR_GREEN_D2, STATE_SGR_GREEN_D3,
+					STATE_SGR_BLUE_D0, STATE_SGR_BLUE_D1, STATE_SGR_BLUE_D2, STATE_SGR_BLUE_D3,
+					// Operating System Command (`ESC ] 4;<i>;rgb;<r>;<g>;<b> BEL`)
+					STATE_OSC, STATE_OSC_4, STATE_OSC_INDEX_D0, STATE_OSC_INDEX_D1, STATE_OSC_INDEX_D2, STATE_OSC_INDEX_D3,
+					STATE_OSC_COLOR_SPACE_R, STATE_OSC_COLOR_SPACE_G, STATE_OSC_COLOR_SPACE_B, STATE_OSC_COLOR_SPACE_END,
+					STATE_OSC_RED_D0, STATE_OSC_RED_D1, STATE_OSC_RED_D2, STATE_OSC_RED_D3,
+					STATE_OSC_GREEN_D0, STATE_OSC_GREEN_D1, STATE_OSC_GREEN_D2, STATE_OSC_GREEN_D3,
+					STATE_OSC_BLUE_D0, STATE_OSC_BLUE_D1, STATE_OSC_BLUE_D2, STATE_OSC_BLUE_D3,
+					SCANNER_STATE_COUNT
+				};
+
+				// A table mapping each ASCII Character to its `CharClass`.
+				typedef std::array<char_class_t, 128> CharClassTable;
+				// A table mapping each `ScannerState` and `CharClass` pair to the next `ScannerState`.
+				typedef std::array< std::array<scanner_state_t, CHAR_CLASS_COUNT>, SCANNER_STATE_COUNT > TransitionTable;
+
+
+			/* Class Constants */
+			protected:
+				// The Character Class of each ASCII Character, built at Compile-Time.
+				static const CharClassTable CHAR_CLASS_TABLE;
+				// The Transition Table of the Scanner, built at Compile-Time.
+				static const TransitionTable TRANSITION_TABLE;
+
+
+			/* Static Class Methods */
+			public:
+				/**
+				 * Get the length of the Virtual Terminal Sequence located at the start of a Wide-Character String.
+				 * 
+				 * @param str	A pointer to a Null-Terminated Wide-Character String whose first character
+				 * 				is expected to be a `VIRTUAL_TERMINAL_SEQUENCE_ESCAPE`.
+				 * 
+				 * @returns		The number of Wide Characters making up the Virtual Terminal Sequence,
+				 * 				including the leading Escape Sequence.
+				 * 
+				 * 				If the `str` does not begin with a recognized Virtual Terminal Sequence,
+				 * 				returns `0`.
+				 */
+				static constexpr size_t getSequenceLength ( const wchar_t* str ) noexcept {
+
+					scanner_state_t state = STATE_ESCAPE;	// The Current State of the Scanner.
+
+					if ( str == nullptr || str[0] != L'\x1B' )
+						return 0ULL;
+
+					for ( size_t strPos = 1ULL; ; strPos++ ) {
+						state = TRANSITION_TABLE[state][ getCharClass(str[strPos]) ];
+
+						if (state == STATE_ACCEPT)
+							return (strPos + 1ULL);
+						if (state == STATE_REJECT)
+							return 0ULL;
+					}
+
+				}
+
+
+			/* Helper Methods */
+			protected:
+				/**
+				 * Get the `CharClass` of the specified Wide Character.
+				 * 
+				 * @param ch	The Wide Character being classified.
+				 * 
+				 * @returns		The `CharClass` of the specified Wide Character.
+				 * 				All Non-ASCII Characters, including the Null Terminator, are classified as `CHAR_OTHER`.
+				 */
+				static constexpr char_class_t getCharClass ( wchar_t ch ) noexcept {
+
+					return ( (ch > L'\0' && ch < 128) ? CHAR_CLASS_TABLE[(size_t) ch] : (char_class_t) CHAR_OTHER );
+
+				}
+
+				/**
+				 * Build the `CHAR_CLASS_TABLE` at Compile-Time.
+				 * 
+				 * @returns		The `CharClassTable` for the Scanner.
+				 */
+				static consteval CharClassTable buildCharClassTable () {
+
+					CharClassTable table = {};
+
+					for ( char ch = '0'; ch <= '9'; ch++ )
+						table[ch] = CHAR_DIGIT;
+					for ( char ch = 'a'; ch <= 'z'; ch++ )
+						table[ch] = table[ch - 0x20] = CHAR_LETTER;
+
+					table['0'] = CHAR_0;				table['2'] = CHAR_2;
+					table['3'] = CHAR_3;				table['4'] = CHAR_4;
+					table['5'] = CHAR_5;				table['8'] = CHAR_8;
+					table['B'] = CHAR_B;				table['f'] = CHAR_f;
+					table['H'] = CHAR_H;				table['m'] = CHAR_m;
+					table['p'] = CHAR_p;				table['r'] = CHAR_r;
+					table['g'] = CHAR_g;				table['b'] = CHAR_b;
+					table['_'] = CHAR_UNDERSCORE;		table['='] = CHAR_EQUALS;
+					table['>'] = CHAR_GREATER_THAN;		table['?'] = CHAR_QUESTION_MARK;
+					table[' '] = CHAR_SPACE;			table[';'] = CHAR_SEMICOLON;
+					table['['] = CHAR_LEFT_BRACKET;		table[']'] = CHAR_RIGHT_BRACKET;
+					table['('] = CHAR_LEFT_PARENTHESIS;	table['!'] = CHAR_EXCLAMATION_MARK;
+					table['\x07'] = CHAR_BELL;
+
+					return table;
+
+				}
+
+				/**
+				 * Build the `TRANSITION_TABLE` at Compile-Time.
+				 * 
+				 * Any `ScannerState` and `CharClass` pair that is not explicitly
+				 * assigned a transition leads to `STATE_REJECT`.
+				 * 
+				 * @returns		The `TransitionTable` for the Scanner.
+				 */
+				static consteval TransitionTable buildTransitionTable () {
+
+					typedef std::initializer_list<char_class_t> CharClassList;
+
+					TransitionTable table = {};
+					const CharClassList DIGITS = {
+						CHAR_DIGIT, CHAR_0, CHAR_2, CHAR_3, CHAR_4, CHAR_5, CHAR_8
+					};
+					const CharClassList LETTERS = {
+						CHAR_LETTER, CHAR_B, CHAR_f, CHAR_H, CHAR_m, CHAR_p, CHAR_r, CHAR_g, CHAR_b
+					};
+
+					// Assign the transition from the `state` for each of the specified `charClasses`.
+					auto on = [&table]( scanner_state_t state, CharClassList charClasses, scanner_state_t nextState ) {
+						for ( auto charClass : charClasses )
+							table[state][charClass] = nextState;
+					};
+					// Assign the transitions for an unsigned number of one to three digits followed by a `terminator`.
+					auto onNumber = [&on, &DIGITS]( scanner_state_t d0State, char_class_t terminator, scanner_state_t nextState ) {
+						for ( scanner_state_t i = 0U; i < 3U; i++ )
+							on(d0State + i, DIGITS, d0State + i + 1U);
+						for ( scanner_state_t i = 1U; i <= 3U; i++ )
+							on(d0State + i, { terminator }, nextState);
+					};
+					// Assign the transitions that end a Private Parameter, which is an Optional Space followed by a Letter.
+					auto onParamTerminator = [&on, &LETTERS]( scanner_state_t state ) {
+						on(state, { CHAR_SPACE }, STATE_CSI_SPACE);
+						on(state, LETTERS, STATE_ACCEPT);
+					};
+
+					// `ESC <Word Character>`, `ESC =`, and `ESC >`
+					on(STATE_ESCAPE, DIGITS, STATE_ACCEPT);
+					on(STATE_ESCAPE, LETTERS, STATE_ACCEPT);
+					on(STATE_ESCAPE, { CHAR_UNDERSCORE, CHAR_EQUALS, CHAR_GREATER_THAN }, STATE_ACCEPT);
+					// `ESC ( 0` and `ESC ( B`
+					on(STATE_ESCAPE, { CHAR_LEFT_PARENTHESIS }, STATE_CHARSET);
+					on(STATE_CHARSET, { CHAR_0, CHAR_B }, STATE_ACCEPT);
+
+					// `ESC [ !p`
+					on(STATE_ESCAPE, { CHAR_LEFT_BRACKET }, STATE_CSI);
+					on(STATE_CSI, { CHAR_EXCLAMATION_MARK }, STATE_CSI_BANG);
+					on(STATE_CSI_BANG, { CHAR_p }, STATE_ACCEPT);
+
+					// `ESC [ ?<0-4 Digits> <Optional Space><Letter>`
+					on(STATE_CSI, { CHAR_QUESTION_MARK }, STATE_CSI_PRIVATE);
+					on(STATE_CSI_PRIVATE, DIGITS, STATE_CSI_PARAM_D1);
+					on(STATE_CSI_PARAM_D1, DIGITS, STATE_CSI_PARAM_D2);
+					on(STATE_CSI_PARAM_D2, DIGITS, STATE_CSI_PARAM_D3);
+					on(STATE_CSI_PARAM_D3, DIGITS, STATE_CSI_PARAM_D4);
+					on(STATE_CSI_SPACE, LETTERS, STATE_ACCEPT);
+
+					for ( auto state : { STATE_CSI, STATE_CSI_PRIVATE, STATE_CSI_PARAM_D1, STATE_CSI_PARAM_D2, STATE_CSI_PARAM_D3, STATE_CSI_PARAM_D4 } )
+						onParamTerminator(state);
+
+					// Leading digits are shared between Private Parameters, Cursor Positioning, and Extended Text Formatting.
+					on(STATE_CSI, DIGITS, STATE_CSI_D1);
+					on(STATE_CSI, { CHAR_3, CHAR_4 }, STATE_CSI_D1_SGR);
+					on(STATE_CSI_D1, DIGITS, STATE_CSI_D2);
+					on(STATE_CSI_D1_SGR, DIGITS, STATE_CSI_D2);
+					on(STATE_CSI_D1_SGR, { CHAR_8 }, STATE_CSI_D2_SGR);
+					on(STATE_CSI_D2, DIGITS, STATE_CSI_D3);
+					on(STATE_CSI_D2_SGR, DIGITS, STATE_CSI_D3);
+					on(STATE_CSI_D3, DIGITS, STATE_CSI_PARAM_D4);
+
+					for ( auto state : { STATE_CSI_D1, STATE_CSI_D1_SGR, STATE_CSI_D2, STATE_CSI_D2_SGR, STATE_CSI_D3 } ) {
+						onParamTerminator(state);
+						on(state, { CHAR_SEMICOLON }, STATE_CUP_SEMICOLON);
+					}
+
+					// `ESC [ <1-3 Digits>;<1-3 Digits>f` and `ESC [ <1-3 Digits>;<1-3 Digits>H`
+					on(STATE_CSI_D2_SGR, { CHAR_SEMICOLON }, STATE_CUP_SEMICOLON_SGR);
+					on(STATE_CUP_SEMICOLON, DIGITS, STATE_CUP_D1);
+					on(STATE_CUP_SEMICOLON_SGR, DIGITS, STATE_CUP_D1);
+					on(STATE_CUP_SEMICOLON_SGR, { CHAR_2, CHAR_5 }, STATE_CUP_D1_SGR);
+					on(STATE_CUP_D1, DIGITS, STATE_CUP_D2);
+					on(STATE_CUP_D1_SGR, DIGITS, STATE_CUP_D2);
+					on(STATE_CUP_D2, DIGITS, STATE_CUP_D3);
+
+					for ( auto state : { STATE_CUP_D1, STATE_CUP_D1_SGR, STATE_CUP_D2, STATE_CUP_D3 } )
+						on(state, { CHAR_f, CHAR_H }, STATE_ACCEPT);
+
+					// `ESC [ 38;2;<r>;<g>;<b>m`
+					on(STATE_CUP_D1_SGR, { CHAR_SEMICOLON }, STATE_SGR_RED_D0);
+					onNumber(STATE_SGR_RED_D0, CHAR_SEMICOLON, STATE_SGR_GREEN_D0);
+					onNumber(STATE_SGR_GREEN_D0, CHAR_SEMICOLON, STATE_SGR_BLUE_D0);
+					onNumber(STATE_SGR_BLUE_D0, CHAR_m, STATE_ACCEPT);
+
+					// `ESC ] 4;<i>;rgb;<r>;<g>;<b> BEL`
+					on(STATE_ESCAPE, { CHAR_RIGHT_BRACKET }, STATE_OSC);
+					on(STATE_OSC, { CHAR_4 }, STATE_OSC_4);
+					on(STATE_OSC_4, { CHAR_SEMICOLON }, STATE_OSC_INDEX_D0);
+					onNumber(STATE_OSC_INDEX_D0, CHAR_SEMICOLON, STATE_OSC_COLOR_SPACE_R);
+					on(STATE_OSC_COLOR_SPACE_R, { CHAR_r }, STATE_OSC_COLOR_SPACE_G);
+					on(STATE_OSC_COLOR_SPACE_G, { CHAR_g }, STATE_OSC_COLOR_SPACE_B);
+					on(STATE_OSC_COLOR_SPACE_B, { CHAR_b }, STATE_OSC_COLOR_SPACE_END);
+					on(STATE_OSC_COLOR_SPACE_END, { CHAR_SEMICOLON }, STATE_OSC_RED_D0);
+					onNumber(STATE_OSC_RED_D0, CHAR_SEMICOLON, STATE_OSC_GREEN_D0);
+					onNumber(STATE_OSC_GREEN_D0, CHAR_SEMICOLON, STATE_OSC_BLUE_D0);
+					onNumber(STATE_OSC_BLUE_D0, CHAR_BELL, STATE_ACCEPT);
+
+					return table;
+
+				}
+
+		};
+
+		inline constexpr VirtualTerminalSequenceScanner::CharClassTable
+		VirtualTerminalSequenceScanner::CHAR_CLASS_TABLE = VirtualTerminalSequenceScanner::buildCharClassTable();
+
+		inline constexpr VirtualTerminalSequenceScanner::TransitionTable
+		VirtualTerminalSequenceScanner::TRANSITION_TABLE = VirtualTerminalSequenceScanner::buildTransitionTable();
+		
 		/**
 		 * An Internal, Abstract, Template Class providing an interface
 		 * for writing formatted output to the Windows Console.
@@ -161,6 +446,41 @@ namespace PROGRAM_NAMESPACE {
 				virtual buffer_number_t restorePreviousBuffer () = 0;
 
 
+				// Frame Management
+
+				/**
+				 * Begin a new Output Frame.
+				 * 
+				 * Until the matching call to `commitFrame()`, all output written to the Current Output Buffer
+				 * is assembled into a single contiguous Wide-Character String and the Position of the Console Cursor
+				 * is tracked locally instead of being queried from the Windows API, allowing an entire screen to be
+				 * drawn without flickering.
+				 * 
+				 * Frames may be nested, in which case the output is only written to the console
+				 * once the outermost frame has been committed.
+				 * 
+				 * @returns		A reference to this object to support method chaining.
+				 */
+				virtual ThisT& beginFrame () = 0;
+				/**
+				 * Commit the Current Output Frame that was started by a previous call to `beginFrame()`,
+				 * writing all of the assembled output to the Current Output Buffer at once.
+				 * 
+				 * If there is no Output Frame currently in progress, this method has no effect.
+				 * 
+				 * @returns		A reference to this object to support method chaining.
+				 */
+				virtual ThisT& commitFrame () = 0;
+				/**
+				 * Determine whether or not an Output Frame is currently in progress.
+				 * 
+				 * @returns		`true` if `beginFrame()` has been called more times than `commitFrame()`.
+				 * 
+				 * 				Otherwise, returns `false`.
+				 */
+				virtual bool isFrameActive () const = 0;
+
+
 				// Cursor Position Management
 
 				/**
@@ -1522,8 +1842,258 @@ namespace PROGRAM_NAMESPACE {
 					typedef std::vector<WinConsoleCursorCoordinates> CursorPositionStack;
 
 
-				/* Inner Structure Types */
+				/* Inner Classes & Structure Types */
 				protected:
+					/**
+					 * An Inner Class storing the printed contents of an Output Buffer of the underlying Windows Console.
+					 * 
+					 * Rather than allocating a separate Wide-Character String and Cursor Offset Array for every row,
+					 * all of the rows share a single contiguous Character Arena and a single contiguous Cursor Offset Arena,
+					 * with each row being described by a `RowSpan` within the Row Index.
+					 * 
+					 * A row that outgrows its reserved capacity is relocated to the end of the arenas,
+					 * and the arenas are compacted once the space left behind by relocated rows
+					 * exceeds the space being used.
+					 * 
+					 * @internal	This class and all of its associated functionality are for
+			 		 * 				internal use only and are subject to change at any time.
+					 */
+					class BufferContents {
+
+						/* Type Definitions */
+						public:
+							/**
+							 * An unsigned integer type representing an index or length within one of the arenas.
+							 * 
+							 * A 32-bit type is used over `size_t` to halve the size of each Cursor Offset.
+							 */
+							typedef uint32_t offset_t;
+
+							/**
+							 * A structure type describing the location of a single row within the arenas.
+							 */
+							typedef struct RowSpanStruct {
+
+								offset_t charStart = 0U;		// The index of the first Wide Character of the row in the Character Arena.
+								offset_t charCount = 0U;		// The number of Wide Characters in the row.
+								offset_t charCapacity = 0U;		// The number of Wide Characters reserved for the row.
+
+								offset_t cursorStart = 0U;		// The index of the first Cursor Offset of the row in the Cursor Offset Arena.
+								offset_t cursorCount = 0U;		// The number of Cursor Offsets in the row.
+								offset_t cursorCapacity = 0U;	// The number of Cursor Offsets reserved for the row.
+
+							} RowSpan;
+
+
+						/* Class Constants */
+						public:
+							// The minimum number of elements reserved for a row when it grows.
+							static constexpr offset_t MIN_ROW_CAPACITY = 16U;
+
+
+						/* Instance Properties */
+						private:
+							/**
+							 * The Character Arena containing the Wide Characters of every row.
+							 */
+							std::vector<wchar_t> chars = {};
+							/**
+							 * The Cursor Offset Arena containing the index of the Wide Character of each row
+							 * corresponding to the Console Cursor Position at each point.
+							 * 
+							 * In other words, a Console Cursor Position of `(2, 1)` corresponds to
+							 * the Wide Character of row `1` located at the index specified by the
+							 * Cursor Offset at Index `2` of row `1`.
+							 * 
+							 * This mechanism makes it possible to "jump" over Virtual Terminal Sequences
+							 * and match the Cursor Position returned by the Windows API to the proper
+							 * character in the row.
+							 */
+							std::vector<offset_t> cursorOffsets = {};
+							// The Row Index describing the location of each row within the arenas.
+							std::vector<RowSpan> rows = {};
+
+							size_t unusedChars = 0ULL;			// The number of elements of the Character Arena left behind by relocated rows.
+							size_t unusedCursorOffsets = 0ULL;	// The number of elements of the Cursor Offset Arena left behind by relocated rows.
+
+
+						/* Instance Methods */
+						public:
+							/**
+							 * Get the number of rows in the `BufferContents`.
+							 * 
+							 * @returns	The number of rows in the `BufferContents`.
+							 */
+							size_t size () const;
+							/**
+							 * Determine if the `BufferContents` does not contain any rows.
+							 * 
+							 * @returns	`true` if the `BufferContents` does not contain any rows, otherwise `false`.
+							 */
+							bool empty () const;
+							/**
+							 * Remove all of the rows from the `BufferContents`.
+							 * 
+							 * The capacity of the arenas is retained.
+							 */
+							void clear ();
+							/**
+							 * Ensure the `BufferContents` contains at least the specified number of rows,
+							 * adding empty rows as needed.
+							 * 
+							 * @param rowCount	The minimum number of rows the `BufferContents` should contain.
+							 */
+							void ensureRows ( size_t rowCount );
+
+							/**
+							 * Get the Wide Characters of the specified row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * 
+							 * @returns			An `std::wstring_view` of the Wide Characters of the row,
+							 * 					which is invalidated whenever the `BufferContents` is modified.
+							 */
+							std::wstring_view getRow ( size_t rowNum ) const;
+							/**
+							 * Get the number of Wide Characters in the specified row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * 
+							 * @returns			The number of Wide Characters in the row.
+							 */
+							size_t getRowLength ( size_t rowNum ) const;
+							/**
+							 * Append a Wide Character to the end of the specified row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * @param wchar		The Wide Character being appended.
+							 */
+							void appendChar ( size_t rowNum, wchar_t wchar );
+							/**
+							 * Replace a Wide Character of the specified row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * @param charPos	The index of the Wide Character within the row.
+							 * @param wchar		The new Wide Character.
+							 */
+							void setChar ( size_t rowNum, size_t charPos, wchar_t wchar );
+							/**
+							 * Erase a range of Wide Characters from the specified row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * @param charPos	The index of the first Wide Character being erased.
+							 * @param count		The number of Wide Characters being erased.
+							 * 
+							 * 					Defaults to erasing all of the Wide Characters
+							 * 					from the `charPos` to the end of the row.
+							 */
+							void eraseChars ( size_t rowNum, size_t charPos, size_t count = std::wstring::npos );
+
+							/**
+							 * Get the number of Cursor Offsets in the specified row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * 
+							 * @returns			The number of Cursor Offsets in the row.
+							 */
+							size_t getCursorOffsetCount ( size_t rowNum ) const;
+							/**
+							 * Get a Cursor Offset of the specified row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * @param cursorX	The Horizontal Console Cursor Position corresponding to the Cursor Offset.
+							 * 
+							 * @returns			The index of the Wide Character in the row corresponding to the `cursorX`.
+							 */
+							size_t getCursorOffset ( size_t rowNum, size_t cursorX ) const;
+							/**
+							 * Append a Cursor Offset to the end of the specified row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * @param offset	The index of the Wide Character in the row corresponding to the new Cursor Offset.
+							 */
+							void appendCursorOffset ( size_t rowNum, size_t offset );
+							/**
+							 * Shift the Cursor Offsets of the specified row towards the start of the row,
+							 * typically after Wide Characters have been erased from the row.
+							 * 
+							 * @param rowNum	The index of the row.
+							 * @param cursorX	The Horizontal Console Cursor Position of the first Cursor Offset being shifted.
+							 * @param distance	The number of Wide Characters each Cursor Offset is shifted by.
+							 */
+							void shiftCursorOffsets ( size_t rowNum, size_t cursorX, size_t distance );
+
+							/**
+							 * Join all of the rows into a single Wide-Character String.
+							 * 
+							 * @param separator	The Wide Character inserted between each row.
+							 * 
+							 * @returns			A Wide-Character String containing all of the rows.
+							 */
+							std::wstring join ( wchar_t separator ) const;
+
+
+						/* Helper Methods */
+						private:
+							/**
+							 * Ensure the Character Arena has room for the specified number of Wide Characters in a row,
+							 * relocating the row to the end of the Character Arena if necessary.
+							 * 
+							 * @param row		The `RowSpan` of the row.
+							 * @param required	The number of Wide Characters the row must be able to hold.
+							 */
+							void reserveChars ( RowSpan& row, size_t required );
+							/**
+							 * Ensure the Cursor Offset Arena has room for the specified number of Cursor Offsets in a row,
+							 * relocating the row to the end of the Cursor Offset Arena if necessary.
+							 * 
+							 * @param row		The `RowSpan` of the row.
+							 * @param required	The number of Cursor Offsets the row must be able to hold.
+							 */
+							void reserveCursorOffsets ( RowSpan& row, size_t required );
+							/**
+							 * Rebuild the arenas without the space left behind by relocated rows.
+							 */
+							void compact ();
+
+					};
+
+					/**
+					 * A structure type containing a copy of the cells of the underlying Console Output Buffer
+					 * occupied by an Output Buffer, which is taken when an Alternate Output Buffer is created over it.
+					 * 
+					 * Restoring the Snapshot writes the cells back using `WriteConsoleOutputW()`, rather than
+					 * replaying the `contents` of the Output Buffer through `print()`, so that the cost of closing
+					 * an Alternate Output Buffer does not depend on how much output is underneath it.
+					 * 
+					 * @internal	This structure type and all of its associated functionality are for
+			 		 * 				internal use only and are subject to change at any time.
+					 */
+					typedef struct BufferSnapshotStruct {
+
+						/**
+						 * The maximum number of cells read or written by a single call to `ReadConsoleOutputW()` or
+						 * `WriteConsoleOutputW()`, as the Windows Console rejects blocks that are too large.
+						 */
+						static constexpr size_t MAX_BLOCK_CELLS = 8192ULL;
+
+						// The cells of the Snapshot, row by row.
+						std::vector<CHAR_INFO> cells = {};
+						// The number of columns and rows in the Snapshot.
+						WinConsoleCursorCoordinates size = {
+							.X = 0,
+							.Y = 0
+						};
+						// The Position of the Console Cursor, relative to the Cursor Starting Position of the Output Buffer.
+						WinConsoleCursorCoordinates cursorPos = {
+							.X = 0,
+							.Y = 0
+						};
+						// The Text Attributes of the underlying Console Output Buffer.
+						WORD textAttributes = 0U;
+
+					} BufferSnapshot;
+
 					/**
 					 * A structure type containing all of the data and information
 					 * associated with an Output Buffer of the underlying Windows Console.
@@ -1546,21 +2116,14 @@ namespace PROGRAM_NAMESPACE {
 						 * 
 						 * Generally only used when `programSettings.useCustomBufferBehavior` is `true`.
 						 */
-						std::vector<std::wstring> contents = {};
+						BufferContents contents = {};
 						/**
-						 * A Three-Dimensional Dynamic Array containing the index of the character
-						 * in a Wide-Character String of the `contents` array corresponding to the
-						 * Console Cursor Position at each point.
-						 * 
-						 * In other words, a Console Cursor Position of `(2, 1)` corresponds to
-						 * the Wide Character located at the index specified by the element located
-						 * at Index `2` of the Dynamic Array at Index `1` of `contentsCursorData`.
+						 * The Snapshot of the cells occupied by the Output Buffer, which is taken when an Alternate Output Buffer
+						 * is created over it and restored once that Alternate Output Buffer is closed.
 						 * 
-						 * This mechanism makes it possible to "jump" over Virtual Terminal Sequences
-						 * and match the Cursor Position returned by the Windows API to the proper
-						 * character in the `contents` buffer.
+						 * Generally only used when `programSettings.useCustomBufferBehavior` is `true`.
 						 */
-						std::vector< std::vector<size_t> > contentsCursorData = {};
+						std::optional<BufferSnapshot> snapshot = {};
 
 						// The Saved Cursor Position Stack
 						CursorPositionStack savedCursors = {};
@@ -1576,11 +2139,55 @@ namespace PROGRAM_NAMESPACE {
 
 					} BufferData;
 
+					/**
+					 * A structure type containing the state of the Output Frame
+					 * currently being assembled by the `OutputBuffer`, if any.
+					 * 
+					 * @internal	This structure type and all of its associated functionality are for
+			 		 * 				internal use only and are subject to change at any time.
+					 */
+					typedef struct FrameDataStruct {
+
+						/**
+						 * The output assembled since the Output Frame was started, which is
+						 * written to the console all at once when the Output Frame is committed.
+						 * 
+						 * The capacity of the string is retained between Output Frames.
+						 */
+						std::wstring contents = {};
+						// The number of Output Frames currently in progress, to support nested Output Frames.
+						unsigned short depth = 0U;
+						// The Position of the Console Cursor, tracked locally while an Output Frame is in progress.
+						WinConsoleCursorCoordinates cursorPos = {
+							.X = 0,
+							.Y = 0
+						};
+						// The size of the Console Output Buffer when the Output Frame was started.
+						WinConsoleCursorCoordinates bufferSize = {
+							.X = 0,
+							.Y = 0
+						};
+						// The maximum width of the Console Window when the Output Frame was started.
+						short maxWindowWidth = 0;
+						/**
+						 * The visible viewport of the Console Output Buffer when the Output Frame was started,
+						 * which is used to reposition the Console Cursor within the Output Frame itself.
+						 */
+						SMALL_RECT window = {
+							.Left = 0,
+							.Top = 0,
+							.Right = 0,
+							.Bottom = 0
+						};
+
+					} FrameData;
+
 
 				/* Instance Properties */
 				private:
 					mutable BufferData mainBufferData;				// Buffer Data for the Main Console Output Buffer.
 					mutable std::stack<BufferData> altBufferData;	// Alternate Output Buffer Data Stack
+					mutable FrameData frameData;					// The state of the Current Output Frame.
 
 
 				/* Class Constructors & Destructors */
@@ -1654,6 +2261,41 @@ namespace PROGRAM_NAMESPACE {
 					virtual buffer_number_t restorePreviousBuffer () override;
 
 
+					// Frame Management
+
+					/**
+					 * Begin a new Output Frame.
+					 * 
+					 * Until the matching call to `commitFrame()`, all output written to the Current Output Buffer
+					 * is assembled into a single contiguous Wide-Character String and the Position of the Console Cursor
+					 * is tracked locally instead of being queried from the Windows API, allowing an entire screen to be
+					 * drawn without flickering.
+					 * 
+					 * Frames may be nested, in which case the output is only written to the console
+					 * once the outermost frame has been committed.
+					 * 
+					 * @returns		A reference to this object to support method chaining.
+					 */
+					virtual OutputBuffer& beginFrame () override;
+					/**
+					 * Commit the Current Output Frame that was started by a previous call to `beginFrame()`,
+					 * writing all of the assembled output to the Current Output Buffer at once.
+					 * 
+					 * If there is no Output Frame currently in progress, this method has no effect.
+					 * 
+					 * @returns		A reference to this object to support method chaining.
+					 */
+					virtual OutputBuffer& commitFrame () override;
+					/**
+					 * Determine whether or not an Output Frame is currently in progress.
+					 * 
+					 * @returns		`true` if `beginFrame()` has been called more times than `commitFrame()`.
+					 * 
+					 * 				Otherwise, returns `false`.
+					 */
+					virtual bool isFrameActive () const override;
+
+
 					// Cursor Position Management
 
 					/**
@@ -1682,6 +2324,11 @@ namespace PROGRAM_NAMESPACE {
 					/**
 					 * Set the Position of the Console Cursor.
 					 * 
+					 * While an Output Frame is in progress, positions within the visible viewport of the Output Frame
+					 * are reached by adding a Cursor Positioning Virtual Terminal Sequence (`ESC [ <Row> ; <Column> H`)
+					 * to the Output Frame, so that it is still written to the console all at once. The Output Frame
+					 * is only flushed first when the new or current Position of the Console Cursor lies outside of it.
+					 * 
 					 * @param cursorPos A `WinConsoleCursorCoordinates` structure containing the Cartesian Coordinates
 					 *					corresponding to the new Position of the Console Cursor, relative
 					 *					to the visible viewport of the Console.
@@ -1824,6 +2471,46 @@ namespace PROGRAM_NAMESPACE {
 					 */
 					Console::OutputBuffer& synchronizeCursorVisibility ( bool cursorIsVisible, bool addToBuffer = true );
 
+					/**
+					 * Take a Snapshot of the cells of the underlying Console Output Buffer occupied by the Current Output Buffer,
+					 * from its Cursor Starting Position to the last of its `contents` or the Console Cursor, whichever is lower.
+					 * 
+					 * No Snapshot is stored if the cells could not be read, in which case
+					 * the `contents` of the Current Output Buffer are replayed instead.
+					 * 
+					 * @param bufferData	The `BufferData` of the Current Output Buffer, which receives the Snapshot.
+					 */
+					void takeSnapshot ( BufferData& bufferData ) const;
+					/**
+					 * Restore the Snapshot of the cells occupied by the Current Output Buffer,
+					 * along with the Position of the Console Cursor and the Text Attributes.
+					 * 
+					 * The Snapshot is discarded whether or not it could be restored.
+					 * 
+					 * @param bufferData	The `BufferData` of the Current Output Buffer.
+					 * 
+					 * @returns				`true` if the Snapshot was restored. `false` if there is no Snapshot,
+					 * 						or if it no longer fits the underlying Console Output Buffer,
+					 * 						such as after the Console Window has been resized.
+					 */
+					bool restoreSnapshot ( BufferData& bufferData );
+
+					/**
+					 * Write any output assembled by the Current Output Frame to the Current Output Buffer
+					 * without ending the Output Frame.
+					 * 
+					 * This method is invoked whenever the Current Output Buffer is switched while an Output Frame is in progress,
+					 * or the Console Cursor is repositioned outside of the visible viewport of the Output Frame,
+					 * since the assembled output must be written at the Position of the Console Cursor from which it was printed.
+					 * 
+					 * @param synchronizeCursor	Indicates whether the locally-tracked Position of the Console Cursor
+					 * 							and the size of the Console Output Buffer should be reloaded from
+					 * 							the Windows API after the output has been written.
+					 * 
+					 * @returns					A reference to this object to support method chaining.
+					 */
+					const Console::OutputBuffer& flushFrame ( bool synchronizeCursor = false ) const;
+
 			};
 
 			/**
@@ -1845,8 +2532,8 @@ namespace PROGRAM_NAMESPACE {
 
 				/* Class Constants */
 				protected:
-					// The maximum number of Console Input Records to retrieve from 
-					// the Windows API and store in an internal buffer for reading.
+					// The maximum number of Console Input Records to retrieve from the Windows API in a single call.
+					// All available Console Input Records are still drained at once, using as many calls as needed.
 					static const DWORD MAX_INPUT_EVENT_BUFFER_SIZE;
 
 
@@ -1866,13 +2553,55 @@ namespace PROGRAM_NAMESPACE {
 					using AConsoleInput::waitForInputData;
 
 
+				/* Instance Methods */
+				public:
+					/**
+					 * Wait for the user to interact with the console, or for the Console Screen Buffer to be resized.
+					 * 
+					 * Every Console Input Record available in the underlying Console Input Buffer is drained at once.
+					 * Consecutive Key Down Events for the `UP` and `DOWN` Navigation Keys are merged into a single
+					 * Key Down Event, whose `wRepeatCount` is the net number of steps to move in the direction of its key.
+					 * Consecutive Navigation Keys in opposite directions cancel each other out.
+					 * 
+					 * @param flushBuffer		Indicates whether the underlying Input Buffers should be flushed
+					 *							prior to attempting to retrieve any input from the console.
+					 * 
+					 * @param maxWaitTime		The maximum amount of time to wait for input in milliseconds.
+					 * 
+					 * 							Specifying `INFINITE_WAIT_TIME` will cause this method to block and
+					 * 							wait indefinitely for the user to interact with the console.
+					 * 
+					 * @param oBufferResized	Set to `true` if the Console Screen Buffer was resized since the last call,
+					 * 							in which case an empty `std::optional` object is returned before any of
+					 * 							the pending input. Otherwise, set to `false`.
+					 * 
+					 * @param wakeEvent			An optional Event Object that, when signaled, causes this method to
+					 * 							return an empty `std::optional` object without waiting for any input.
+					 * 
+					 * @returns					On success, returns a `WinConsoleInputKey` structure representing the
+					 * 							input provided to the console by the user, wrapped in an `std::optional` object.
+					 * 
+					 * 							If the `maxWaitTime` is reached before the user interacts with
+					 * 							or provides valid input to the console, if the Console Screen Buffer
+					 * 							was resized, or if the `wakeEvent` was signaled,
+					 * 							an empty `std::optional` object will be returned.
+					 */
+					std::optional<WinConsoleInputKey> waitForInputEvent (
+						bool flushBuffer,
+						DWORD maxWaitTime,
+						_Out_ bool& oBufferResized,
+						HANDLE wakeEvent = NULL
+					) const;
+
+
 				/* Implemented Instance Methods */
 				public:
 					/** 
 					 * Wait for the user to interact with and provide input to the console.
 					 * 
 					 * This method will block until the user interacts with the console and
-					 * triggers a valid Console Input Event to be emitted.
+					 * triggers a valid Console Input Event to be emitted. Navigation Keys are
+					 * coalesced as described by `waitForInputEvent()`, and Buffer Resize Events are ignored.
 					 * 
 					 * @param flushBuffer	Indicates whether the underlying Input Buffers should be flushed
 					 *						prior to attempting to retrieve any input from the console.
@@ -1923,6 +2652,118 @@ namespace PROGRAM_NAMESPACE {
 
 			};
 
+			/**
+			 * An Inner Class providing a lock-free, bounded, multi-producer single-consumer queue
+			 * of preformatted output records that have been posted to the `Console` using `Console::post()`.
+			 * 
+			 * Any number of threads may push records onto the `OutputQueue` at the same time without ever
+			 * blocking on a lock, while only the thread that owns the `Console` pops them off again.
+			 * Records are popped in the same order in which they were pushed. If the `OutputQueue` is full,
+			 * the record being pushed is dropped instead of waiting for space to become available,
+			 * and the number of dropped records is reported the next time the `OutputQueue` is drained.
+			 * 
+			 * @internal	This class and all of its associated functionality are for
+			 * 				internal use only and are subject to change at any time.
+			 */
+			class OutputQueue {
+
+				/* Type Definitions */
+				public:
+					/**
+					 * A structure type representing a preformatted record posted to the `Console`.
+					 */
+					typedef struct OutputRecordStruct {
+
+						std::wstring contents = {};		// The preformatted contents of the record, excluding the Line Terminator.
+						bool isError = false;			// Indicates if the record is printed to the Error Output Buffer.
+
+					} OutputRecord;
+
+				protected:
+					/**
+					 * A structure type representing a single slot of the `OutputQueue`.
+					 * 
+					 * The `sequence` of a slot is equal to the position of the next record that can be pushed to it,
+					 * and is advanced by one once that record has been pushed, and by `CAPACITY` once it has been popped,
+					 * so that a slot is never read before a record has been pushed to it or written before it has been popped.
+					 */
+					typedef struct SlotStruct {
+
+						std::atomic<size_t> sequence = 0ULL;	// The sequence number of the slot.
+						OutputRecord record = {};				// The record stored in the slot.
+
+					} Slot;
+
+
+				/* Class Constants */
+				public:
+					// The maximum number of records that can be waiting in the `OutputQueue` at once, which must be a power of two.
+					static constexpr size_t CAPACITY = 256ULL;
+
+
+				/* Instance Properties */
+				private:
+					std::array<Slot, CAPACITY> slots = {};							// The slots of the Ring Buffer.
+					std::atomic<size_t> pushPos = 0ULL;								// The position of the next record being pushed.
+					size_t popPos = 0ULL;											// The position of the next record being popped, which is only used by the consumer.
+					std::atomic<size_t> droppedCount = 0ULL;						// The number of records dropped since the `OutputQueue` was last drained.
+					HANDLE postEvent = CreateEventW(NULL, FALSE, FALSE, NULL);		// An Event Object signaled whenever a record is pushed.
+
+
+				/* Class Constructors & Destructors */
+				public:
+					/**
+					 * Construct a new, empty `OutputQueue`.
+					 */
+					OutputQueue ();
+					OutputQueue ( const OutputQueue& ) = delete;
+					OutputQueue& operator= ( const OutputQueue& ) = delete;
+
+					/**
+					 * Destroy the `OutputQueue`, closing its Event Object.
+					 */
+					~OutputQueue ();
+
+
+				/* Instance Methods */
+				public:
+					/**
+					 * Push a record onto the `OutputQueue`.
+					 * 
+					 * May be called from any thread, and never blocks.
+					 * 
+					 * @param record	The record being pushed.
+					 * 
+					 * @returns			`true` if the record was pushed, or `false` if the `OutputQueue`
+					 * 					was full and the record was dropped.
+					 */
+					bool push ( OutputRecord&& record );
+					/**
+					 * Pop the oldest record off of the `OutputQueue`.
+					 * 
+					 * Must only be called from the thread that owns the `Console`.
+					 * 
+					 * @param oRecord	Receives the record that was popped.
+					 * 
+					 * @returns			`true` if a record was popped, or `false` if the `OutputQueue` was empty.
+					 */
+					bool pop ( _Out_ OutputRecord& oRecord );
+					/**
+					 * Get and reset the number of records that have been dropped because the `OutputQueue` was full.
+					 * 
+					 * @returns		The number of records dropped since this method was last called.
+					 */
+					size_t takeDroppedCount ();
+					/**
+					 * Get the Event Object signaled whenever a record is pushed.
+					 * 
+					 * @returns		The handle to the Event Object, which is `NULL`
+					 * 				if it could not be created.
+					 */
+					HANDLE getPostEvent () const;
+
+			};
+
 			/**
 			 * A structure type representing a Selectable Option in an Interative Console Menu.
 			 */
@@ -1958,6 +2799,7 @@ namespace PROGRAM_NAMESPACE {
 					std::optional<wchar_t> hotkey;	// An optional Wide-Character Hotkey associated with the Menu Option.
 					bool disabled;					// Indicates whether or not the Menu Option is currently disabled.
 					MenuOptionPadding padding;		// A `MenuOptionPadding` structure containing the padding information for the Menu Option.
+					bool dimmed = false;			// Indicates whether the Menu Option is printed in a gray color while remaining selectable.
 
 
 				/* Structure Constructors */
@@ -2026,8 +2868,13 @@ namespace PROGRAM_NAMESPACE {
 							 */
 							typedef std::pair<bool, bool> InputProcessingResult;
 							/**
-							 * The Function Signature of the Action Callback Function,
-							 * which is used to process and handle Console Input.
+							 * A class storing the Action Callback Function used to process and handle Console Input.
+							 * 
+							 * Function Pointers, and lambda functions whose captures fit within `INLINE_STORAGE_SIZE` bytes,
+							 * are stored directly within the `ActionCallbackFunction`, so that creating, copying, and invoking it
+							 * never allocates. Larger callable objects are stored on the heap instead, like with an `std::function`.
+							 * 
+							 * The Action Callback Function is invoked with the following arguments:
 							 * 
 							 * @param key					A `WinConsoleInputKey` structure representing the Console Input being processed.
 							 * @param menuOptions			A reference to the `MenuOptionList` being processed.
@@ -2035,14 +2882,281 @@ namespace PROGRAM_NAMESPACE {
 							 * @param currentSelectionNum	The optional Current Selection Number indicating which 
 							 *								`MenuOption` is currently selected, if any.
 							 * 
-							 * @returns						An `InputProcessingResult`.
+							 * And returns an `InputProcessingResult`.
 							 */
-							typedef std::function< InputProcessingResult (
-								const WinConsoleInputKey&,
-								MenuOptionList&,
-								Console&,
-								std::optional<size_t>&
-							) > ActionCallbackFunction;
+							class ActionCallbackFunction {
+
+								/* Type Definitions */
+								private:
+									// The operations performed on the Stored Callable Object by its `ManageFunction`.
+									enum class StorageOperation { COPY, MOVE, DESTROY };
+
+									// The Function Signature used to invoke the Stored Callable Object.
+									typedef InputProcessingResult (*InvokeFunction) (
+										void*,
+										const WinConsoleInputKey&,
+										MenuOptionList&,
+										Console&,
+										std::optional<size_t>&
+									);
+									// The Function Signature used to copy, move, or destroy the Stored Callable Object.
+									typedef void (*ManageFunction) ( StorageOperation, void*, void* );
+
+
+								/* Class Constants */
+								public:
+									// The maximum size of a callable object stored directly within an `ActionCallbackFunction`, in bytes.
+									static constexpr size_t INLINE_STORAGE_SIZE = 8ULL * sizeof(void*);
+
+								private:
+									/**
+									 * Indicates if a callable object of the specified type is
+									 * stored directly within the `ActionCallbackFunction`.
+									 * 
+									 * @tparam CallableT	The type of the callable object.
+									 */
+									template <typename CallableT>
+									static constexpr bool IS_STORED_INLINE = (
+										   sizeof(CallableT) <= INLINE_STORAGE_SIZE
+										&& alignof(CallableT) <= alignof(std::max_align_t)
+										&& std::is_nothrow_move_constructible_v<CallableT>
+									);
+
+
+								/* Instance Properties */
+								private:
+									alignas(std::max_align_t)
+									mutable std::byte storage[INLINE_STORAGE_SIZE] = {};	// The Stored Callable Object, or a pointer to the Stored Callable Object on the heap.
+									InvokeFunction invokeFn = nullptr;						// The function used to invoke the Stored Callable Object, if any.
+									ManageFunction manageFn = nullptr;						// The function used to copy, move, or destroy the Stored Callable Object, if any.
+
+
+								/* Class Constructors & Destructors */
+								public:
+									/**
+									 * Construct an empty `ActionCallbackFunction`.
+									 */
+									ActionCallbackFunction () = default;
+									/**
+									 * Construct a new `ActionCallbackFunction` storing the specified callable object.
+									 * 
+									 * @tparam CallableT	The type of the callable object.
+									 * 
+									 * @param callable		The callable object, such as a Function Pointer or lambda function.
+									 */
+									template <typename CallableT>
+									requires (
+										   !std::is_same_v<std::decay_t<CallableT>, ActionCallbackFunction>
+										&& std::is_invocable_r_v<InputProcessingResult, std::decay_t<CallableT>&, const WinConsoleInputKey&, MenuOptionList&, Console&, std::optional<size_t>&>
+									)
+									ActionCallbackFunction ( CallableT&& callable ) :
+										invokeFn(&invokeCallable<std::decay_t<CallableT>>),
+										manageFn(&manageCallable<std::decay_t<CallableT>>)
+									{
+
+										typedef std::decay_t<CallableT> StoredT;	// The type of the Stored Callable Object.
+
+										if constexpr (IS_STORED_INLINE<StoredT>)
+											new (this->storage) StoredT( std::forward<CallableT>(callable) );
+										else
+											*reinterpret_cast<StoredT**>(this->storage) = new StoredT( std::forward<CallableT>(callable) );
+
+									}
+
+									ActionCallbackFunction ( const ActionCallbackFunction& other ) :
+										invokeFn(other.invokeFn),
+										manageFn(other.manageFn)
+									{
+
+										if (this->manageFn)
+											this->manageFn(StorageOperation::COPY, this->storage, other.storage);
+
+									}
+									ActionCallbackFunction ( ActionCallbackFunction&& other ) noexcept :
+										invokeFn(other.invokeFn),
+										manageFn(other.manageFn)
+									{
+
+										if (this->manageFn)
+											this->manageFn(StorageOperation::MOVE, this->storage, other.storage);
+
+										other.invokeFn = nullptr;
+										other.manageFn = nullptr;
+
+									}
+									ActionCallbackFunction& operator= ( const ActionCallbackFunction& other ) {
+
+										if (this != &other) {
+											this->reset();
+
+											if (other.manageFn)
+												other.manageFn(StorageOperation::COPY, this->storage, other.storage);
+
+											this->invokeFn = other.invokeFn;
+											this->manageFn = other.manageFn;
+										}
+
+										return *this;
+
+									}
+									ActionCallbackFunction& operator= ( ActionCallbackFunction&& other ) noexcept {
+
+										if (this != &other) {
+											this->reset();
+
+											if (other.manageFn)
+												other.manageFn(StorageOperation::MOVE, this->storage, other.storage);
+
+											this->invokeFn = std::exchange(other.invokeFn, nullptr);
+											this->manageFn = std::exchange(other.manageFn, nullptr);
+										}
+
+										return *this;
+
+									}
+
+									/**
+									 * Destroy the `ActionCallbackFunction`, along with the Stored Callable Object.
+									 */
+									~ActionCallbackFunction () {
+
+										this->reset();
+
+									}
+
+
+								/* Instance Methods */
+								public:
+									/**
+									 * Invoke the Stored Callable Object.
+									 * 
+									 * @returns		The `InputProcessingResult` returned by the Stored Callable Object,
+									 * 				or an `InputProcessingResult` of `false` values if the
+									 * 				`ActionCallbackFunction` is empty.
+									 */
+									InputProcessingResult operator() (
+										const WinConsoleInputKey& key,
+										MenuOptionList& menuOptions,
+										Console& console,
+										std::optional<size_t>& currentSelectionNum
+									) const {
+
+										if (!this->invokeFn)
+											return std::make_pair(false, false);
+
+										return this->invokeFn(this->storage, key, menuOptions, console, currentSelectionNum);
+
+									}
+									/**
+									 * Determine if the `ActionCallbackFunction` is storing a callable object.
+									 * 
+									 * @returns		`true` if a callable object is being stored, otherwise `false`.
+									 */
+									explicit operator bool () const {
+
+										return this->invokeFn != nullptr;
+
+									}
+
+								private:
+									/**
+									 * Destroy the Stored Callable Object, if any, leaving the `ActionCallbackFunction` empty.
+									 */
+									void reset () {
+
+										if (this->manageFn)
+											this->manageFn(StorageOperation::DESTROY, this->storage, nullptr);
+
+										this->invokeFn = nullptr;
+										this->manageFn = nullptr;
+
+									}
+
+									/**
+									 * Get the Stored Callable Object of the specified type.
+									 * 
+									 * @tparam CallableT	The type of the Stored Callable Object.
+									 * 
+									 * @param storage		The `storage` of the `ActionCallbackFunction`.
+									 * 
+									 * @returns				A pointer to the Stored Callable Object.
+									 */
+									template <typename CallableT>
+									static CallableT* getCallable ( void* storage ) {
+
+										if constexpr (IS_STORED_INLINE<CallableT>)
+											return std::launder( reinterpret_cast<CallableT*>(storage) );
+										else
+											return *reinterpret_cast<CallableT**>(storage);
+
+									}
+									/**
+									 * The `InvokeFunction` used for Stored Callable Objects of the specified type.
+									 * 
+									 * @tparam CallableT	The type of the Stored Callable Object.
+									 */
+									template <typename CallableT>
+									static InputProcessingResult invokeCallable (
+										void* storage,
+										const WinConsoleInputKey& key,
+										MenuOptionList& menuOptions,
+										Console& console,
+										std::optional<size_t>& currentSelectionNum
+									) {
+
+										return (*getCallable<CallableT>(storage))(key, menuOptions, console, currentSelectionNum);
+
+									}
+									/**
+									 * The `ManageFunction` used for Stored Callable Objects of the specified type.
+									 * 
+									 * @tparam CallableT	The type of the Stored Callable Object.
+									 * 
+									 * @param operation		The `StorageOperation` being performed.
+									 * @param destination	The `storage` being copied or moved to, or the `storage` being destroyed.
+									 * @param source		The `storage` being copied or moved from, if any.
+									 */
+									template <typename CallableT>
+									static void manageCallable ( StorageOperation operation, void* destination, void* source ) {
+
+										if constexpr (IS_STORED_INLINE<CallableT>) {
+											switch (operation) {
+												case StorageOperation::COPY: {
+													new (destination) CallableT( *getCallable<CallableT>(source) );
+													break;
+												}
+												case StorageOperation::MOVE: {
+													new (destination) CallableT( std::move(*getCallable<CallableT>(source)) );
+													getCallable<CallableT>(source)->~CallableT();
+													break;
+												}
+												case StorageOperation::DESTROY: {
+													getCallable<CallableT>(destination)->~CallableT();
+													break;
+												}
+											}
+										}
+										// Callable Objects stored on the heap are moved simply by transferring ownership of the pointer.
+										else {
+											switch (operation) {
+												case StorageOperation::COPY: {
+													*reinterpret_cast<CallableT**>(destination) = new CallableT( *getCallable<CallableT>(source) );
+													break;
+												}
+												case StorageOperation::MOVE: {
+													*reinterpret_cast<CallableT**>(destination) = getCallable<CallableT>(source);
+													break;
+												}
+												case StorageOperation::DESTROY: {
+													delete getCallable<CallableT>(destination);
+													break;
+												}
+											}
+										}
+
+									}
+
+							};
 
 							/**
 							 * A Collection of Wide-Character Strings representing the
@@ -2083,35 +3197,178 @@ namespace PROGRAM_NAMESPACE {
 
 					} MenuOptionListAction;
 
+					/**
+					 * A structure type representing the Default Navigation Action of every `MenuOptionList`,
+					 * which handles all basic navigation actions, including Arrow-Key Selection and `MenuOption` Hotkeys.
+					 */
+					typedef struct NavigationActionStruct {
 
-				/* Class Constants */
+						// The Human-Readable Instruction associated with the `NavigationAction`.
+						static const std::wstring_view INSTRUCTION;
+
+						/**
+						 * Process and handle Console Input for the `MenuOptionList`.
+						 * 
+						 * @see MenuOptionListAction::ActionCallbackFunction
+						 */
+						static MenuOptionListAction::InputProcessingResult process (
+							const WinConsoleInputKey& key,
+							MenuOptionList& menuOptions,
+							Console& console,
+							std::optional<size_t>& currentSelectionNum
+						);
+
+					} NavigationAction;
 
-				public:
-					/**
-					* The Default `MenuOptionListAction` responsible for handling all basic navigation actions,
-					* including Arrow-Key Selection and `MenuOption` Hotkeys.
-					* 
-					* @see DEFAULT_ESCAPE_ACTION
-					* @see DEFAULT_ACTIONS
-					*/
-					static const MenuOptionListAction DEFAULT_NAVIGATION_ACTIONS;
 					/**
-					 * The Default `MenuOptionListAction` responsible for handling basic escape actions.
+					 * A structure type representing the Default Escape Action of every `MenuOptionList`,
 					 * which simply stops further processing of the `MenuOptionList` when the `ESC` key is pressed.
+					 */
+					typedef struct EscapeActionStruct {
+
+						// The Human-Readable Instruction associated with the `EscapeAction`, unless overridden using `setEscapeInstruction()`.
+						static const std::wstring_view INSTRUCTION;
+
+						/**
+						 * Process and handle Console Input for the `MenuOptionList`.
+						 * 
+						 * @see MenuOptionListAction::ActionCallbackFunction
+						 */
+						static MenuOptionListAction::InputProcessingResult process (
+							const WinConsoleInputKey& key,
+							MenuOptionList& menuOptions,
+							Console& console,
+							std::optional<size_t>& currentSelectionNum
+						);
+
+					} EscapeAction;
+
+					/**
+					 * A structure template composing a fixed sequence of Actions at compile-time.
+					 * 
+					 * The static `process()` method of each of the `ActionsT` is called directly, in order,
+					 * until one of them indicates that processing for the current input key or `MenuOptionList`
+					 * should be halted, so that no type-erased calls are made and each call can be inlined.
+					 * 
+					 * @tparam ActionsT		The types of the Actions, each providing a static `process()` method
+					 * 						with the same signature as an Action Callback Function.
+					 */
+					template <typename... ActionsT>
+					struct ActionPipeline {
+
+						/**
+						 * Process and handle Console Input for the `MenuOptionList` using each of the `ActionsT`.
+						 * 
+						 * @see MenuOptionListAction::ActionCallbackFunction
+						 */
+						static MenuOptionListAction::InputProcessingResult process (
+							const WinConsoleInputKey& key,
+							MenuOptionList& menuOptions,
+							Console& console,
+							std::optional<size_t>& currentSelectionNum
+						) {
+
+							// The result of the last Action to process the input key.
+							MenuOptionListAction::InputProcessingResult result = std::make_pair(false, false);
+
+							( ( result = ActionsT::process(key, menuOptions, console, currentSelectionNum), result.first || result.second ) || ... );
+							return result;
+
+						}
+
+					};
+
+					/**
+					 * The `ActionPipeline` of the Default Actions of every `MenuOptionList`, which are processed
+					 * before any of the `MenuOptionListAction` objects associated with the `MenuOptionList`.
+					 */
+					typedef ActionPipeline<NavigationAction, EscapeAction> DefaultActionPipeline;
+
+				protected:
+					/**
+					 * A structure type representing a `MenuOption` as it was last formatted by `Console::formatMenuOptionRows()`.
 					 * 
-					 * @see DEFAULT_NAVIGATION_ACTIONS
-					 * @see DEFAULT_ACTIONS
+					 * The cached `contents` are reused as long as the `MenuOption` and the
+					 * Number Hotkey and Minimum Width it was formatted with remain the same.
 					 */
-					static const MenuOptionListAction DEFAULT_ESCAPE_ACTION;
+					typedef struct FormattedMenuOptionStruct {
+
+						MenuOption menuOption;		// A copy of the `MenuOption` as it was when it was formatted.
+						unsigned int optionNum;		// The Number Hotkey the `MenuOption` was formatted with.
+						unsigned short width;		// The Minimum Width the `MenuOption` was formatted with.
+						std::wstring contents;		// The formatted `MenuOption`, as returned by `Console::formatMenuOption()`.
+
+					} FormattedMenuOption;
+
+				public:
 					/**
-					 * The Default Collection of `MenuOptionListAction` objects responsible for handling all basic navigation
-					 * and escape actions, including Arrow-Key Selection, `MenuOption` Hotkeys, and halting further processing
-					 * of the `MenuOptionList` when the `ESC` key is pressed.
+					 * A class providing a thread-safe queue of updates to be applied to a `MenuOptionList`
+					 * while the user is making a selection from it using `Console::waitForSelection()`.
 					 * 
-					 * @see DEFAULT_NAVIGATION_ACTION
-					 * @see DEFAULT_ESCAPE_ACTION
+					 * As the `Console` is not thread-safe, a Background Thread cannot modify a `MenuOptionList`
+					 * that is currently being displayed. Instead, it posts an update to the `UpdateQueue` of the
+					 * `MenuOptionList`, which wakes up `Console::waitForSelection()` so that the update can be
+					 * applied and the `MenuOptionList` redrawn on the thread waiting for the selection.
 					 */
-					static const std::vector<struct MenuOptionListActionStruct> DEFAULT_ACTIONS;
+					class UpdateQueue {
+
+						/* Type Definitions */
+						public:
+							// The Function Signature of an update applied to a `MenuOptionList`.
+							typedef std::function<void (MenuOptionList&)> UpdateFunction;
+
+
+						/* Instance Properties */
+						private:
+							std::mutex updateMutex = {};									// Serializes access to the `pendingUpdates`.
+							std::vector<UpdateFunction> pendingUpdates = {};				// The updates that have been posted but not applied yet.
+							HANDLE updateEvent = CreateEventW(NULL, FALSE, FALSE, NULL);	// An Event Object signaled whenever an update is posted.
+
+
+						/* Class Constructors & Destructors */
+						public:
+							UpdateQueue () = default;
+							UpdateQueue ( const UpdateQueue& ) = delete;
+							UpdateQueue& operator= ( const UpdateQueue& ) = delete;
+
+							/**
+							 * Destroy the `UpdateQueue`, closing its Event Object.
+							 */
+							~UpdateQueue ();
+
+
+						/* Instance Methods */
+						public:
+							/**
+							 * Post an update to be applied to the `MenuOptionList`.
+							 * 
+							 * May be called from any thread, even after the `MenuOptionList` itself has been destroyed,
+							 * in which case the update is simply never applied.
+							 * 
+							 * @param update	The update being posted.
+							 */
+							void post ( UpdateFunction update );
+							/**
+							 * Get the Event Object signaled whenever an update is posted.
+							 * 
+							 * @returns		The handle to the Event Object, which is `NULL`
+							 * 				if it could not be created.
+							 */
+							HANDLE getUpdateEvent () const;
+							/**
+							 * Apply all of the updates that have been posted to the specified `MenuOptionList`,
+							 * in the order in which they were posted.
+							 * 
+							 * @param menuOptions	The `MenuOptionList` the updates are being applied to.
+							 * 
+							 * @returns				`true` if one or more updates were applied, otherwise `false`.
+							 */
+							bool applyPendingUpdates ( MenuOptionList& menuOptions );
+
+					};
+
+
+				/* Class Constants */
 
 				protected:
 					/**
@@ -2125,6 +3382,7 @@ namespace PROGRAM_NAMESPACE {
 
 				private:
 					std::vector<MenuOptionListAction> actions;	// The Collection of `MenuOptionListAction` objects associated with this `MenuOptionlist`.
+					std::wstring_view escapeInstruction;		// The Human-Readable Instruction associated with the `EscapeAction`.
 					
 					std::wstring prefix;						// The Wide-Character String prepended to all `MenuOption` objects.
 					std::wstring suffix;						// The Wide-Character String appended to all `MenuOption` objects.
@@ -2156,6 +3414,53 @@ namespace PROGRAM_NAMESPACE {
 					// A valid index for the `MenuOptionList` representing the last
 					// `MenuOption` in the Visible Console Viewport.
 					size_t bottomMenuOptionNum = 0ULL;
+					/**
+					 * The rows of the `MenuOptionList` as they were last written to the console,
+					 * excluding their terminating Newline Characters.
+					 * 
+					 * Whenever the `MenuOptionList` is redrawn using `Console::redrawMenuOptions()`,
+					 * the newly-formatted rows are compared against these rows so that only
+					 * the portions of the rows that actually differ are repainted.
+					 * 
+					 * This field will be empty until the `MenuOptionList` has been printed
+					 * to the console via a call to `Console::printMenuOptions()`.
+					 */
+					std::vector<std::wstring> renderedRows = {};
+					/**
+					 * The number of lines currently used to render the `MenuOption`s within the Visible Console Viewport.
+					 * 
+					 * This is never more than the `maxMenuOptionLines`, but may be fewer if the Console Window
+					 * is too short to fit them along with the instructions printed below them. The value is
+					 * recalculated whenever the Console Screen Buffer is resized during `Console::waitForSelection()`.
+					 * 
+					 * This field will be `0` until the `MenuOptionList` has been printed
+					 * to the console via a call to `Console::printMenuOptions()`.
+					 */
+					unsigned short viewportMenuOptionLines = 0U;
+					/**
+					 * The number of lines that were used to render the `MenuOption`s when the `MenuOptionList`
+					 * was last printed to the console via a call to `Console::printMenuOptions()`.
+					 * 
+					 * As any output printed below the `MenuOptionList` immediately follows these lines,
+					 * the `viewportMenuOptionLines` may shrink below this value when the Console Screen Buffer
+					 * is resized, but may never grow beyond it until the `MenuOptionList` is printed again.
+					 */
+					unsigned short printedMenuOptionLines = 0U;
+					/**
+					 * The `MenuOption`s of the `MenuOptionList` as they were last formatted, indexed
+					 * by their position in the `MenuOptionList`.
+					 * 
+					 * Only the `MenuOption`s that have been within the Visible Console Viewport are ever formatted,
+					 * so the cost of rendering the `MenuOptionList` only depends on the size of the viewport.
+					 */
+					std::vector<std::optional<FormattedMenuOption>> formattedMenuOptions = {};
+					/**
+					 * The `UpdateQueue` used to update the `MenuOptionList` from Background Threads.
+					 * 
+					 * The `UpdateQueue` is shared by any copies of the `MenuOptionList`, and its lifetime
+					 * is extended by any Background Threads still holding on to it.
+					 */
+					std::shared_ptr<UpdateQueue> updateQueue = std::make_shared<UpdateQueue>();
 					
 					/**
 					 * Contains the pending Status Message associated with this `MenuOptionList`, if any.
@@ -2184,7 +3489,8 @@ namespace PROGRAM_NAMESPACE {
 					/**
 					 * Construct a new `MenuOptionList`.
 					 * 
-					 * @param iActions				The `MenuOptionListAction` objects associated with this `MenuOptionList`.
+					 * @param iActions				The `MenuOptionListAction` objects associated with this `MenuOptionList`,
+					 *								which are processed after the `DefaultActionPipeline`.
 					 * @param iPrefix				The Wide-Character String prepended to all `MenuOption`s.
 					 * @param iSuffix				The Wide-Character String appended to all `MenuOption`s.
 					 * @param iSeparator			The Wide-Character String used to separate distinguish distinct sections of output.
@@ -2192,7 +3498,7 @@ namespace PROGRAM_NAMESPACE {
 					 * @param iMaxMenuOptionLines	The maximum number of lines to use to render the `MenuOption`s in the `MenuOptionList`.
 					 */
 					MenuOptionList (
-						const std::vector<MenuOptionListAction>& iActions = DEFAULT_ACTIONS,
+						std::vector<MenuOptionListAction> iActions = {},
 						const std::wstring& iPrefix = L"",
 						const std::wstring& iSuffix = L"",
 						const std::wstring& iSeparator = L"",
@@ -2203,7 +3509,8 @@ namespace PROGRAM_NAMESPACE {
 					 * Construct a new `MenuOptionList`.
 					 * 
 					 * @param initList				The Initializer List to be passed to the `std::vector` of `MenuOption` objects.
-					 * @param iActions				The `MenuOptionListAction` objects associated with this `MenuOptionList`.
+					 * @param iActions				The `MenuOptionListAction` objects associated with this `MenuOptionList`,
+					 *								which are processed after the `DefaultActionPipeline`.
 					 * @param iPrefix				The Wide-Character String prepended to all `MenuOption` objects.
 					 * @param iSuffix				The Wide-Character String appended to all `MenuOption` objects.
 					 * @param iSeparator			The Wide-Character String used to separate distinguish distinct sections of output.
@@ -2212,7 +3519,7 @@ namespace PROGRAM_NAMESPACE {
 					 */
 					MenuOptionList (
 						std::initializer_list<MenuOption> initList,
-						const std::vector<MenuOptionListAction>& iActions = DEFAULT_ACTIONS,
+						std::vector<MenuOptionListAction> iActions = {},
 						const std::wstring& iPrefix = L"",
 						const std::wstring& iSuffix = L"",
 						const std::wstring& iSeparator = L"",
@@ -2239,6 +3546,22 @@ namespace PROGRAM_NAMESPACE {
 					 *				currently associated with this `MenuOptionList`.
 					 */
 					const std::vector<MenuOptionListAction>& getActions () const;
+					/**
+					 * Get the Human-Readable Instruction associated with the `EscapeAction` of the `MenuOptionList`.
+					 * 
+					 * @returns		A Wide-Character String View of the Human-Readable Instruction.
+					 */
+					std::wstring_view getEscapeInstruction () const;
+					/**
+					 * Set the Human-Readable Instruction associated with the `EscapeAction` of the `MenuOptionList`,
+					 * such as when pressing the `ESC` key exits the program rather than returning to the previous menu.
+					 * 
+					 * @param instruction	A Wide-Character String View of the Human-Readable Instruction,
+					 * 						which must outlive the `MenuOptionList`, such as a String Literal.
+					 * 
+					 * @returns				A reference to this object to support method chaining.
+					 */
+					MenuOptionList& setEscapeInstruction ( std::wstring_view instruction );
 
 					/**
 					 * Get the Prefix String prepended to each `MenuOption` in the `MenuOptionList`.
@@ -2288,6 +3611,24 @@ namespace PROGRAM_NAMESPACE {
 					 *				maximum number of lines to use to render the `MenuOption`s in the `MenuOptionList`.
 					 */
 					const unsigned short& getMaxMenuOptionLines () const;
+					/**
+					 * Get the `UpdateQueue` used to update the `MenuOptionList` from Background Threads.
+					 * 
+					 * @returns 	A Smart Pointer to the `UpdateQueue`, which Background Threads may keep
+					 * 				to post updates for as long as they need to.
+					 */
+					const std::shared_ptr<UpdateQueue>& getUpdateQueue () const;
+					/**
+					 * Get the number of lines currently used to render the `MenuOption`s
+					 * within the Visible Console Viewport.
+					 * 
+					 * @returns 	A positive integer containing the number of lines used to render the `MenuOption`s
+					 * 				in the `MenuOptionList`, which depends on the height of the Console Window.
+					 * 
+					 * 				Until the `MenuOptionList` has been printed to the console, 
+					 * 				the `maxMenuOptionLines` is returned instead.
+					 */
+					unsigned short getViewportMenuOptionLines () const;
 
 					/**
 					 * Get the Starting Position of the Console Cursor for the `MenuOptionsList`,
@@ -2526,6 +3867,8 @@ namespace PROGRAM_NAMESPACE {
 			InputBuffer conInBuf;				// The `InputBuffer` responsible for the Console Input Buffer.
 			OutputBuffer conOutBuf;				// The `OutputBuffer` responsible for the Console Output Buffer.
 			OutputBuffer conErrBuf;				// The `OutputBuffer` responsible for the Console Error Output Buffer.
+			OutputQueue postedOutput;			// The records posted using `post()` that have not been printed yet.
+			DWORD ownerThreadId;				// The ID of the thread that owns the `Console`, which prints the `postedOutput`.
 
 
 		/* Class Constructors & Destructors */
@@ -2624,6 +3967,20 @@ namespace PROGRAM_NAMESPACE {
 			 * @returns				A reference to this object to support method chaining.
 			 */
 			Console& printMenuOption ( MenuOption& menuOption, unsigned int optionNum, unsigned short width = 0U );
+			/**
+			 * Format the specified `MenuOption` as it would be printed by `printMenuOption()`.
+			 * 
+			 * @param menuOption	The `MenuOption` being formatted.
+			 * 
+			 * @param optionNum		The one-based number hotkey to be associated with
+			 * 						the `menuOption` if it does not specify its own hotkey.
+			 * 
+			 * @param width			The minimum width of the formatted line.
+			 * 
+			 * @returns				A Wide-Character String containing the formatted `MenuOption`,
+			 * 						including any Virtual Terminal Sequences used to print Disabled `MenuOption`s.
+			 */
+			std::wstring formatMenuOption ( const MenuOption& menuOption, unsigned int optionNum, unsigned short width = 0U ) const;
 			/**
 			 * Print the specified `MenuOptionList` to the console.
 			 * 
@@ -2636,6 +3993,27 @@ namespace PROGRAM_NAMESPACE {
 			 * @returns						A reference to this object to support method chaining.
 			 */
 			Console& printMenuOptions ( MenuOptionList& menuOptions, bool printInstructions = false );
+			/**
+			 * Redraw the specified `MenuOptionList` in place to reflect any changes made to it
+			 * since it was last written to the console, such as a new Selected `MenuOption`
+			 * or a new `MenuOption` at the top of the Visible Console Viewport.
+			 * 
+			 * Rather than re-printing the entire `MenuOptionList`, each row is compared against
+			 * the row that was last written to the console and only the portions of the rows that differ
+			 * are repainted using the Console Cursor. The Position of the Console Cursor is preserved.
+			 * 
+			 * If the `MenuOptionList` has not yet been printed using `printMenuOptions()`,
+			 * it will be printed in its entirety starting from its Cursor Starting Position.
+			 * 
+			 * @param menuOptions	The `MenuOptionList` being redrawn.
+			 * 
+			 * @param repaintAll	Indicates whether every row should be repainted in its entirety,
+			 * 						such as after the Console Screen Buffer has been resized and the
+			 * 						contents of the console may no longer match the rows last written to it.
+			 * 
+			 * @returns				A reference to this object to support method chaining.
+			 */
+			Console& redrawMenuOptions ( MenuOptionList& menuOptions, bool repaintAll = false );
 
 			/**
 			 * Wait for the user to make a selection in the specified `MenuOptionList`,
@@ -2647,6 +4025,9 @@ namespace PROGRAM_NAMESPACE {
 			 * it will be printed to the User Interface below the Interactive Menu and the
 			 * specified list of `menuOptions` will be updated accordingly.
 			 * 
+			 * Any updates posted to the `MenuOptionList::UpdateQueue` of the `menuOptions` while waiting
+			 * are applied as soon as they are posted, and the `menuOptions` redrawn to reflect them.
+			 * 
 			 * @warning				This method assumes that the `printMenuOption()` or `printMenuOptions()` methods have been
 			 *						called prior to invoking this method in order to print the menu options to the console.
 			 *						Failing to do so will result in the Console Output Buffer being corrupted and some
@@ -2664,6 +4045,45 @@ namespace PROGRAM_NAMESPACE {
 			 */
 			std::optional<size_t> waitForSelection ( MenuOptionList& menuOptions, DWORD maxWaitTime = DEFAULT_MAX_INPUT_WAIT_TIME );
 
+			// Posted Output
+
+			/**
+			 * Post a preformatted record to be printed on its own line by the thread that owns the `Console`.
+			 * 
+			 * Unlike every other method of the `Console`, this method may be called from any thread,
+			 * making it the only way for a Background Thread to print to the console. The record is pushed
+			 * onto a lock-free queue without blocking, so the thread that owns the `Console` is never
+			 * held up by a Background Thread and vice versa.
+			 * 
+			 * Posted records are printed in the order in which they were posted by `flushPostedOutput()`,
+			 * which is invoked automatically when a record is posted from the thread that owns the `Console`
+			 * and whenever the Primary Output Buffer is restored. As Alternate Output Buffers are used to display
+			 * Interactive Menus, records posted while any are in use are held until the Primary Output Buffer is restored.
+			 * 
+			 * @param record	The preformatted record being posted, excluding the Line Terminator.
+			 * 
+			 * @param isError	Indicates if the record should be printed to the Error Output Buffer.
+			 */
+			void post ( std::wstring record, bool isError = false );
+			/**
+			 * Print all of the records that have been posted using `post()` but not printed yet.
+			 * 
+			 * Consecutive records for the same Output Buffer are printed together using a single call to `print()`.
+			 * If any Alternate Output Buffers are in use or an Output Frame is in progress, the records are held instead.
+			 * 
+			 * Must only be called from the thread that owns the `Console`.
+			 * 
+			 * @returns		`true` if any posted records were printed, otherwise `false`.
+			 */
+			bool flushPostedOutput ();
+			/**
+			 * Get the Event Object signaled whenever a record is posted using `post()`,
+			 * which can be waited on by the thread that owns the `Console` before calling `flushPostedOutput()`.
+			 * 
+			 * @returns		The handle to the Event Object, which is `NULL` if it could not be created.
+			 */
+			HANDLE getPostedOutputEvent () const;
+
 
 		/* Inherited Instance Methods */
 		public:
@@ -2772,6 +4192,33 @@ namespace PROGRAM_NAMESPACE {
 			 */
 			virtual buffer_number_t restorePreviousBuffer () override;
 
+			/**
+			 * Begin a new Output Frame.
+			 * 
+			 * Until the matching call to `commitFrame()`, all output written to the Current Output Buffer
+			 * is assembled into a single contiguous Wide-Character String and written to the console all at once.
+			 * 
+			 * @returns		A reference to this object to support method chaining.
+			 */
+			virtual Console& beginFrame () override;
+			/**
+			 * Commit the Current Output Frame that was started by a previous call to `beginFrame()`,
+			 * writing all of the assembled output to the Current Output Buffer at once.
+			 * 
+			 * If there is no Output Frame currently in progress, this method has no effect.
+			 * 
+			 * @returns		A reference to this object to support method chaining.
+			 */
+			virtual Console& commitFrame () override;
+			/**
+			 * Determine whether or not an Output Frame is currently in progress.
+			 * 
+			 * @returns		`true` if `beginFrame()` has been called more times than `commitFrame()`.
+			 * 
+			 * 				Otherwise, returns `false`.
+			 */
+			virtual bool isFrameActive () const override;
+
 			/**
 			 * Get the Current Position of the Console Cursor.
 			 * 
@@ -2883,6 +4330,33 @@ namespace PROGRAM_NAMESPACE {
 			virtual Console& print ( const wchar_t* str, bool addToBuffer = true ) override;
 
 
+		/* Helper Methods */
+		protected:
+			/**
+			 * Format each of the rows of the specified `MenuOptionList` currently
+			 * within the Visible Console Viewport, as they are to be written to the console.
+			 * 
+			 * The Bottom `MenuOption` Number of the `MenuOptionList` is updated to reflect
+			 * the last `MenuOption` that could fit within the Visible Console Viewport.
+			 * 
+			 * @param menuOptions	The `MenuOptionList` being formatted.
+			 * 
+			 * @returns				A Collection of Wide-Character Strings containing each of the formatted rows
+			 * 						of the `menuOptions`, excluding their terminating Newline Characters.
+			 */
+			std::vector<std::wstring> formatMenuOptionRows ( MenuOptionList& menuOptions ) const;
+			/**
+			 * Update the number of lines used to render the specified `MenuOptionList` to fit within
+			 * the current Console Window, scrolling the `MenuOptionList` if needed so that the
+			 * Selected `MenuOption` remains within the Visible Console Viewport.
+			 * 
+			 * @param menuOptions	The `MenuOptionList` being updated.
+			 * 
+			 * @param maxLines		The maximum number of lines that may be used to render the `menuOptions`.
+			 */
+			void updateMenuOptionViewport ( MenuOptionList& menuOptions, unsigned short maxLines ) const;
+
+
 		/* Overloaded Operators */
 		public:
 			/**
@@ -0,0 +1,252 @@
+/*
+* ControlPipe.cpp
+*
+* Source File defining the `ControlPipeServer` class, which answers queries and requests
+* from other programs, such as game launchers, over a Named Pipe while running in Watch Mode.
+*/
+
+
+#include "ControlPipe.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Helper Functions */
+
+    /**
+     * Get the name of the Control Pipe used within the Windows Session the program is running in.
+     *
+     * Named Pipes are shared by every Windows Session on the computer, so the Session ID is included
+     * in the name to keep Watch Mode in one session from claiming or answering the Control Pipe of another.
+     *
+     * @returns     The name of the Control Pipe, which omits the Session ID if it could not be retrieved.
+     */
+    static std::wstring getPipeName () {
+
+        DWORD sessionId = 0UL;      // Receives the Session ID of the current process.
+
+        if ( !ProcessIdToSessionId(GetCurrentProcessId(), &sessionId) )
+            return L"\\\\.\\pipe\\TerrariaMonitorTool";
+
+        return std::format(L"\\\\.\\pipe\\TerrariaMonitorTool-{:d}", sessionId);
+
+    }
+
+
+    /* ControlPipeServer */
+    // Class Constants
+
+    const std::wstring ControlPipeServer::PIPE_NAME = getPipeName();
+    const uint16_t ControlPipeServer::PROTOCOL_VERSION = 1U;
+    const uint32_t ControlPipeServer::MAX_PATH_LENGTH = 32767UL;
+    const size_t ControlPipeServer::INSTANCE_COUNT = 4ULL;
+    const size_t ControlPipeServer::MAX_REQUEST_SIZE = sizeof(RequestHeader) + (MAX_PATH_LENGTH * sizeof(wchar_t));
+
+    // Class Constructors & Destructors
+
+    ControlPipeServer::ControlPipeServer ( RequestHandler iRequestHandler ) :
+        requestHandler( std::move(iRequestHandler) ),
+        instances(INSTANCE_COUNT),
+        eventHandles()
+    {
+
+        for ( size_t i = 0ULL; i < this->instances.size(); i++ ) {
+            PipeInstance& instance = this->instances[i];    // The Pipe Instance being created.
+
+            // The first Pipe Instance fails to be created if another process is already serving the Control Pipe.
+            instance.pipeHandle = CreateNamedPipeW(
+                PIPE_NAME.c_str(),
+                PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED | ( i == 0ULL ? FILE_FLAG_FIRST_PIPE_INSTANCE : 0UL ),
+                PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+                (DWORD) INSTANCE_COUNT,
+                (DWORD) ( sizeof(ResponseHeader) + (2ULL * MAX_PATH_LENGTH * sizeof(wchar_t)) ),
+                (DWORD) MAX_REQUEST_SIZE,
+                0UL,
+                NULL
+            );
+            instance.overlapped.hEvent = CreateEventW(NULL, TRUE, TRUE, NULL);
+
+            if ( instance.pipeHandle == INVALID_HANDLE_VALUE || instance.overlapped.hEvent == NULL ) {
+                this->eventHandles.clear();
+                break;
+            }
+
+            instance.requestBuffer.resize(MAX_REQUEST_SIZE);
+            this->eventHandles.push_back(instance.overlapped.hEvent);
+            this->connect(instance);
+        }
+
+    }
+
+    ControlPipeServer::~ControlPipeServer () {
+
+        DWORD bytesTransferred = 0UL;    // Receives the number of bytes transferred by each cancelled operation.
+
+        for ( PipeInstance& instance : this->instances ) {
+            // The `overlapped` structure must remain valid until any pending operation has actually been cancelled.
+            if (instance.pendingIo) {
+                CancelIoEx(instance.pipeHandle, &instance.overlapped);
+                GetOverlappedResult(instance.pipeHandle, &instance.overlapped, &bytesTransferred, TRUE);
+            }
+
+            if (instance.pipeHandle != INVALID_HANDLE_VALUE) {
+                DisconnectNamedPipe(instance.pipeHandle);
+                CloseHandle(instance.pipeHandle);
+            }
+
+            if (instance.overlapped.hEvent != NULL)
+                CloseHandle(instance.overlapped.hEvent);
+        }
+
+    }
+
+    // Instance Methods
+
+    bool ControlPipeServer::isListening () const {
+
+        return !this->eventHandles.empty();
+
+    }
+
+    const std::vector<HANDLE>& ControlPipeServer::getEventHandles () const {
+
+        return this->eventHandles;
+
+    }
+
+    void ControlPipeServer::processEvent ( size_t instanceIndex ) {
+
+        PipeInstance& instance = this->instances[instanceIndex];    // The Pipe Instance whose Event was signaled.
+        DWORD bytesTransferred = 0UL;                               // Receives the number of bytes transferred by the completed operation.
+        BOOL success = TRUE;                                        // Indicates if the next operation was started successfully.
+
+        // Requests larger than `MAX_REQUEST_SIZE` fail with `ERROR_MORE_DATA`, and their client is disconnected along with any broken connections.
+        if (instance.pendingIo) {
+            instance.pendingIo = false;
+
+            if ( !GetOverlappedResult(instance.pipeHandle, &instance.overlapped, &bytesTransferred, FALSE) ) {
+                this->connect(instance);
+                return;
+            }
+        }
+
+        // Write the response to a request as a single Message, or wait for the next request otherwise.
+        if (instance.state == PipeState::READING) {
+            this->answerRequest(instance, bytesTransferred);
+            instance.state = PipeState::WRITING;
+            success = WriteFile(
+                instance.pipeHandle,
+                instance.responseBuffer.data(),
+                (DWORD) instance.responseBuffer.size(),
+                NULL,
+                &instance.overlapped
+            );
+        }
+        else {
+            instance.state = PipeState::READING;
+            success = ReadFile(
+                instance.pipeHandle,
+                instance.requestBuffer.data(),
+                (DWORD) instance.requestBuffer.size(),
+                NULL,
+                &instance.overlapped
+            );
+        }
+
+        // Operations that complete immediately still signal the Event, so they are finished the same way as pending ones.
+        if ( success || GetLastError() == ERROR_IO_PENDING )
+            instance.pendingIo = true;
+        else
+            this->connect(instance);
+
+    }
+
+    // Helper Methods
+
+    void ControlPipeServer::connect ( PipeInstance& instance ) {
+
+        // Disconnecting a Pipe Instance without a client has no effect.
+        DisconnectNamedPipe(instance.pipeHandle);
+
+        instance.state = PipeState::CONNECTING;
+        instance.pendingIo = false;
+
+        if ( ConnectNamedPipe(instance.pipeHandle, &instance.overlapped) )
+            return;
+
+        switch ( GetLastError() ) {
+            // Wait for a client to connect.
+            case ERROR_IO_PENDING: {
+                instance.pendingIo = true;
+                break;
+            }
+            // A client connected before `ConnectNamedPipe()` was called, so there is nothing to wait on.
+            case ERROR_PIPE_CONNECTED: {
+                SetEvent(instance.overlapped.hEvent);
+                break;
+            }
+            // The Pipe Instance stops accepting clients, rather than being retried continuously.
+            default: {
+                ResetEvent(instance.overlapped.hEvent);
+                break;
+            }
+        }
+
+    }
+
+    void ControlPipeServer::answerRequest ( PipeInstance& instance, size_t requestSize ) {
+
+        RequestHeader requestHeader = {};       // The header of the request.
+        ResponseHeader responseHeader = {};     // The header of the encoded `response`.
+        Response response = {};                 // The response to the request.
+
+        if ( requestSize >= sizeof(RequestHeader) )
+            std::memcpy(&requestHeader, instance.requestBuffer.data(), sizeof(RequestHeader));
+
+        if (
+               requestSize < sizeof(RequestHeader)
+            || requestHeader.protocolVersion != PROTOCOL_VERSION
+            || ( requestHeader.requestType != RequestType::QUERY_ACTIVE_MONITOR && requestHeader.requestType != RequestType::APPLY_ASSIGNMENT )
+            || requestHeader.pathLength > MAX_PATH_LENGTH
+            || requestSize != sizeof(RequestHeader) + (requestHeader.pathLength * sizeof(wchar_t))
+        ) {
+            response.status = ResponseStatus::BAD_REQUEST;
+        }
+        else {
+            // The decoded request.
+            Request request = {
+                .type = (RequestType) requestHeader.requestType,
+                .configFilePath = std::wstring(requestHeader.pathLength, L'\0')
+            };
+
+            std::memcpy(request.configFilePath.data(), instance.requestBuffer.data() + sizeof(RequestHeader), requestHeader.pathLength * sizeof(wchar_t));
+            response = this->requestHandler(request);
+        }
+
+        responseHeader.protocolVersion = PROTOCOL_VERSION;
+        responseHeader.status = response.status;
+        responseHeader.flags = response.flags;
+
+        if (response.monitor) {
+            responseHeader.displayIdLength = (uint16_t) std::min<size_t>(response.monitor->displayId.size(), MAX_PATH_LENGTH);
+            responseHeader.displayNum = response.monitor->displayNum;
+            responseHeader.displayWidth = response.monitor->currentResolution.displayWidth;
+            responseHeader.displayHeight = response.monitor->currentResolution.displayHeight;
+            responseHeader.refreshRate = response.monitor->currentResolution.refreshRate;
+            responseHeader.monitorNameLength = (uint16_t) std::min<size_t>(response.monitor->monitorName.size(), MAX_PATH_LENGTH);
+        }
+
+        // The `responseBuffer` is reused for each response written to the Pipe Instance.
+        instance.responseBuffer.assign( (const char*) &responseHeader, sizeof(ResponseHeader) );
+
+        if (response.monitor) {
+            instance.responseBuffer.append( (const char*) response.monitor->displayId.data(), responseHeader.displayIdLength * sizeof(wchar_t) )
+                                   .append( (const char*) response.monitor->monitorName.data(), responseHeader.monitorNameLength * sizeof(wchar_t) );
+        }
+
+    }
+
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+
+/*
+* ControlPipe.h
+*
+* Header File defining the `ControlPipeServer` class, which answers queries and requests
+* from other programs, such as game launchers, over a Named Pipe while running in Watch Mode.
+*/
+
+
+#include "framework.h"
+#include "DisplayTopology.h"
+
+#include <cstdint>
+#include <functional>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/**
+	 * A class providing the Control Pipe, a Named Pipe over which other programs can ask
+	 * the program which Display Monitor Terraria will be rendered on, or have it set the
+	 * assigned Display Monitor again, without having to launch the program themselves.
+	 *
+	 * The Control Pipe uses a small binary protocol in Message Mode, in which each Message written by a client
+	 * is a `RequestHeader` followed by the UTF-16 Encoded path to a Terraria Configuration File, and is answered
+	 * by a single Message containing a `ResponseHeader` followed by the UTF-16 Encoded Display ID and Monitor Name
+	 * of the Display Monitor being reported. Any number of requests can be made over the same connection.
+	 *
+	 * All of the Pipe Instances use Overlapped I/O and are driven by a single thread, which waits on the Event
+	 * of each Pipe Instance alongside any other objects it is waiting on and calls `processEvent()` once one
+	 * has been signaled. As a result, the `RequestHandler` is always invoked on that thread.
+	 */
+	class ControlPipeServer {
+
+		/* Type Definitions */
+		public:
+			// An enumeration defining the type of a request made over the Control Pipe.
+			enum RequestType : uint16_t {
+
+				QUERY_ACTIVE_MONITOR = 1U,		// Get the Connected Display Monitor Terraria will currently be rendered on.
+				APPLY_ASSIGNMENT = 2U			// Set the assigned Display Monitor as the Active Display Monitor again, if it differs.
+
+			};
+
+			// An enumeration defining the result of a request made over the Control Pipe.
+			enum ResponseStatus : uint16_t {
+
+				OK = 0U,						// The request succeeded, and the reported Display Monitor is included.
+				BAD_REQUEST,					// The request was malformed or used an unsupported Protocol Version or `RequestType`.
+				UNKNOWN_CONFIG_FILE,			// The Terraria Configuration File is not being watched.
+				MONITOR_NOT_CONNECTED,			// The Active or assigned Display Monitor is not currently connected.
+				MODIFICATION_FAILED				// The Terraria Configuration File could not be modified.
+
+			};
+
+			// An enumeration defining the flags that may be set in a response made over the Control Pipe.
+			enum ResponseFlags : uint16_t {
+
+				ASSIGNED_MONITOR = 0x1U,		// The reported Display Monitor is the one assigned to the Terraria Configuration File.
+				FILE_MODIFIED = 0x2U			// The Terraria Configuration File was modified in response to the request.
+
+			};
+
+			/**
+			 * A structure type representing the fixed-size beginning of each request Message.
+			 */
+			typedef struct RequestHeaderStruct {
+
+				uint16_t protocolVersion;		// The Protocol Version used by the client, which must be `PROTOCOL_VERSION`.
+				uint16_t requestType;			// The `RequestType` of the request.
+				uint32_t pathLength;			// The length of the path following the `RequestHeader`, in UTF-16 Code Units.
+												// If `0`, the most recently used Terraria Configuration File is used.
+
+			} RequestHeader;
+
+			/**
+			 * A structure type representing the fixed-size beginning of each response Message.
+			 */
+			typedef struct ResponseHeaderStruct {
+
+				uint16_t protocolVersion;		// The Protocol Version used by the program.
+				uint16_t status;				// The `ResponseStatus` of the request.
+				uint16_t flags;					// Any of the `ResponseFlags` that apply to the request.
+				uint16_t displayIdLength;		// The length of the Display ID following the `ResponseHeader`, in UTF-16 Code Units.
+				uint32_t displayNum;			// The Display Number of the reported Display Monitor, or `0` if none is reported.
+				uint32_t displayWidth;			// The width of the Current Display Resolution of the reported Display Monitor.
+				uint32_t displayHeight;			// The height of the Current Display Resolution of the reported Display Monitor.
+				uint32_t refreshRate;			// The Refresh Rate of the Current Display Resolution of the reported Display Monitor.
+				uint16_t monitorNameLength;		// The length of the Monitor Name following the Display ID, in UTF-16 Code Units.
+				uint16_t reserved;				// Reserved for future use, and always `0`.
+
+			} ResponseHeader;
+
+			/**
+			 * A structure type representing a decoded request made over the Control Pipe.
+			 */
+			typedef struct RequestStruct {
+
+				RequestType type;				// The type of the request.
+				std::wstring configFilePath;	// The path to the Terraria Configuration File, which may be empty.
+
+			} Request;
+
+			/**
+			 * A structure type representing the response to a request made over the Control Pipe, before it is encoded.
+			 */
+			typedef struct ResponseStruct {
+
+				ResponseStatus status = ResponseStatus::OK;		// The result of the request.
+				uint16_t flags = 0U;							// Any of the `ResponseFlags` that apply to the request.
+				std::optional<DisplayMonitor> monitor = {};		// The Display Monitor being reported, if any.
+
+			} Response;
+
+			/**
+			 * The Function Signature of the Callback Function invoked to answer each valid request.
+			 */
+			typedef std::function<Response (const Request&)> RequestHandler;
+
+		protected:
+			// An enumeration defining the operation a Pipe Instance is currently waiting on.
+			enum PipeState {
+
+				CONNECTING,						// Waiting for a client to connect.
+				READING,						// Waiting for the client to write a request.
+				WRITING							// Waiting for the response to be written to the client.
+
+			};
+
+			/**
+			 * A structure type representing a single Pipe Instance of the Control Pipe.
+			 */
+			typedef struct PipeInstanceStruct {
+
+				HANDLE pipeHandle = INVALID_HANDLE_VALUE;		// The handle to the Pipe Instance.
+				OVERLAPPED overlapped = {};						// The Overlapped Structure of the pending operation, including its Manual-Reset Event.
+				PipeState state = PipeState::CONNECTING;		// The operation the Pipe Instance is currently waiting on.
+				bool pendingIo = false;							// Indicates if an operation was started that has not been completed yet.
+				std::string requestBuffer = {};					// The buffer receiving each request.
+				std::string responseBuffer = {};				// The buffer containing the response being written.
+
+			} PipeInstance;
+
+
+		/* Class Constants */
+		public:
+			static const std::wstring PIPE_NAME;			// The name of the Control Pipe, which includes the Session ID of the current Windows Session.
+			static const uint16_t PROTOCOL_VERSION;			// The Protocol Version used by the program.
+			static const uint32_t MAX_PATH_LENGTH;			// The maximum length of the path in a request, in UTF-16 Code Units.
+
+		protected:
+			static const size_t INSTANCE_COUNT;				// The number of Pipe Instances, which is the number of clients that can be connected at once.
+			static const size_t MAX_REQUEST_SIZE;			// The maximum size of a request Message, in bytes.
+
+
+		/* Instance Properties */
+		private:
+			RequestHandler requestHandler;					// The Callback Function invoked to answer each valid request.
+			std::vector<PipeInstance> instances;			// The Pipe Instances, which are never moved once created.
+			std::vector<HANDLE> eventHandles;				// The Manual-Reset Event of each of the `instances`, in the same order.
+
+
+		/* Class Constructors & Destructors */
+		public:
+			/**
+			 * Construct a new `ControlPipeServer`, which immediately begins waiting for clients to connect.
+			 *
+			 * Only one `ControlPipeServer` can exist on the computer at a time, so if the Control Pipe
+			 * is already being served by another process, the `ControlPipeServer` is not listening.
+			 *
+			 * @param iRequestHandler	The Callback Function invoked to answer each valid request.
+			 */
+			ControlPipeServer ( RequestHandler iRequestHandler );
+			ControlPipeServer ( const ControlPipeServer& ) = delete;
+			ControlPipeServer& operator= ( const ControlPipeServer& ) = delete;
+
+			/**
+			 * Destroy the `ControlPipeServer`, cancelling any pending operations and disconnecting every client.
+			 */
+			~ControlPipeServer ();
+
+
+		/* Instance Methods */
+		public:
+			/**
+			 * Determine if the `ControlPipeServer` is waiting for clients to connect.
+			 *
+			 * @returns		`true` if the Control Pipe was created, otherwise `false`.
+			 */
+			bool isListening () const;
+			/**
+			 * Get the Manual-Reset Event of each Pipe Instance, one of which is signaled whenever
+			 * an operation on its Pipe Instance has completed and `processEvent()` should be called.
+			 *
+			 * @returns		The handles to the Events, which remain owned by the `ControlPipeServer`.
+			 * 				Empty if the `ControlPipeServer` is not listening.
+			 */
+			const std::vector<HANDLE>& getEventHandles () const;
+
+			/**
+			 * Continue processing the Pipe Instance whose Event has been signaled, accepting its client, answering its
+			 * request using the `RequestHandler`, or waiting for its next request, and then starting its next operation.
+			 *
+			 * @param instanceIndex		The index of the signaled Event within the result of `getEventHandles()`.
+			 */
+			void processEvent ( size_t instanceIndex );
+
+
+		/* Helper Methods */
+		protected:
+			/**
+			 * Start waiting for a client to connect to a Pipe Instance, disconnecting any existing client first.
+			 *
+			 * @param instance	The Pipe Instance being connected.
+			 */
+			void connect ( PipeInstance& instance );
+			/**
+			 * Decode a request and encode the response to it into the `responseBuffer` of a Pipe Instance.
+			 *
+			 * @param instance		The Pipe Instance whose `requestBuffer` contains the request.
+			 * @param requestSize	The size of the request within the `requestBuffer`, in bytes.
+			 */
+			void answerRequest ( PipeInstance& instance, size_t requestSize );
+
+	};
+
+}
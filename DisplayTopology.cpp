@@ -0,0 +1,931 @@
+/*
+* DisplayTopology.cpp
+*
+* Source File defining the `DisplayTopologyCache`, `DisplayModeCatalog`, and `DisplayChangeListener` classes,
+* which are used to avoid querying the Windows API for the details of every
+* Connected Display Monitor unless the Display Topology has actually changed,
+* as well as the functions used to retrieve the Connected Display Monitors.
+*/
+
+
+#include "DisplayTopology.h"
+#include "Console.h"
+#include "Tracing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Type Definitions */
+
+    /**
+     * A structure type containing the results of looking up the
+     * Target and Source Device Names of a single Display Path.
+     */
+    typedef struct DisplayPathNamesStruct {
+
+        LONG result;                                    // The result of looking up the Device Names via the Windows API.
+        DISPLAYCONFIG_TARGET_DEVICE_NAME targetName;    // A structure type containing the Friendly Display Name of the Display Monitor.
+        DISPLAYCONFIG_SOURCE_DEVICE_NAME sourceName;    // A structure type containing the Display ID of the Display Monitor.
+
+    } DisplayPathNames;
+
+
+    /* Internal Variables */
+
+    // Serializes access to the in-memory Display Mode Catalog and the Display Mode Catalog File.
+    static std::mutex modeCatalogMutex = {};
+    // The fingerprint of the Display Topology the in-memory Display Mode Catalog belongs to, once it has been loaded.
+    static std::optional<std::wstring> modeCatalogFingerprint = {};
+    // The pending and completed enumerations of the Display Resolutions of each Connected Display Monitor, by their Display IDs.
+    static std::unordered_map<std::wstring, std::shared_future<DisplayModeCatalog::DisplayResolutionList>> modeCatalogEntries = {};
+    // The completed enumerations of the Display Resolutions of each Connected Display Monitor, as saved to the Display Mode Catalog File.
+    static DisplayModeCatalog::DisplayResolutionMap modeCatalogResolutions = {};
+    // The Background Threads enumerating Display Resolutions, along with the result each one fulfills. These are declared after the
+    // rest of the in-memory Display Mode Catalog, so that any still running are joined before it is destroyed when the program exits.
+    static std::vector< std::pair<std::shared_future<DisplayModeCatalog::DisplayResolutionList>, std::jthread> > modeCatalogThreads = {};
+
+
+    /* Internal Helper Functions */
+
+    /**
+     * Query the Active Display Paths and their Display Modes from the Windows API.
+     *
+     * @param oConfigPaths  The Display Configuration Paths returned by `QueryDisplayConfig()`.
+     * @param oConfigModes  The Display Configuration Modes returned by `QueryDisplayConfig()`.
+     *
+     * @returns             The result of the last Windows API operation, which is `ERROR_SUCCESS` on success.
+     */
+    static LONG queryDisplayConfig (
+        _Out_ std::vector<DISPLAYCONFIG_PATH_INFO>& oConfigPaths,
+        _Out_ std::vector<DISPLAYCONFIG_MODE_INFO>& oConfigModes
+    ) {
+
+        UINT32 configFlags = QDC_ONLY_ACTIVE_PATHS;     // Configuration Flags to be passed to the Windows API.
+        LONG result = ERROR_SUCCESS;                    // The result of the most recent Windows API operation.
+
+        // Loop until the `oConfigPaths` and `oConfigModes` have been properly populated.
+        do {
+            UINT32 pathCount = 0U;  // The number of Display Paths returned by the Windows API.
+            UINT32 modeCount = 0U;  // The number of Display Modes returned by the Windows API.
+
+            {
+                ScopedTraceTimer apiTraceTimer = { "GetDisplayConfigBufferSizes", "winapi" };
+                result = GetDisplayConfigBufferSizes(configFlags, &pathCount, &modeCount);
+            }
+
+            if (result == ERROR_SUCCESS) {
+                oConfigPaths.resize(pathCount);
+                oConfigModes.resize(modeCount);
+
+                ScopedTraceTimer apiTraceTimer = { "QueryDisplayConfig", "winapi" };
+                result = QueryDisplayConfig(configFlags, &pathCount, oConfigPaths.data(), &modeCount, oConfigModes.data(), nullptr);
+
+                oConfigPaths.resize(pathCount);
+                oConfigModes.resize(modeCount);
+            }
+        }
+        while (result == ERROR_INSUFFICIENT_BUFFER);
+
+        return result;
+
+    }
+
+
+    /* DisplayTopologyCache */
+    // Class Constants
+
+    const std::wstring DisplayTopologyCache::CACHE_FILE_NAME = L"display_topology";
+    const std::filesystem::path DisplayTopologyCache::CACHE_FILE_PATH = { PROGRAM_DATA_PATH / CACHE_FILE_NAME };
+
+    // Static Methods
+
+    std::wstring DisplayTopologyCache::getFingerprint (
+        const std::vector<DISPLAYCONFIG_PATH_INFO>& configPaths,
+        const std::vector<DISPLAYCONFIG_MODE_INFO>& configModes
+    ) {
+
+        uint64_t hash = 14695981039346656037ULL;    // The running 64-bit FNV-1a Hash of the Display Topology.
+
+        /**
+         * A lambda function used to add the specified value to the running `hash`.
+         *
+         * @param value     The value being added to the `hash`.
+         */
+        auto addToHash = [&hash] ( uint64_t value ) {
+
+            for ( int i = 0; i < 8; i++ ) {
+                hash ^= ( (value >> (i * 8)) & 0xFFULL );
+                hash *= 1099511628211ULL;
+            }
+
+        };
+
+        addToHash( configPaths.size() );
+
+        for ( const DISPLAYCONFIG_PATH_INFO& path : configPaths ) {
+            addToHash(path.sourceInfo.adapterId.LowPart);
+            addToHash( (uint64_t) path.sourceInfo.adapterId.HighPart );
+            addToHash(path.sourceInfo.id);
+            addToHash(path.targetInfo.adapterId.LowPart);
+            addToHash( (uint64_t) path.targetInfo.adapterId.HighPart );
+            addToHash(path.targetInfo.id);
+            addToHash(path.targetInfo.refreshRate.Numerator);
+            addToHash(path.targetInfo.refreshRate.Denominator);
+            addToHash(path.targetInfo.rotation);
+        }
+
+        for ( const DISPLAYCONFIG_MODE_INFO& mode : configModes ) {
+            if (mode.infoType == DISPLAYCONFIG_MODE_INFO_TYPE_SOURCE) {
+                addToHash(mode.id);
+                addToHash(mode.sourceMode.width);
+                addToHash(mode.sourceMode.height);
+                addToHash( (uint64_t) mode.sourceMode.position.x );
+                addToHash( (uint64_t) mode.sourceMode.position.y );
+            }
+        }
+
+        return std::format(L"{:016x}", hash);
+
+    }
+    std::optional<std::wstring> DisplayTopologyCache::getCurrentFingerprint () {
+
+        std::vector<DISPLAYCONFIG_PATH_INFO> configPaths;   // Configuration Paths to be used with the Windows API.
+        std::vector<DISPLAYCONFIG_MODE_INFO> configModes;   // Configuration Modes to be used with the Windows API.
+
+        if ( queryDisplayConfig(configPaths, configModes) != ERROR_SUCCESS )
+            return std::nullopt;
+
+        return getFingerprint(configPaths, configModes);
+
+    }
+
+    // Serialization & Persistence to File
+
+    std::optional<DisplayMonitorList> DisplayTopologyCache::fetchFromFile ( const std::wstring& fingerprint ) {
+
+        // The cached Connected Display Monitors.
+        DisplayMonitorList displayMonitors = {};
+
+        // Don't read the Display Topology Cache File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return {};
+
+        std::wistringstream fileStream(                 // The Stream used to read the Display Topology Cache File.
+            UTILS_NAMESPACE::readTextFile(CACHE_FILE_PATH).value_or(L"")
+        );
+        std::wstring currentLine = {};                  // Contains the Current Line from the Display Topology Cache File.
+
+        // The first line of the Display Topology Cache File contains the fingerprint it was saved for.
+        if ( !std::getline(fileStream, currentLine) || currentLine != fingerprint )
+            return {};
+
+        // Each subsequent line contains the Tab-Separated fields of a single Connected Display Monitor.
+        while ( std::getline(fileStream, currentLine) ) {
+            std::wistringstream lineStream(currentLine);    // The Input Stream used to read the fields of the Current Line.
+            std::vector<std::wstring> fields = {};          // The fields of the Current Line.
+            std::wstring currentField = {};                 // The Current Field being read from the `lineStream`.
+
+            if ( currentLine.empty() )
+                continue;
+
+            while ( std::getline(lineStream, currentField, L'\t') )
+                fields.push_back(currentField);
+
+            // The trailing Device Path may be empty.
+            if (fields.size() == 10ULL)
+                fields.emplace_back();
+
+            // Treat the entire Display Topology Cache File as invalid if any of its lines are invalid.
+            if (fields.size() != 11ULL)
+                return {};
+
+            try {
+                displayMonitors.emplace_back(
+                    (DisplayMonitor::display_number_t) std::stoul(fields[0]),
+                    fields[1],
+                    fields[2],
+                    (DWORD) std::stoul(fields[3]),
+                    (DWORD) std::stoul(fields[4]),
+                    (DWORD) std::stoul(fields[5]),
+                    (fields[6] == L"1")
+                );
+                displayMonitors.back().targetId = (UINT32) std::stoul(fields[7]);
+                displayMonitors.back().adapterId = { .LowPart = (DWORD) std::stoul(fields[8]), .HighPart = (LONG) std::stol(fields[9]) };
+                displayMonitors.back().devicePath = fields[10];
+            }
+            catch (...) {
+                return {};
+            }
+        }
+
+        if ( displayMonitors.empty() )
+            return {};
+
+        return displayMonitors;
+
+    }
+
+    bool DisplayTopologyCache::saveToFile ( const std::wstring& fingerprint, const DisplayMonitorList& displayMonitors ) {
+
+        // Don't modify the Display Topology Cache File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return true;
+
+        // The contents of the Display Topology Cache File.
+        std::wstring contents = fingerprint;
+
+        for ( const DisplayMonitor& monitor : displayMonitors ) {
+            contents += std::format(
+                L"\n{:d}\t{:s}\t{:s}\t{:d}\t{:d}\t{:d}\t{:d}\t{:d}\t{:d}\t{:d}\t{:s}",
+                monitor.displayNum,
+                monitor.displayId,
+                monitor.monitorName,
+                monitor.currentResolution.displayWidth,
+                monitor.currentResolution.displayHeight,
+                monitor.currentResolution.refreshRate,
+                ( monitor.comments.empty() ? 0 : 1 ),
+                monitor.targetId,
+                monitor.adapterId.LowPart,
+                monitor.adapterId.HighPart,
+                monitor.devicePath
+            );
+        }
+
+        if ( !ensureProgramDataDirectoryExists(nullptr) )
+            return false;
+
+        return UTILS_NAMESPACE::writeFileAtomically( CACHE_FILE_PATH, UTILS_NAMESPACE::wideStringToUtf8(contents) );
+
+    }
+
+    bool DisplayTopologyCache::deleteSavedData () {
+
+        // Don't modify the Display Topology Cache File in Stateless Mode.
+        if ( programSettings.statelessMode || !std::filesystem::exists(CACHE_FILE_PATH) )
+            return true;
+
+        return std::filesystem::remove(CACHE_FILE_PATH);
+
+    }
+
+
+    /* DisplayModeCatalog */
+    // Class Constants
+
+    const std::wstring DisplayModeCatalog::CATALOG_FILE_NAME = L"display_modes";
+    const std::filesystem::path DisplayModeCatalog::CATALOG_FILE_PATH = { PROGRAM_DATA_PATH / CATALOG_FILE_NAME };
+
+    // Static Methods
+
+    std::shared_future<DisplayModeCatalog::DisplayResolutionList> DisplayModeCatalog::requestSupportedResolutions ( const DisplayMonitor& monitor ) {
+
+        // The fingerprint of the Current Display Topology, which is empty if the catalog cannot be saved for it.
+        std::wstring fingerprint = DisplayTopologyCache::getCurrentFingerprint().value_or(L"");
+        // Fulfilled by the Background Thread once the Display Modes of the `monitor` have been enumerated.
+        std::promise<DisplayResolutionList> pendingResolutions = {};
+        // The `std::shared_future` returned by the method.
+        std::shared_future<DisplayResolutionList> resolutionsFuture = {};
+
+        std::lock_guard<std::mutex> lock(modeCatalogMutex);
+
+        // Replace the in-memory Display Mode Catalog whenever the Display Topology has changed.
+        if (modeCatalogFingerprint != fingerprint) {
+            modeCatalogFingerprint = fingerprint;
+            modeCatalogEntries.clear();
+            modeCatalogResolutions = ( fingerprint.empty() ? DisplayResolutionMap() : fetchFromFile(fingerprint) );
+
+            for ( const auto& [displayId, resolutions] : modeCatalogResolutions ) {
+                std::promise<DisplayResolutionList> savedResolutions = {};    // Immediately fulfilled with the saved Display Resolutions.
+
+                savedResolutions.set_value(resolutions);
+                modeCatalogEntries.emplace( displayId, savedResolutions.get_future().share() );
+            }
+        }
+
+        if ( auto entryItr = modeCatalogEntries.find(monitor.displayId); entryItr != modeCatalogEntries.end() )
+            return entryItr->second;
+
+        resolutionsFuture = pendingResolutions.get_future().share();
+        modeCatalogEntries.emplace(monitor.displayId, resolutionsFuture);
+
+        // Join the Background Threads that have already fulfilled their result, which no longer hold or need the `modeCatalogMutex`.
+        std::erase_if(
+            modeCatalogThreads,
+            [] ( const auto& catalogThread ) { return ( catalogThread.first.wait_for(std::chrono::seconds(0)) == std::future_status::ready ); }
+        );
+
+        // An owned thread is used rather than `std::async()`, as the destructor of the last `std::future` returned by
+        // `std::async()` blocks until it completes, which would happen while the `modeCatalogMutex` is held.
+        modeCatalogThreads.emplace_back(
+            resolutionsFuture,
+            [pendingResolutions = std::move(pendingResolutions), displayId = monitor.displayId, fingerprint] () mutable {
+
+                try {
+                    // The enumerated Display Resolutions of the Display Monitor.
+                    DisplayResolutionList resolutions = enumerateResolutions(displayId);
+
+                    {
+                        std::lock_guard<std::mutex> lock(modeCatalogMutex);
+
+                        // Only save the Display Resolutions if the Display Topology has not changed in the meantime.
+                        if ( modeCatalogFingerprint == fingerprint && !fingerprint.empty() ) {
+                            modeCatalogResolutions.insert_or_assign(displayId, resolutions);
+                            saveToFile(fingerprint, modeCatalogResolutions);
+                        }
+                    }
+
+                    pendingResolutions.set_value( std::move(resolutions) );
+                }
+                catch (...) {
+                    pendingResolutions.set_exception( std::current_exception() );
+                }
+
+            }
+        );
+
+        return resolutionsFuture;
+
+    }
+    DisplayModeCatalog::DisplayResolutionList DisplayModeCatalog::getSupportedResolutions ( const DisplayMonitor& monitor ) {
+
+        try {
+            return requestSupportedResolutions(monitor).get();
+        }
+        catch (...) {
+            return {};
+        }
+
+    }
+
+    DisplayModeCatalog::DisplayResolutionList DisplayModeCatalog::enumerateResolutions ( const std::wstring& displayId ) {
+
+        ScopedTraceTimer traceTimer = { "DisplayModeCatalog::enumerateResolutions", "display", displayId };
+        // A structure containing information about the Current Display Mode being enumerated.
+        DEVMODEW displayMode = { .dmSize = sizeof DEVMODEW, .dmDriverExtra = 0UL };
+        // The Width, Height, and Refresh Rate of each of the enumerated Display Modes,
+        // which are only converted into Display Resolutions once they have been deduplicated.
+        std::vector<std::tuple<DWORD, DWORD, DWORD>> displayModes = {};
+        // The distinct Display Resolutions of the enumerated Display Modes.
+        DisplayResolutionList resolutions = {};
+
+        for ( DWORD modeNum = 0UL; EnumDisplaySettingsW(displayId.c_str(), modeNum, &displayMode); modeNum++ )
+            displayModes.emplace_back(displayMode.dmPelsWidth, displayMode.dmPelsHeight, displayMode.dmDisplayFrequency);
+
+        // Display Modes that only differ in their Color Depth, Scaling, or Interlacing have the same Display Resolution.
+        std::sort( displayModes.begin(), displayModes.end(), std::greater<>() );
+        displayModes.erase( std::unique(displayModes.begin(), displayModes.end()), displayModes.end() );
+
+        resolutions.reserve( displayModes.size() );
+
+        for ( const auto& [displayWidth, displayHeight, refreshRate] : displayModes )
+            resolutions.emplace_back(displayWidth, displayHeight, refreshRate);
+
+        return resolutions;
+
+    }
+
+    // Serialization & Persistence to File
+
+    DisplayModeCatalog::DisplayResolutionMap DisplayModeCatalog::fetchFromFile ( const std::wstring& fingerprint ) {
+
+        // The cataloged Display Resolutions.
+        DisplayResolutionMap catalog = {};
+
+        // Don't read the Display Mode Catalog File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return catalog;
+
+        std::wistringstream fileStream(                 // The Stream used to read the Display Mode Catalog File.
+            UTILS_NAMESPACE::readTextFile(CATALOG_FILE_PATH).value_or(L"")
+        );
+        std::wstring currentLine = {};                  // Contains the Current Line from the Display Mode Catalog File.
+
+        // The first line of the Display Mode Catalog File contains the fingerprint it was saved for.
+        if ( !std::getline(fileStream, currentLine) || currentLine != fingerprint )
+            return catalog;
+
+        // Each subsequent line contains the Display ID of a Connected Display Monitor, followed by a Tab-Separated
+        // field for each of its Display Resolutions containing the Comma-Separated Width, Height, and Refresh Rate.
+        while ( std::getline(fileStream, currentLine) ) {
+            std::wistringstream lineStream(currentLine);    // The Input Stream used to read the fields of the Current Line.
+            std::wstring displayId = {};                    // The Display ID of the Connected Display Monitor.
+            std::wstring currentField = {};                 // The Current Field being read from the `lineStream`.
+            DisplayResolutionList resolutions = {};         // The Display Resolutions on the Current Line.
+
+            if ( currentLine.empty() || !std::getline(lineStream, displayId, L'\t') )
+                continue;
+
+            while ( std::getline(lineStream, currentField, L'\t') ) {
+                size_t heightPos = currentField.find(L',');     // The position of the Height.
+                size_t refreshRatePos = heightPos;              // The position of the Refresh Rate.
+
+                if (heightPos != std::wstring::npos)
+                    refreshRatePos = currentField.find(L',', heightPos + 1ULL);
+
+                // Treat the entire Display Mode Catalog File as invalid if any of its fields are invalid.
+                if (refreshRatePos == std::wstring::npos)
+                    return {};
+
+                try {
+                    resolutions.emplace_back(
+                        (DWORD) std::stoul( currentField.substr(0ULL, heightPos) ),
+                        (DWORD) std::stoul( currentField.substr(heightPos + 1ULL, refreshRatePos - heightPos - 1ULL) ),
+                        (DWORD) std::stoul( currentField.substr(refreshRatePos + 1ULL) )
+                    );
+                }
+                catch (...) {
+                    return {};
+                }
+            }
+
+            catalog.insert_or_assign( std::move(displayId), std::move(resolutions) );
+        }
+
+        return catalog;
+
+    }
+
+    bool DisplayModeCatalog::saveToFile ( const std::wstring& fingerprint, const DisplayResolutionMap& resolutions ) {
+
+        // Don't modify the Display Mode Catalog File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return true;
+
+        // The contents of the Display Mode Catalog File.
+        std::wstring contents = fingerprint;
+
+        for ( const auto& [displayId, monitorResolutions] : resolutions ) {
+            contents.append(L"\n").append(displayId);
+
+            for ( const DisplayMonitor::DisplayResolution& resolution : monitorResolutions ) {
+                std::format_to(
+                    std::back_inserter(contents),
+                    L"\t{:d},{:d},{:d}",
+                    resolution.displayWidth,
+                    resolution.displayHeight,
+                    resolution.refreshRate
+                );
+            }
+        }
+
+        if ( !ensureProgramDataDirectoryExists(nullptr) )
+            return false;
+
+        return UTILS_NAMESPACE::writeFileAtomically( CATALOG_FILE_PATH, UTILS_NAMESPACE::wideStringToUtf8(contents) );
+
+    }
+
+    bool DisplayModeCatalog::deleteSavedData () {
+
+        // Don't modify the Display Mode Catalog File in Stateless Mode.
+        if ( programSettings.statelessMode || !std::filesystem::exists(CATALOG_FILE_PATH) )
+            return true;
+
+        return std::filesystem::remove(CATALOG_FILE_PATH);
+
+    }
+
+
+    /* DisplayChangeListener */
+    // Class Constants
+
+    const std::wstring DisplayChangeListener::WINDOW_CLASS_NAME = L"TerrariaMonitorToolDisplayChangeListener";
+
+    // Class Constructors & Destructors
+
+    DisplayChangeListener::DisplayChangeListener () : listenerThread(&DisplayChangeListener::listen, this) {}
+
+    DisplayChangeListener::~DisplayChangeListener () {
+
+        // The handle to the hidden window, if it has been created yet.
+        HWND hWnd = NULL;
+
+        this->stopRequested = true;
+
+        // If the hidden window has not been created yet, the `listenerThread`
+        // will see the `stopRequested` flag once it has been.
+        if ( (hWnd = this->windowHandle.load()) != NULL )
+            PostMessageW(hWnd, WM_CLOSE, 0, 0);
+
+        if ( this->listenerThread.joinable() )
+            this->listenerThread.join();
+
+        if (this->displayChangeEvent != NULL)
+            CloseHandle(this->displayChangeEvent);
+
+    }
+
+    // Instance Methods
+
+    bool DisplayChangeListener::consumeDisplayChange () {
+
+        if ( !this->displayChanged.exchange(false) )
+            return false;
+
+        DisplayTopologyCache::deleteSavedData();
+        return true;
+
+    }
+
+    HANDLE DisplayChangeListener::getDisplayChangeEvent () const {
+
+        return this->displayChangeEvent;
+
+    }
+
+    // Helper Methods
+
+    void DisplayChangeListener::listen () {
+
+        HINSTANCE hInstance = GetModuleHandleW(NULL);   // The handle to the Program Executable.
+        HWND hWnd = NULL;                               // The handle to the hidden window.
+        MSG msg = {};                                   // The current message retrieved from the message queue.
+        WNDCLASSEXW windowClass = {                     // The Window Class of the hidden window.
+            .cbSize = sizeof(WNDCLASSEXW),
+            .lpfnWndProc = &DisplayChangeListener::windowProc,
+            .hInstance = hInstance,
+            .lpszClassName = WINDOW_CLASS_NAME.c_str()
+        };
+
+        RegisterClassExW(&windowClass);
+
+        // A Top-Level Window is required, as Message-Only Windows do not receive broadcast messages.
+        hWnd = CreateWindowExW(
+            WS_EX_TOOLWINDOW,
+            WINDOW_CLASS_NAME.c_str(),
+            L"",
+            WS_OVERLAPPED,
+            0, 0, 0, 0,
+            NULL,
+            NULL,
+            hInstance,
+            NULL
+        );
+
+        if (hWnd == NULL)
+            return;
+
+        SetWindowLongPtrW(hWnd, GWLP_USERDATA, (LONG_PTR) this);
+        this->windowHandle = hWnd;
+
+        if ( this->stopRequested.load() )
+            DestroyWindow(hWnd);
+
+        while ( GetMessageW(&msg, NULL, 0, 0) > 0 ) {
+            TranslateMessage(&msg);
+            DispatchMessageW(&msg);
+        }
+
+        UnregisterClassW(WINDOW_CLASS_NAME.c_str(), hInstance);
+
+    }
+
+    LRESULT CALLBACK DisplayChangeListener::windowProc ( HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam ) {
+
+        // The `DisplayChangeListener` that owns the hidden window.
+        DisplayChangeListener* listener = (DisplayChangeListener*) GetWindowLongPtrW(hWnd, GWLP_USERDATA);
+
+        switch (uMsg) {
+            case WM_DISPLAYCHANGE: {
+                if (listener != nullptr) {
+                    listener->displayChanged = true;
+                    SetEvent(listener->displayChangeEvent);
+                }
+
+                return 0;
+            }
+            case WM_DESTROY: {
+                PostQuitMessage(0);
+                return 0;
+            }
+        }
+
+        return DefWindowProcW(hWnd, uMsg, wParam, lParam);
+
+    }
+
+
+    /* Display Monitor Functions */
+
+    std::optional<DisplayMonitorList> getDisplayMonitors (
+        bool useCache,
+        _Out_ std::optional<std::wstring>* oErrorMessagePtr
+    ) {
+
+        // Times the entire query of the Connected Display Monitors.
+        ScopedTraceTimer traceTimer = { "getDisplayMonitors", "display" };
+        // The `std::optional<DisplayMonitorList>` returned by the method.
+        std::optional<DisplayMonitorList> finalMonitorList = std::make_optional<DisplayMonitorList>();
+        
+        // The `DisplayMonitor` objects of each Display Device, which are temporarily
+        // stored in the order they are enumerated before they are ultimately moved
+        // to the `finalMonitorList` in the order of their Display Paths.
+        DisplayMonitorList tempMonitorList = {};
+        // A map of Display IDs to the position of their `DisplayMonitor` within the `tempMonitorList`.
+        std::unordered_map<std::wstring, size_t> tempMonitorIndex = {};
+
+        // The Display Number of the current Display Monitor being processed. 
+        DisplayMonitor::display_number_t currentMonitorNum = 1U;
+
+        std::vector<DISPLAYCONFIG_PATH_INFO> configPaths;   // Configuration Paths to be used with the Windows API.
+        std::vector<DISPLAYCONFIG_MODE_INFO> configModes;   // Configuration Modes to be used with the Windows API.
+        LONG result = ERROR_SUCCESS;                        // The result of the most recent Windows API operation.
+
+        /**
+         * A lambda function used to print the last Windows API Error
+         * to the Console Error Output Buffer, or to store it in the
+         * `oErrorMessagePtr` if one was provided.
+         * 
+         * Depends on the `result` and `oErrorMessagePtr` variables.
+         * 
+         * @param msg   The message to print to the Console prior to the error message
+         *              returned by the Windows API, suffixed by ": ".
+         */
+        auto printWindowsApiError = [&result, oErrorMessagePtr]( const std::wstring& msg ) {
+
+            // A Null-Terminated Wide-Character String containing the error message returned by the Windows API.
+            // Must be freed using `LocalFree()` according to the Windows API.
+            LPWSTR errMsgBuf = nullptr;
+
+            FormatMessageW(
+                FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+                NULL,
+                result,
+                MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
+                (LPWSTR) &errMsgBuf,
+                0,
+                NULL
+            );
+
+            // The Display Monitors may be queried from a Background Thread, so the error message is posted to the `Console`,
+            // which is only discarded if the `Console` could not be created.
+            if (oErrorMessagePtr != nullptr)
+                *oErrorMessagePtr = (msg + L": " + errMsgBuf);
+            else if ( Console::console_ptr_t console = Console::getConsole() )
+                console->post( msg + L": " + UTILS_NAMESPACE::trimString(errMsgBuf), true );
+
+            LocalFree(errMsgBuf);
+
+        };
+
+        // Query the Active Display Paths, which are all that is needed to check the `DisplayTopologyCache`.
+        result = queryDisplayConfig(configPaths, configModes);
+
+        // Details about the Connected Display Monitors was successfully retrieved from the Windows API.
+        if (result == ERROR_SUCCESS) {
+            // The fingerprint of the Current Display Topology.
+            std::wstring topologyFingerprint = DisplayTopologyCache::getFingerprint(configPaths, configModes);
+
+            // Skip the remaining queries entirely if the Display Topology has not changed.
+            if (useCache) {
+                std::optional<DisplayMonitorList> cachedMonitorList = DisplayTopologyCache::fetchFromFile(topologyFingerprint);
+
+                if (cachedMonitorList)
+                    return cachedMonitorList;
+            }
+
+            // The pending lookups of the Device Names of each Display Path.
+            std::vector< std::future<DisplayPathNames> > pathNameLookups = {};
+
+            // Look up the Device Names of each Display Path concurrently,
+            // while the Display Devices are being enumerated below.
+            for (const auto& path : configPaths) {
+                pathNameLookups.push_back(std::async(
+                    std::launch::async,
+                    [path] () -> DisplayPathNames {
+
+                        DisplayPathNames pathNames = {
+                            .result = ERROR_SUCCESS,
+                            .targetName = {
+                                .header = {
+                                    .type = DISPLAYCONFIG_DEVICE_INFO_GET_TARGET_NAME,
+                                    .size = sizeof(DISPLAYCONFIG_TARGET_DEVICE_NAME),
+                                    .adapterId = path.targetInfo.adapterId,
+                                    .id = path.targetInfo.id
+                                }
+                            },
+                            .sourceName = {
+                                .header = {
+                                    .type = DISPLAYCONFIG_DEVICE_INFO_GET_SOURCE_NAME,
+                                    .size = sizeof(DISPLAYCONFIG_SOURCE_DEVICE_NAME),
+                                    .adapterId = path.sourceInfo.adapterId,
+                                    .id = path.sourceInfo.id
+                                }
+                            }
+                        };
+
+                        {
+                            ScopedTraceTimer apiTraceTimer = { "DisplayConfigGetDeviceInfo (Target Name)", "winapi" };
+                            pathNames.result = DisplayConfigGetDeviceInfo(&pathNames.targetName.header);
+                        }
+                        {
+                            ScopedTraceTimer apiTraceTimer = { "DisplayConfigGetDeviceInfo (Source Name)", "winapi" };
+                            pathNames.result &= DisplayConfigGetDeviceInfo(&pathNames.sourceName.header);
+                        }
+
+                        return pathNames;
+
+                    }
+                ));
+            }
+
+            // A structure containing information about the Current Resolution
+            // of the Current Display Monitor being processed.
+            DEVMODEW displayMode = { .dmSize = sizeof DEVMODEW, .dmDriverExtra = 0UL };
+            // A structure containing information about the Current Display Monitor being processed.
+            DISPLAY_DEVICEW displayDevice = { .cb = sizeof DISPLAY_DEVICEW };
+
+            /**
+             * A lambda function used to retrieve details about the Current Display Monitor being processed
+             * from the Windows API, timing the call when tracing is enabled.
+             *
+             * @returns     `true` if the Current Display Monitor exists, otherwise `false`.
+             */
+            auto enumCurrentDisplayDevice = [&currentMonitorNum, &displayDevice] () -> bool {
+
+                ScopedTraceTimer apiTraceTimer = { "EnumDisplayDevicesW", "winapi" };
+                return ( EnumDisplayDevicesW( NULL, (DWORD) (currentMonitorNum - 1), &displayDevice, 0 ) == TRUE );
+
+            };
+
+            // Retrieve details about each Connected Display Monitor from the Windows API.
+            while ( enumCurrentDisplayDevice() ) {
+                // Exclude Virtual and Disconnected Display Monitors. 
+                if (displayDevice.StateFlags & DISPLAY_DEVICE_ATTACHED_TO_DESKTOP) {
+                    {
+                        ScopedTraceTimer apiTraceTimer = { "EnumDisplaySettingsW", "winapi", displayDevice.DeviceName };
+                        EnumDisplaySettingsW(displayDevice.DeviceName, ENUM_CURRENT_SETTINGS, &displayMode);
+                    }
+
+                    // Store the details about the Current Display Monitor in the `tempMonitorList`
+                    // to be processed at the next stage.
+                    tempMonitorIndex.emplace( displayDevice.DeviceName, tempMonitorList.size() );
+                    tempMonitorList.emplace_back(
+                        currentMonitorNum,
+                        displayDevice.DeviceName,
+                        L"",
+                        displayMode.dmPelsWidth,
+                        displayMode.dmPelsHeight,
+                        displayMode.dmDisplayFrequency,
+                        (displayDevice.StateFlags & DISPLAY_DEVICE_PRIMARY_DEVICE)
+                    );
+                }
+
+                currentMonitorNum++;
+            }
+
+            // Ensure the `currentMonitorNum` is properly reset before being used again.
+            currentMonitorNum = 1U;
+
+            // Retrieve additional information about each of the Connected Display Monitors from the Windows API.
+            for (auto& pathNameLookup : pathNameLookups) {
+                // The Device Names of the Current Display Path, once they have been looked up.
+                DisplayPathNames pathNames = pathNameLookup.get();
+                // A structure type containing the Friendly Display Name of the Display Monitor.
+                const DISPLAYCONFIG_TARGET_DEVICE_NAME& targetName = pathNames.targetName;
+                // A structure type containing the Display ID of the Display Monitor.
+                const DISPLAYCONFIG_SOURCE_DEVICE_NAME& sourceName = pathNames.sourceName;
+
+                result = pathNames.result;
+
+                // Successfully retrieved information about the Current Display Monitor from the Windows API.
+                if (result == ERROR_SUCCESS) {
+                    // The entry in the `tempMonitorIndex` corresponding to the Current Display Monitor.
+                    auto indexItr = tempMonitorIndex.find(sourceName.viewGdiDeviceName);
+
+                    // Skip Display Paths whose Display Device was not enumerated as being attached to the desktop.
+                    if ( indexItr == tempMonitorIndex.end() )
+                        continue;
+
+                    // The Current Display Monitor being processed.
+                    DisplayMonitor& displayMonitor = tempMonitorList[indexItr->second];
+                    // Indicates if the Display Monitor is an Internal Device or not.
+                    bool isInternalDevice = (
+                           targetName.outputTechnology == DISPLAYCONFIG_OUTPUT_TECHNOLOGY_INTERNAL
+                        || targetName.outputTechnology == DISPLAYCONFIG_OUTPUT_TECHNOLOGY_DISPLAYPORT_EMBEDDED
+                        || targetName.outputTechnology == DISPLAYCONFIG_OUTPUT_TECHNOLOGY_UDI_EMBEDDED
+                    );
+
+                    displayMonitor.monitorName = (
+                        targetName.monitorFriendlyDeviceName[0] != L'\0'
+                            ? targetName.monitorFriendlyDeviceName
+                            : ( isInternalDevice ? L"Internal Display" : L"Unnamed Display" )
+                    );
+                    displayMonitor.targetId = targetName.header.id;
+                    displayMonitor.adapterId = targetName.header.adapterId;
+                    displayMonitor.devicePath = targetName.monitorDevicePath;
+                    finalMonitorList->push_back( std::move(displayMonitor) );
+                }
+                // Failed to retrieve information about the Current Display Monitor from the Windows API.
+                else {
+                    printWindowsApiError(L"Failed to Query Display Information from the Windows API");
+                    return std::optional<DisplayMonitorList>();
+                }
+
+                currentMonitorNum++;
+            }
+
+            DisplayTopologyCache::saveToFile(topologyFingerprint, *finalMonitorList);
+        }
+        // Failed to retrieve details about the Connected Display Monitors from the Windows API.
+        else {
+            printWindowsApiError(L"Failed to Query Display Configuration from the Windows API");
+            return std::optional<DisplayMonitorList>();
+        }
+
+        return finalMonitorList;
+
+    }
+
+    std::optional<DisplayMonitor> findDisplayMonitor (
+        const DisplayMonitorList& displayMonitors,
+        const std::wstring& selector
+    ) {
+
+        // The lowercase value of the `selector`.
+        std::wstring lcSelector = UTILS_NAMESPACE::stringToLowercase(selector);
+        // The lowercase value of the property of a Display Monitor being compared, whose buffer is reused for each comparison.
+        std::wstring lcValue = {};
+
+        /**
+         * A lambda function used to find the only Connected Display Monitor that satisfies the specified `predicate`.
+         * 
+         * @param predicate     A function returning `true` if the specified `DisplayMonitor` matches the `selector`.
+         * 
+         * @returns             The matching `DisplayMonitor`, wrapped in an `std::optional` object.
+         *                      If zero or multiple Display Monitors match, an empty `std::optional` is returned.
+         */
+        auto findOnlyMatch = [&displayMonitors] ( auto predicate ) -> std::optional<DisplayMonitor> {
+
+            std::optional<DisplayMonitor> match = {};   // The matching `DisplayMonitor`, if one has been found.
+
+            for (const auto& monitor : displayMonitors) {
+                if ( predicate(monitor) ) {
+                    if (match)
+                        return {};
+
+                    match = monitor;
+                }
+            }
+
+            return match;
+
+        };
+
+        // The Display Number of the Display Monitor.
+        if ( !selector.empty() && std::all_of(selector.begin(), selector.end(), [] ( wchar_t ch ) { return std::iswdigit(ch) != 0; }) ) {
+            for (const auto& monitor : displayMonitors)
+                if ( std::to_wstring(monitor.displayNum) == selector )
+                    return monitor;
+        }
+
+        // The Display ID of the Display Monitor.
+        for (const auto& monitor : displayMonitors) {
+            UTILS_NAMESPACE::stringToLowercase(monitor.displayId, lcValue);
+
+            if (lcValue == lcSelector)
+                return monitor;
+        }
+
+        // The EDID Manufacturer & Product Code, which is the second `#`-separated segment
+        // of the Device Path (e.g., `\\?\DISPLAY#DEL40F7#...`).
+        auto matchesEdidCode = [&lcSelector, &lcValue] ( const DisplayMonitor& monitor ) {
+
+            std::wstring& lcDevicePath = lcValue;                                               // The lowercase Device Path.
+            size_t codeStartPos = std::wstring::npos;                                           // The position of the first `#`.
+            size_t codeEndPos = std::wstring::npos;                                             // The position of the second `#`.
+
+            UTILS_NAMESPACE::stringToLowercase(monitor.devicePath, lcDevicePath);
+            codeStartPos = lcDevicePath.find(L'#');
+
+            if (codeStartPos != std::wstring::npos)
+                codeEndPos = lcDevicePath.find(L'#', codeStartPos + 1ULL);
+
+            if (codeEndPos == std::wstring::npos)
+                return false;
+
+            return ( lcDevicePath.compare(codeStartPos + 1ULL, codeEndPos - codeStartPos - 1ULL, lcSelector) == 0 );
+
+        };
+
+        if ( std::optional<DisplayMonitor> match = findOnlyMatch(matchesEdidCode) )
+            return match;
+
+        // The Friendly Display Name of the Display Monitor.
+        return findOnlyMatch( [&lcSelector, &lcValue] ( const DisplayMonitor& monitor ) {
+
+            UTILS_NAMESPACE::stringToLowercase(monitor.monitorName, lcValue);
+            return (lcValue == lcSelector);
+
+        } );
+
+    }
+
+}
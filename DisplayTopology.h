@@ -0,0 +1,361 @@
+#pragma once
+
+
+/*
+* DisplayTopology.h
+*
+* Header File defining the `DisplayTopologyCache`, `DisplayModeCatalog`, and `DisplayChangeListener` classes,
+* which are used to avoid querying the Windows API for the details of every
+* Connected Display Monitor unless the Display Topology has actually changed,
+* as well as the functions used to retrieve the Connected Display Monitors.
+*/
+
+
+#include "framework.h"
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <unordered_map>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/**
+	 * A class providing a persistent cache of the Connected Display Monitors,
+	 * keyed by a fingerprint of the Active Display Paths returned by the Windows API.
+	 *
+	 * Computing the fingerprint only requires the results of `QueryDisplayConfig()`,
+	 * allowing the comparatively expensive calls to `EnumDisplayDevicesW()`, `EnumDisplaySettingsW()`,
+	 * and `DisplayConfigGetDeviceInfo()` to be skipped whenever the fingerprint matches the cache.
+	 */
+	class DisplayTopologyCache {
+
+		/* Class Constants */
+		protected:
+			static const std::wstring CACHE_FILE_NAME;			// The name of the file used to store the Display Topology Cache.
+			static const std::filesystem::path CACHE_FILE_PATH;	// The path to the file used to store the Display Topology Cache.
+
+
+		/* Static Methods */
+		public:
+			/**
+			 * Compute the fingerprint of the Display Topology described by the specified
+			 * Display Configuration Paths and Modes returned by `QueryDisplayConfig()`.
+			 *
+			 * The fingerprint covers the Adapter and Target IDs, Refresh Rate, and Rotation of each
+			 * Display Path, as well as the Resolution and Position of each Source Mode, so that
+			 * changes to the Display Resolution of a Connected Display Monitor also invalidate the cache.
+			 *
+			 * @param configPaths	The Display Configuration Paths returned by `QueryDisplayConfig()`.
+			 * @param configModes	The Display Configuration Modes returned by `QueryDisplayConfig()`.
+			 *
+			 * @returns				A Wide-Character String containing the fingerprint of the Display Topology.
+			 */
+			static std::wstring getFingerprint (
+				const std::vector<DISPLAYCONFIG_PATH_INFO>& configPaths,
+				const std::vector<DISPLAYCONFIG_MODE_INFO>& configModes
+			);
+			/**
+			 * Compute the fingerprint of the Current Display Topology.
+			 *
+			 * Only `QueryDisplayConfig()` is used to compute the fingerprint, so it is
+			 * cheap enough to be computed whenever the Current Display Topology needs to be checked.
+			 *
+			 * @returns		A Wide-Character String containing the fingerprint of the Current Display Topology,
+			 * 				wrapped in an `std::optional` object.
+			 *
+			 * 				If the Display Configuration could not be queried from the Windows API,
+			 * 				an empty `std::optional` will be returned.
+			 */
+			static std::optional<std::wstring> getCurrentFingerprint ();
+
+
+		/* Serialization & Persistence to File */
+		public:
+			/**
+			 * Fetch the Connected Display Monitors from the Display Topology Cache File,
+			 * as long as they were saved for a Display Topology with the specified `fingerprint`.
+			 *
+			 * The Display Topology Cache is stored in a file located at `CACHE_FILE_PATH`,
+			 * and is never read from in Stateless Mode.
+			 *
+			 * @param fingerprint	The fingerprint of the Current Display Topology, as returned by `getFingerprint()`.
+			 *
+			 * @returns				A `DisplayMonitorList` containing the cached Connected Display Monitors,
+			 * 						wrapped in an `std::optional` object.
+			 *
+			 * 						If the Display Topology Cache File does not exist, is invalid, or was saved
+			 * 						for a different Display Topology, an empty `std::optional` will be returned.
+			 */
+			static std::optional<DisplayMonitorList> fetchFromFile ( const std::wstring& fingerprint );
+
+			/**
+			 * Save the specified Connected Display Monitors to the Display Topology Cache File.
+			 *
+			 * The Display Topology Cache is stored in a file located at `CACHE_FILE_PATH`,
+			 * and is never written to in Stateless Mode.
+			 *
+			 * @param fingerprint		The fingerprint of the Current Display Topology, as returned by `getFingerprint()`.
+			 * @param displayMonitors	The Connected Display Monitors of the Current Display Topology.
+			 *
+			 * @returns					`true` on success and `false` on failure.
+			 */
+			static bool saveToFile ( const std::wstring& fingerprint, const DisplayMonitorList& displayMonitors );
+			/**
+			 * Delete the Display Topology Cache File, forcing the next query to retrieve
+			 * the details of every Connected Display Monitor from the Windows API.
+			 *
+			 * @returns		`true` if the Display Topology Cache File was successfully
+			 * 				deleted or does not currently exist.
+			 *
+			 * 				Returns `false` if the Display Topology Cache File
+			 * 				could not be successfully deleted.
+			 */
+			static bool deleteSavedData ();
+
+	};
+
+	/**
+	 * A class providing a catalog of the Display Resolutions supported by each Connected Display Monitor.
+	 *
+	 * Display Drivers typically report hundreds of Display Modes for each Display Monitor, many of which only
+	 * differ in their Color Depth or Scaling, so the Display Modes of a Display Monitor are only enumerated once
+	 * they are actually needed, and are deduplicated into a sorted list of Display Resolutions.
+	 *
+	 * The catalog is kept in memory as well as in a persistent cache keyed by the fingerprint of the Display Topology,
+	 * as returned by `DisplayTopologyCache::getCurrentFingerprint()`, so the Display Modes of a Display Monitor
+	 * are only enumerated again once the Display Topology has changed.
+	 */
+	class DisplayModeCatalog {
+
+		/* Type Definitions */
+		public:
+			// The Display Resolutions supported by a Connected Display Monitor, sorted from the largest to the smallest.
+			typedef std::vector<DisplayMonitor::DisplayResolution> DisplayResolutionList;
+			// A Map of Display IDs to the Display Resolutions supported by the corresponding Connected Display Monitor.
+			typedef std::unordered_map<std::wstring, DisplayResolutionList> DisplayResolutionMap;
+
+
+		/* Class Constants */
+		protected:
+			static const std::wstring CATALOG_FILE_NAME;			// The name of the file used to store the Display Mode Catalog.
+			static const std::filesystem::path CATALOG_FILE_PATH;	// The path to the file used to store the Display Mode Catalog.
+
+
+		/* Static Methods */
+		public:
+			/**
+			 * Request the Display Resolutions supported by the specified Connected Display Monitor.
+			 *
+			 * If the Display Resolutions have not been cataloged for the Current Display Topology yet,
+			 * the Display Modes of the Display Monitor are enumerated on a Background Thread,
+			 * so this method always returns immediately.
+			 *
+			 * @param monitor	The `DisplayMonitor` corresponding to the Connected Display Monitor.
+			 *
+			 * @returns			An `std::shared_future` that becomes ready once the supported Display Resolutions
+			 * 					are available, which it already is whenever they have been cataloged before.
+			 */
+			static std::shared_future<DisplayResolutionList> requestSupportedResolutions ( const DisplayMonitor& monitor );
+			/**
+			 * Get the Display Resolutions supported by the specified Connected Display Monitor,
+			 * waiting for the Display Modes of the Display Monitor to be enumerated if necessary.
+			 *
+			 * @param monitor	The `DisplayMonitor` corresponding to the Connected Display Monitor.
+			 *
+			 * @returns			The supported Display Resolutions, which is empty if
+			 * 					they could not be retrieved from the Windows API.
+			 */
+			static DisplayResolutionList getSupportedResolutions ( const DisplayMonitor& monitor );
+
+		protected:
+			/**
+			 * Enumerate the Display Modes of the specified Display Device using the Windows API.
+			 *
+			 * @param displayId		The Display ID of the Display Device (e.g., `\\.\DISPLAY1`).
+			 *
+			 * @returns				The distinct Display Resolutions of the Display Modes, sorted from the largest to the smallest.
+			 */
+			static DisplayResolutionList enumerateResolutions ( const std::wstring& displayId );
+
+
+		/* Serialization & Persistence to File */
+		public:
+			/**
+			 * Fetch the cataloged Display Resolutions from the Display Mode Catalog File,
+			 * as long as they were saved for a Display Topology with the specified `fingerprint`.
+			 *
+			 * The Display Mode Catalog is stored in a file located at `CATALOG_FILE_PATH`,
+			 * and is never read from in Stateless Mode.
+			 *
+			 * @param fingerprint	The fingerprint of the Current Display Topology, as returned by `DisplayTopologyCache::getFingerprint()`.
+			 *
+			 * @returns				A `DisplayResolutionMap` containing the cataloged Display Resolutions, which is empty
+			 * 						if the Display Mode Catalog File does not exist, is invalid, or was saved for a different Display Topology.
+			 */
+			static DisplayResolutionMap fetchFromFile ( const std::wstring& fingerprint );
+
+			/**
+			 * Save the specified cataloged Display Resolutions to the Display Mode Catalog File.
+			 *
+			 * The Display Mode Catalog is stored in a file located at `CATALOG_FILE_PATH`,
+			 * and is never written to in Stateless Mode.
+			 *
+			 * @param fingerprint	The fingerprint of the Current Display Topology, as returned by `DisplayTopologyCache::getFingerprint()`.
+			 * @param resolutions	The cataloged Display Resolutions of the Connected Display Monitors.
+			 *
+			 * @returns				`true` on success and `false` on failure.
+			 */
+			static bool saveToFile ( const std::wstring& fingerprint, const DisplayResolutionMap& resolutions );
+			/**
+			 * Delete the Display Mode Catalog File.
+			 *
+			 * @returns		`true` if the Display Mode Catalog File was successfully
+			 * 				deleted or does not currently exist, otherwise `false`.
+			 */
+			static bool deleteSavedData ();
+
+	};
+
+	/**
+	 * A class that listens for changes to the Display Topology in the background.
+	 *
+	 * As the program is a Console Application, it does not otherwise own a window that
+	 * could receive the `WM_DISPLAYCHANGE` message broadcast by Windows whenever the
+	 * Display Resolution or set of Connected Display Monitors changes. The `DisplayChangeListener`
+	 * creates a hidden Top-Level Window on its own thread for the sole purpose of receiving it.
+	 */
+	class DisplayChangeListener {
+
+		/* Class Constants */
+		protected:
+			static const std::wstring WINDOW_CLASS_NAME;	// The name of the Window Class registered for the hidden window.
+
+
+		/* Instance Properties */
+		private:
+			std::atomic<HWND> windowHandle = NULL;		// The handle to the hidden window, once it has been created.
+			std::atomic<bool> stopRequested = false;	// Indicates if the `DisplayChangeListener` is being destroyed.
+			std::atomic<bool> displayChanged = false;	// Indicates if the Display Topology has changed since it was last checked.
+			// An Auto-Reset Event that is signaled whenever the Display Topology changes.
+			HANDLE displayChangeEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+			std::thread listenerThread;					// The thread running the message loop of the hidden window.
+
+
+		/* Class Constructors & Destructors */
+		public:
+			/**
+			 * Construct a new `DisplayChangeListener`, which immediately
+			 * begins listening for changes to the Display Topology.
+			 */
+			DisplayChangeListener ();
+			DisplayChangeListener ( const DisplayChangeListener& ) = delete;
+			DisplayChangeListener& operator= ( const DisplayChangeListener& ) = delete;
+
+			/**
+			 * Destroy the `DisplayChangeListener`, closing the hidden window and waiting for its thread to exit.
+			 */
+			~DisplayChangeListener ();
+
+
+		/* Instance Methods */
+		public:
+			/**
+			 * Determine if the Display Topology has changed since this method was last called,
+			 * resetting the result for subsequent calls.
+			 *
+			 * When a change is detected, the Display Topology Cache File is deleted as well.
+			 *
+			 * @returns		`true` if the Display Topology has changed, otherwise `false`.
+			 */
+			bool consumeDisplayChange ();
+			/**
+			 * Get the Auto-Reset Event that is signaled whenever the Display Topology changes,
+			 * allowing a thread to wait for a change without polling `consumeDisplayChange()`.
+			 *
+			 * @returns		The handle to the Event, which remains owned by the `DisplayChangeListener`.
+			 */
+			HANDLE getDisplayChangeEvent () const;
+
+
+		/* Helper Methods */
+		protected:
+			/**
+			 * Create the hidden window and run its message loop until the `DisplayChangeListener` is destroyed.
+			 */
+			void listen ();
+
+			/**
+			 * The Window Procedure of the hidden window.
+			 *
+			 * @param hWnd		The handle to the hidden window.
+			 * @param uMsg		The message being processed.
+			 * @param wParam	Additional message-specific information.
+			 * @param lParam	Additional message-specific information.
+			 *
+			 * @returns			The result of processing the message.
+			 */
+			static LRESULT CALLBACK windowProc ( HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam );
+
+	};
+
+
+	/* Display Monitor Functions */
+
+	/**
+	 * Get the Connected Display Monitors that can be set as 
+	 * the Active Display Monitor in the Terraria Configuration File. 
+	 * 
+	 * Unless the Display Topology has changed since the Connected Display Monitors were last retrieved,
+	 * they are loaded from the `DisplayTopologyCache` instead of being queried from the Windows API.
+	 * 
+	 * The Device Names of each Display Path are looked up concurrently,
+	 * while the Display Devices are being enumerated.
+	 * 
+	 * @param useCache          Indicates if the `DisplayTopologyCache` can be used.
+	 *                          When `false`, the details of every Connected Display Monitor are always queried.
+	 * 
+	 * @param oErrorMessagePtr  An optional pointer to an `std::optional` Wide-Character String that will be populated
+	 *                          with the error message returned by the Windows API on failure, instead of printing it
+	 *                          to the Console Error Output Buffer. This allows the function to be run on another thread.
+	 * 
+	 * @return                  A `DisplayMonitorList` containing the Connected Display Monitors,
+	 *                          wrapped in an `std::optional` object.
+	 * 
+	 *                          If the Connected Display Monitors could not be retrieved due to
+	 *                          an error with the Windows API, an empty `std::optional` will be returned.
+	 */
+	std::optional<DisplayMonitorList> getDisplayMonitors (
+		bool useCache = true,
+		_Out_ std::optional<std::wstring>* oErrorMessagePtr = nullptr
+	);
+
+	/**
+	 * Find the Connected Display Monitor identified by the specified `selector`.
+	 * 
+	 * The `selector` is compared against each Connected Display Monitor in the following order:
+	 * 
+	 *  1. The Display Number of the Display Monitor (e.g., `2`).
+	 *  2. The Display ID of the Display Monitor.
+	 *  3. The EDID Manufacturer & Product Code embedded in the Device Path (e.g., `DEL40F7`).
+	 *  4. The Friendly Display Name of the Display Monitor (e.g., `DELL U2719D`).
+	 * 
+	 * All comparisons are case-insensitive.
+	 * 
+	 * @param displayMonitors   The `DisplayMonitorList` containing the Connected Display Monitors.
+	 * 
+	 * @param selector          A Wide-Character String identifying the Display Monitor.
+	 * 
+	 * @returns                 The `DisplayMonitor` identified by the `selector`, wrapped in an `std::optional` object.
+	 * 
+	 *                          If no Connected Display Monitor matches the `selector`, or if more than one
+	 *                          Connected Display Monitor shares the same EDID Code or Friendly Display Name,
+	 *                          an empty `std::optional` will be returned.
+	 */
+	std::optional<DisplayMonitor> findDisplayMonitor (
+		const DisplayMonitorList& displayMonitors,
+		const std::wstring& selector
+	);
+
+}
@@ -0,0 +1,486 @@
+/*
+* MonitorPresets.cpp
+*
+* Source File defining the `MonitorPresetStore` class, which remembers named Monitor Presets
+* that each bind a set of Terraria Configuration Files to a Display Monitor and Display Resolution,
+* along with the Patch Plans used to apply them without parsing any of the files again.
+*/
+
+
+#include "MonitorPresets.h"
+#include "ConfigurationBackups.h"
+#include "Tracing.h"
+#include "WatchMode.h"
+
+#include <algorithm>
+#include <iostream>
+#include <tuple>
+#include <utility>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Helper Functions */
+
+    /**
+     * Get the size and Last Write Time of a file from its directory entry, without opening it.
+     *
+     * @param filePath  The path to the file.
+     *
+     * @returns         An `std::optional` containing the size of the file in bytes and the time it was last modified
+     *                  as a `FILETIME` value, in that order, which is empty if the file does not exist.
+     */
+    static std::optional< std::pair<uint64_t, uint64_t> > getFileStamp ( const std::wstring& filePath ) {
+
+        WIN32_FILE_ATTRIBUTE_DATA attributes = {};      // Receives the attributes of the file.
+
+        if ( !GetFileAttributesExW(filePath.c_str(), GetFileExInfoStandard, &attributes) )
+            return std::nullopt;
+
+        return std::make_pair(
+            ( ((uint64_t) attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow ),
+            ( ((uint64_t) attributes.ftLastWriteTime.dwHighDateTime << 32) | attributes.ftLastWriteTime.dwLowDateTime )
+        );
+
+    }
+
+    /**
+     * Read a length-prefixed UTF-8 Encoded string from the Monitor Presets File.
+     *
+     * @param reader    The `BinaryReader` being read from.
+     *
+     * @returns         The decoded string, which is empty if the `reader` has failed.
+     */
+    static std::wstring readString ( UTILS_NAMESPACE::BinaryReader& reader ) {
+
+        return UTILS_NAMESPACE::utf8ToWideString( UTILS_NAMESPACE::readBytes(reader) );
+
+    }
+
+
+    /* MonitorPresetStore */
+    // Class Constants
+
+    const std::wstring MonitorPresetStore::PRESETS_FILE_NAME = L"monitor_presets";
+    const std::filesystem::path MonitorPresetStore::PRESETS_FILE_PATH = { PROGRAM_DATA_PATH / PRESETS_FILE_NAME };
+    const std::string_view MonitorPresetStore::PRESETS_FILE_SIGNATURE = { "TMPS\x01", 5ULL };
+
+    // Static Methods
+
+    bool MonitorPresetStore::savePreset (
+        const std::wstring& name,
+        const DisplayMonitor& monitor,
+        const std::optional<DisplayMonitor::DisplayResolution>& resolution,
+        const std::vector<std::wstring>& filePaths
+    ) {
+
+        MonitorPresetMap presets = fetchFromFile();     // The existing Monitor Presets.
+        // The fingerprint of the Current Display Topology, which the Display ID of the `monitor` belongs to.
+        std::optional<std::wstring> fingerprint = DisplayTopologyCache::getCurrentFingerprint();
+        // The Monitor Preset being saved.
+        MonitorPreset preset = {
+            .name = name,
+            .stableId = monitor.getStableId(),
+            .displayId = monitor.displayId,
+            .topologyFingerprint = fingerprint.value_or(L""),
+            .resolution = resolution.value_or(monitor.currentResolution)
+        };
+
+        for ( const std::wstring& filePath : filePaths ) {
+            std::error_code errorCode = {};     // Receives any errors raised while resolving the absolute path.
+            std::wstring absolutePath = std::filesystem::absolute(filePath, errorCode).wstring();
+
+            // Each Terraria Configuration File only needs a single Patch Plan.
+            if (
+                std::any_of(
+                    preset.patchPlans.begin(),
+                    preset.patchPlans.end(),
+                    [&absolutePath] ( const PatchPlan& plan ) { return plan.filePath == absolutePath; }
+                )
+            ) {
+                continue;
+            }
+
+            // The Patch Plan of the Terraria Configuration File.
+            std::optional<PatchPlan> patchPlan = compilePatchPlan( (errorCode ? filePath : absolutePath), preset.displayId, preset.resolution );
+
+            if (!patchPlan)
+                return false;
+
+            preset.patchPlans.push_back( std::move(*patchPlan) );
+        }
+
+        presets.insert_or_assign( name, std::move(preset) );
+        return saveToFile(presets);
+
+    }
+
+    bool MonitorPresetStore::deletePreset ( const std::wstring& name ) {
+
+        MonitorPresetMap presets = fetchFromFile();     // The existing Monitor Presets.
+
+        if ( presets.erase(name) == 0ULL )
+            return false;
+
+        return saveToFile(presets);
+
+    }
+
+    std::optional<MonitorPresetStore::PresetApplyResultList> MonitorPresetStore::applyPreset (
+        const std::wstring& name,
+        _Out_ std::optional<std::wstring>* oErrorMessagePtr
+    ) {
+
+        // Times the entire application of the Monitor Preset.
+        ScopedTraceTimer traceTimer = { "MonitorPresetStore::applyPreset", "config", name };
+        MonitorPresetMap presets = fetchFromFile();                 // The existing Monitor Presets.
+        MonitorPresetMap::iterator presetItr = presets.find(name);  // The Monitor Preset being applied.
+
+        if ( presetItr == presets.end() )
+            return std::nullopt;
+
+        MonitorPreset& preset = presetItr->second;                  // The Monitor Preset being applied.
+        PresetApplyResultList results = {};                         // The result for each of the Terraria Configuration Files.
+        std::vector<std::wstring> writtenFilePaths = {};            // The paths to the Terraria Configuration Files that were written.
+        std::optional<DisplayMonitor> monitor = {};                 // The Display Monitor of the `preset`, once it has been found.
+        bool monitorLookupAttempted = false;                        // Indicates if the Connected Display Monitors have been retrieved.
+        // The fingerprint of the Current Display Topology, which is all that is queried from the Windows API when every Patch Plan is current.
+        std::optional<std::wstring> fingerprint = DisplayTopologyCache::getCurrentFingerprint();
+        // The Display ID recorded by the Patch Plans is only valid for the Display Topology they were compiled for.
+        bool isTopologyCurrent = ( fingerprint && *fingerprint == preset.topologyFingerprint );
+
+        for ( const PatchPlan& plan : preset.patchPlans ) {
+            PresetApplyResult& result = results.emplace_back( PresetApplyResult{ .filePath = plan.filePath } );
+
+            if ( isTopologyCurrent && isPatchPlanCurrent(plan) ) {
+                std::string outputData = {};    // The patched contents of the Terraria Configuration File.
+                bool isModified = false;        // Indicates if the patched contents differ from the existing contents.
+
+                // The Terraria Configuration File must be unmapped before it can be replaced.
+                {
+                    // The Terraria Configuration File, mapped into memory so that it is read all at once.
+                    UTILS_NAMESPACE::MemoryMappedFile file = { plan.filePath };
+                    // The raw contents of the Terraria Configuration File.
+                    std::string_view contents = file.getContents();
+
+                    if ( file.isOpen() && contents.size() == plan.fileSize ) {
+                        ScopedTraceTimer patchTraceTimer = { "Apply Patch Plan", "config", plan.filePath };
+
+                        outputData = applyConfigFilePatches(contents, plan.patches);
+                        isModified = (outputData != contents);
+                        result.usedPatchPlan = true;
+
+                        if ( isModified && !programSettings.dryRun )
+                            ConfigurationBackupStore::recordGeneration(plan.filePath, contents);
+                    }
+                }
+
+                if (result.usedPatchPlan) {
+                    result.success = ( !isModified || programSettings.dryRun || UTILS_NAMESPACE::writeFileAtomically(plan.filePath, outputData) );
+
+                    if ( result.success && isModified ) {
+                        result.changedValues = plan.changedValues;
+
+                        if ( !programSettings.dryRun )
+                            writtenFilePaths.push_back(plan.filePath);
+                    }
+                }
+            }
+
+            // Stale Patch Plans fall back to finding the Display Monitor and parsing the Terraria Configuration File.
+            if ( !result.usedPatchPlan ) {
+                if ( !std::exchange(monitorLookupAttempted, true) ) {
+                    // The Connected Display Monitors, which are usually loaded from the `DisplayTopologyCache`.
+                    std::optional<DisplayMonitorList> displayMonitors = getDisplayMonitors(true, oErrorMessagePtr);
+
+                    if (displayMonitors) {
+                        auto monitorItr = std::find_if(
+                            displayMonitors->cbegin(),
+                            displayMonitors->cend(),
+                            [&preset] ( const DisplayMonitor& connectedMonitor ) { return connectedMonitor.getStableId() == preset.stableId; }
+                        );
+
+                        if ( monitorItr != displayMonitors->cend() )
+                            monitor = *monitorItr;
+                    }
+                }
+
+                if (monitor) {
+                    ConfigurationFile configFile = { plan.filePath };
+
+                    result.success = (
+                           configFile.isOpen()
+                        && setActiveMonitorInConfigFile(configFile, *monitor, result.changedValues, preset.resolution)
+                    );
+
+                    if ( result.success && !result.changedValues.empty() && !programSettings.dryRun )
+                        writtenFilePaths.push_back(plan.filePath);
+                }
+            }
+
+            // Watch Mode should keep the Display Monitor of the `preset` rather than reverting it.
+            if ( result.success && !programSettings.dryRun )
+                MonitorAssignmentStore::assignMonitor(plan.filePath, preset.stableId);
+        }
+
+        // Compile the Patch Plans again for every file that was written, as well as every Patch Plan of the `preset`
+        // once its Display Monitor has been found in a new Display Topology, so the next switch can be applied directly.
+        if ( !programSettings.dryRun && fingerprint ) {
+            bool recompilePreset = ( monitor && !isTopologyCurrent );  // Indicates if every Patch Plan of the `preset` is compiled again.
+            bool presetsModified = false;                               // Indicates if any of the `presets` were compiled again.
+
+            if (recompilePreset) {
+                preset.displayId = monitor->displayId;
+                preset.topologyFingerprint = *fingerprint;
+                presetsModified = true;
+            }
+
+            for ( auto& [presetName, otherPreset] : presets ) {
+                // Monitor Presets compiled for another Display Topology are compiled again once they are applied.
+                if ( otherPreset.topologyFingerprint != *fingerprint )
+                    continue;
+
+                for ( PatchPlan& plan : otherPreset.patchPlans ) {
+                    if (
+                           !( recompilePreset && &otherPreset == &preset )
+                        && std::find(writtenFilePaths.begin(), writtenFilePaths.end(), plan.filePath) == writtenFilePaths.end()
+                    ) {
+                        continue;
+                    }
+
+                    if ( std::optional<PatchPlan> recompiledPlan = compilePatchPlan(plan.filePath, otherPreset.displayId, otherPreset.resolution) ) {
+                        plan = std::move(*recompiledPlan);
+                        presetsModified = true;
+                    }
+                }
+            }
+
+            if (presetsModified)
+                saveToFile(presets);
+        }
+
+        return results;
+
+    }
+
+    std::optional<MonitorPresetStore::PatchPlan> MonitorPresetStore::compilePatchPlan (
+        const std::wstring& filePath,
+        const std::wstring& displayId,
+        const DisplayMonitor::DisplayResolution& resolution
+    ) {
+
+        PatchPlan plan = { .filePath = filePath };      // The Patch Plan being compiled.
+        // The size and Last Write Time of the Terraria Configuration File, which are retrieved before it is read,
+        // so that a modification made while it is being read causes the Patch Plan to be stale rather than incorrect.
+        std::optional< std::pair<uint64_t, uint64_t> > fileStamp = getFileStamp(filePath);
+        // The Terraria Configuration File.
+        ConfigurationFile configFile = { filePath };
+
+        if ( !fileStamp || !configFile.isOpen() )
+            return std::nullopt;
+
+        std::tie(plan.fileSize, plan.lastWriteTime) = *fileStamp;
+
+        // Only the Display ID of the Display Monitor is written to the Terraria Configuration File.
+        plan.patches = planActiveMonitorPatches(
+            configFile,
+            DisplayMonitor( 0U, displayId, L"", resolution.displayWidth, resolution.displayHeight, resolution.refreshRate ),
+            plan.changedValues,
+            resolution
+        );
+
+        // The existing Active Display Monitor is rewritten by the patches even when it does not change.
+        if ( applyConfigFilePatches(configFile.getContents(), plan.patches) == configFile.getContents() ) {
+            plan.patches.clear();
+            plan.changedValues.clear();
+        }
+
+        return plan;
+
+    }
+
+    bool MonitorPresetStore::isPatchPlanCurrent ( const PatchPlan& patchPlan ) {
+
+        // The current size and Last Write Time of the Terraria Configuration File.
+        std::optional< std::pair<uint64_t, uint64_t> > fileStamp = getFileStamp(patchPlan.filePath);
+
+        return ( fileStamp && fileStamp->first == patchPlan.fileSize && fileStamp->second == patchPlan.lastWriteTime );
+
+    }
+
+    // Serialization & Persistence to File
+
+    MonitorPresetStore::MonitorPresetMap MonitorPresetStore::fetchFromFile () {
+
+        MonitorPresetMap presets = {};      // The saved Monitor Presets.
+
+        // Don't read the Monitor Presets File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return presets;
+
+        // The Monitor Presets File, mapped into memory so that it is read all at once.
+        UTILS_NAMESPACE::MemoryMappedFile file = { PRESETS_FILE_PATH.wstring() };
+        // Reads each of the fields of the Monitor Presets File in turn.
+        UTILS_NAMESPACE::BinaryReader reader = { file.getContents(), PRESETS_FILE_SIGNATURE.size(), false };
+
+        if ( !reader.contents.starts_with(PRESETS_FILE_SIGNATURE) )
+            return presets;
+
+        while ( reader.pos < reader.contents.size() ) {
+            MonitorPreset preset = {};      // The Monitor Preset being read.
+
+            preset.name = readString(reader);
+            preset.stableId = readString(reader);
+            preset.displayId = readString(reader);
+            preset.topologyFingerprint = readString(reader);
+
+            DWORD displayWidth = (DWORD) UTILS_NAMESPACE::readVarint(reader);
+            DWORD displayHeight = (DWORD) UTILS_NAMESPACE::readVarint(reader);
+            DWORD refreshRate = (DWORD) UTILS_NAMESPACE::readVarint(reader);
+
+            preset.resolution = DisplayMonitor::DisplayResolution(displayWidth, displayHeight, refreshRate);
+
+            for ( uint64_t planCount = UTILS_NAMESPACE::readVarint(reader); planCount > 0ULL && !reader.failed; planCount-- ) {
+                PatchPlan& plan = preset.patchPlans.emplace_back();     // The Patch Plan being read.
+
+                plan.filePath = readString(reader);
+                plan.fileSize = UTILS_NAMESPACE::readVarint(reader);
+                plan.lastWriteTime = UTILS_NAMESPACE::readVarint(reader);
+
+                for ( uint64_t patchCount = UTILS_NAMESPACE::readVarint(reader); patchCount > 0ULL && !reader.failed; patchCount-- ) {
+                    size_t startPos = (size_t) UTILS_NAMESPACE::readVarint(reader);
+                    size_t endPos = (size_t) UTILS_NAMESPACE::readVarint(reader);
+
+                    // Patches that overlap or run backwards would corrupt the Terraria Configuration File.
+                    if ( endPos < startPos || endPos > plan.fileSize || (!plan.patches.empty() && startPos < plan.patches.back().endPos) ) {
+                        reader.failed = true;
+                        break;
+                    }
+
+                    plan.patches.push_back( ConfigFilePatch{ startPos, endPos, std::string( UTILS_NAMESPACE::readBytes(reader) ) } );
+                }
+
+                for ( uint64_t changeCount = UTILS_NAMESPACE::readVarint(reader); changeCount > 0ULL && !reader.failed; changeCount-- ) {
+                    std::wstring propertyName = readString(reader);
+                    std::wstring oldValue = readString(reader);
+
+                    plan.changedValues.emplace( std::move(propertyName), std::make_pair( std::move(oldValue), readString(reader) ) );
+                }
+            }
+
+            // Discard the first truncated Monitor Preset, along with everything following it.
+            if (reader.failed)
+                break;
+
+            presets.insert_or_assign( preset.name, std::move(preset) );
+        }
+
+        return presets;
+
+    }
+
+    bool MonitorPresetStore::saveToFile ( const MonitorPresetMap& presets ) {
+
+        // Don't modify the Monitor Presets File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return true;
+
+        // The contents of the Monitor Presets File.
+        std::string contents( PRESETS_FILE_SIGNATURE );
+
+        for ( const auto& [name, preset] : presets ) {
+            UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(preset.name) );
+            UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(preset.stableId) );
+            UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(preset.displayId) );
+            UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(preset.topologyFingerprint) );
+            UTILS_NAMESPACE::writeVarint(contents, preset.resolution.displayWidth);
+            UTILS_NAMESPACE::writeVarint(contents, preset.resolution.displayHeight);
+            UTILS_NAMESPACE::writeVarint(contents, preset.resolution.refreshRate);
+            UTILS_NAMESPACE::writeVarint(contents, preset.patchPlans.size());
+
+            for ( const PatchPlan& plan : preset.patchPlans ) {
+                UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(plan.filePath) );
+                UTILS_NAMESPACE::writeVarint(contents, plan.fileSize);
+                UTILS_NAMESPACE::writeVarint(contents, plan.lastWriteTime);
+                UTILS_NAMESPACE::writeVarint(contents, plan.patches.size());
+
+                for ( const ConfigFilePatch& patch : plan.patches ) {
+                    UTILS_NAMESPACE::writeVarint(contents, patch.startPos);
+                    UTILS_NAMESPACE::writeVarint(contents, patch.endPos);
+                    UTILS_NAMESPACE::writeBytes(contents, patch.replacement);
+                }
+
+                UTILS_NAMESPACE::writeVarint(contents, plan.changedValues.size());
+
+                for ( const auto& [propertyName, values] : plan.changedValues ) {
+                    UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(propertyName) );
+                    UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(values.first) );
+                    UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8(values.second) );
+                }
+            }
+        }
+
+        if ( !ensureProgramDataDirectoryExists(nullptr) )
+            return false;
+
+        return UTILS_NAMESPACE::writeFileAtomically(PRESETS_FILE_PATH, contents);
+
+    }
+
+    bool MonitorPresetStore::deleteSavedData () {
+
+        // Don't modify the Monitor Presets File in Stateless Mode.
+        if ( programSettings.statelessMode || !std::filesystem::exists(PRESETS_FILE_PATH) )
+            return true;
+
+        return std::filesystem::remove(PRESETS_FILE_PATH);
+
+    }
+
+
+    /* Preset Mode Functions */
+
+    int runPresetMode ( const std::wstring& name ) {
+
+        // The paths printed below may contain any characters.
+        UTILS_NAMESPACE::useUtf16StandardStreams();
+
+        // The error message returned by the Windows API if the Connected Display Monitors could not be retrieved,
+        // which is printed here, as the `Console` is never created in Preset Mode.
+        std::optional<std::wstring> displayMonitorsError = {};
+        // The result of applying the Monitor Preset to each of its Terraria Configuration Files.
+        std::optional<MonitorPresetStore::PresetApplyResultList> results = MonitorPresetStore::applyPreset(name, &displayMonitorsError);
+        // The number of Terraria Configuration Files that could not be modified.
+        size_t failureCount = 0ULL;
+
+        if (!results) {
+            std::wcerr << L"No Monitor Preset named \"" << name << L"\" has been saved." << std::endl;
+            return ProgramStatusCode::PRESET_FAILURE;
+        }
+
+        if (displayMonitorsError)
+            std::wcerr << UTILS_NAMESPACE::trimString(*displayMonitorsError) << std::endl;
+
+        for ( const MonitorPresetStore::PresetApplyResult& result : *results ) {
+            if (!result.success) {
+                std::wcerr << L"Failed to apply the Monitor Preset to " << result.filePath << std::endl;
+                failureCount++;
+            }
+            else if ( !result.changedValues.empty() ) {
+                std::wcout << L"Changes were made to " << result.filePath << L':';
+
+                for ( const auto& [key, values] : result.changedValues )
+                    std::wcout << std::format(L"\n   + {:14s} {:s} --> {:s}", key + L":", values.first, values.second);
+
+                std::wcout << std::endl;
+            }
+            else {
+                std::wcout << L"No changes were made to " << result.filePath << L'.' << std::endl;
+            }
+        }
+
+        return ( failureCount == 0ULL ? ProgramStatusCode::SUCCESS : ProgramStatusCode::PRESET_FAILURE );
+
+    }
+
+}
@@ -0,0 +1,228 @@
+#pragma once
+
+
+/*
+* MonitorPresets.h
+*
+* Header File defining the `MonitorPresetStore` class, which remembers named Monitor Presets
+* that each bind a set of Terraria Configuration Files to a Display Monitor and Display Resolution,
+* along with the Patch Plans used to apply them without parsing any of the files again.
+*/
+
+
+#include "ConfigurationFile.h"
+#include "DisplayTopology.h"
+
+#include <cstdint>
+#include <map>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/**
+	 * A class providing a persistent store of named Monitor Presets.
+	 *
+	 * Each Monitor Preset records the Stable Identity of its Display Monitor (see `DisplayMonitor::getStableId()`),
+	 * as well as a precompiled Patch Plan for each of its Terraria Configuration Files, containing the exact
+	 * replacements to be made at already-resolved offsets within that file. As long as neither the file
+	 * nor the Display Topology have changed since the Patch Plan was compiled, applying the Monitor Preset
+	 * simply splices those replacements into the file and writes it, without parsing the file or enumerating
+	 * the Connected Display Monitors.
+	 *
+	 * Patch Plans that have become stale are compiled again the slow way the next time they are applied,
+	 * and every Monitor Preset referencing a file that was written is recompiled afterwards, so the next
+	 * switch between Monitor Presets can use the direct path again.
+	 */
+	class MonitorPresetStore {
+
+		/* Type Definitions */
+		public:
+			/**
+			 * A structure type representing the precompiled changes made to a single Terraria Configuration File by a Monitor Preset.
+			 */
+			typedef struct PatchPlanStruct {
+
+				std::wstring filePath = {};				// The absolute path to the Terraria Configuration File.
+				uint64_t fileSize = 0ULL;				// The size of the Terraria Configuration File when the Patch Plan was compiled, in bytes.
+				uint64_t lastWriteTime = 0ULL;			// The time the Terraria Configuration File was last modified when the Patch Plan was compiled, as a `FILETIME`.
+				ConfigFilePatchList patches = {};		// The patches setting the Active Display Monitor, which are empty if it is already set.
+				ChangedValuesMap changedValues = {};	// The Configuration Properties modified by the `patches`.
+
+			} PatchPlan;
+
+			/**
+			 * A structure type representing a named Monitor Preset.
+			 */
+			typedef struct MonitorPresetStruct {
+
+				std::wstring name = {};								// The name of the Monitor Preset.
+				std::wstring stableId = {};							// The Stable Identity of the Display Monitor.
+				std::wstring displayId = {};						// The Display ID of the Display Monitor when the Patch Plans were compiled.
+				std::wstring topologyFingerprint = {};				// The fingerprint of the Display Topology when the Patch Plans were compiled.
+				DisplayMonitor::DisplayResolution resolution = {	// The Display Resolution written to each of the Terraria Configuration Files.
+					0UL, 0UL, 0UL
+				};
+				std::vector<PatchPlan> patchPlans = {};				// The Patch Plan of each of the Terraria Configuration Files.
+
+			} MonitorPreset;
+
+			// A Map of the names of Monitor Presets to the Monitor Presets themselves.
+			typedef std::map<std::wstring, MonitorPreset> MonitorPresetMap;
+
+			/**
+			 * A structure type containing the result of applying a Monitor Preset to a single Terraria Configuration File.
+			 */
+			typedef struct PresetApplyResultStruct {
+
+				std::wstring filePath = {};				// The absolute path to the Terraria Configuration File.
+				bool success = false;					// Indicates if the Terraria Configuration File was successfully processed.
+				bool usedPatchPlan = false;				// Indicates if the precompiled Patch Plan was applied directly.
+				ChangedValuesMap changedValues = {};	// A Map containing the Modified Configuration Properties.
+
+			} PresetApplyResult;
+
+			// A collection of `PresetApplyResult` structures, in the same order as the Patch Plans of the Monitor Preset.
+			typedef std::vector<PresetApplyResult> PresetApplyResultList;
+
+
+		/* Class Constants */
+		protected:
+			static const std::wstring PRESETS_FILE_NAME;			// The name of the file used to store the Monitor Presets.
+			static const std::filesystem::path PRESETS_FILE_PATH;	// The path to the file used to store the Monitor Presets.
+			/**
+			 * The signature at the start of the Monitor Presets File, followed by each Monitor Preset in turn.
+			 *
+			 * Every string is stored as UTF-8 preceded by its length in bytes, and every integer, including
+			 * those lengths, is stored as an unsigned Variable-Length Integer of 7 bits per byte.
+			 */
+			static const std::string_view PRESETS_FILE_SIGNATURE;
+
+
+		/* Static Methods */
+		public:
+			/**
+			 * Save a Monitor Preset, compiling the Patch Plan of each of its Terraria Configuration Files
+			 * and replacing any Monitor Preset previously saved with the same name.
+			 *
+			 * @param name			The name of the Monitor Preset.
+			 * @param monitor		The Connected Display Monitor to be set as the Active Display Monitor.
+			 * @param resolution	The Display Resolution to be written. Defaults to the Current Display Resolution of the `monitor`.
+			 * @param filePaths		The paths to each of the Terraria Configuration Files.
+			 *
+			 * @returns				`true` on success. `false` if any of the Terraria Configuration Files
+			 * 						could not be opened, or the Monitor Presets File could not be written.
+			 */
+			static bool savePreset (
+				const std::wstring& name,
+				const DisplayMonitor& monitor,
+				const std::optional<DisplayMonitor::DisplayResolution>& resolution,
+				const std::vector<std::wstring>& filePaths
+			);
+			/**
+			 * Delete the Monitor Preset with the specified name.
+			 *
+			 * @param name	The name of the Monitor Preset.
+			 *
+			 * @returns		`true` if the Monitor Preset was deleted, otherwise `false`.
+			 */
+			static bool deletePreset ( const std::wstring& name );
+			/**
+			 * Apply the Monitor Preset with the specified name to each of its Terraria Configuration Files.
+			 *
+			 * Current Patch Plans are applied directly. Only when a Patch Plan is stale are the
+			 * Connected Display Monitors retrieved, and the Terraria Configuration File parsed,
+			 * in order to set the Active Display Monitor using `setActiveMonitorInConfigFile()`.
+			 * When performing a Dry Run, none of the Terraria Configuration Files are written to.
+			 *
+			 * @param name				The name of the Monitor Preset.
+			 * @param oErrorMessagePtr	An optional pointer passed on to `getDisplayMonitors()`, which is populated with the
+			 * 							error message returned by the Windows API if the Connected Display Monitors could not
+			 * 							be retrieved, instead of posting it to the `Console`. Must be provided wherever the
+			 * 							`Console` is not used, such as in Preset Mode.
+			 *
+			 * @returns					An `std::optional` containing the result for each of the Terraria Configuration Files,
+			 * 							which is empty if no Monitor Preset with the specified name exists.
+			 */
+			static std::optional<PresetApplyResultList> applyPreset (
+				const std::wstring& name,
+				_Out_ std::optional<std::wstring>* oErrorMessagePtr = nullptr
+			);
+
+		protected:
+			/**
+			 * Compile the Patch Plan of a Terraria Configuration File.
+			 *
+			 * @param filePath		The absolute path to the Terraria Configuration File.
+			 * @param displayId		The Display ID to be set as the Active Display Monitor.
+			 * @param resolution	The Display Resolution to be written.
+			 *
+			 * @returns				An `std::optional` containing the Patch Plan, which is
+			 * 						empty if the Terraria Configuration File could not be opened.
+			 */
+			static std::optional<PatchPlan> compilePatchPlan (
+				const std::wstring& filePath,
+				const std::wstring& displayId,
+				const DisplayMonitor::DisplayResolution& resolution
+			);
+			/**
+			 * Determine if a Patch Plan can still be applied to its Terraria Configuration File,
+			 * based on the size and Last Write Time of the file.
+			 *
+			 * @param patchPlan		The Patch Plan being checked.
+			 *
+			 * @returns				`true` if the Terraria Configuration File has not changed since the Patch Plan was compiled.
+			 */
+			static bool isPatchPlanCurrent ( const PatchPlan& patchPlan );
+
+
+		/* Serialization & Persistence to File */
+		public:
+			/**
+			 * Fetch the Monitor Presets from the Monitor Presets File.
+			 *
+			 * The Monitor Presets are stored in a file located at `PRESETS_FILE_PATH`,
+			 * and are never read from in Stateless Mode.
+			 *
+			 * @returns		A `MonitorPresetMap` containing the saved Monitor Presets, which is
+			 * 				empty if the Monitor Presets File does not exist or could not be parsed.
+			 */
+			static MonitorPresetMap fetchFromFile ();
+
+			/**
+			 * Save the specified Monitor Presets to the Monitor Presets File.
+			 *
+			 * The Monitor Presets are stored in a file located at `PRESETS_FILE_PATH`,
+			 * and are never written to in Stateless Mode.
+			 *
+			 * @param presets	The Monitor Presets being saved.
+			 *
+			 * @returns			`true` on success and `false` on failure.
+			 */
+			static bool saveToFile ( const MonitorPresetMap& presets );
+			/**
+			 * Delete the Monitor Presets File.
+			 *
+			 * @returns		`true` if the Monitor Presets File was successfully
+			 * 				deleted or does not currently exist, otherwise `false`.
+			 */
+			static bool deleteSavedData ();
+
+	};
+
+
+	/* Preset Mode Functions */
+
+	/**
+	 * Run the program in Preset Mode (`--preset`), applying the Monitor Preset with the specified name
+	 * to each of its Terraria Configuration Files using `MonitorPresetStore::applyPreset()`, and then exiting.
+	 *
+	 * Like Apply-Last Mode, Preset Mode never creates the `Console` or the `UserInterface`,
+	 * and prints the changes made to each Terraria Configuration File to the Standard Output Stream instead.
+	 *
+	 * @param name	The name of the Monitor Preset.
+	 *
+	 * @returns		The `ProgramStatusCode` to be returned by the program.
+	 */
+	int runPresetMode ( const std::wstring& name );
+
+}
@@ -8,14 +8,25 @@
  */
 
 
+#include "ConfigurationBackups.h"
+#include "ConfigurationFile.h"
 #include "Console.h"
+#include "DisplayTopology.h"
+#include "MonitorPresets.h"
+#include "Tracing.h"
 #include "UserInterface.h"
+#include "WatchMode.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 
 namespace PROGRAM_NAMESPACE {
@@ -23,393 +34,356 @@ namespace PROGRAM_NAMESPACE {
     /* Type Definitions */
 
     /**
-     * A type representing a Map of Configuration Property Names to an `std::pair`
-     * containing the old and new Configuration Property Values.
-     * 
-     * The Configuration Property Name and Property Values are all represented
-     * by Wide-Character Strings.
+     * A structure type containing the result of setting the Active Display Monitor
+     * in a single Terraria Configuration File while running in Non-Interactive Mode.
      */
-    typedef std::unordered_map< std::wstring, std::pair<std::wstring, std::wstring> > ChangedValuesMap;
+    typedef struct BatchResultStruct {
+
+        std::wstring filePath = {};                 // The path to the Terraria Configuration File.
+        bool success = false;                       // Indicates if the Terraria Configuration File was successfully processed.
+        ChangedValuesMap changedValues = {};        // A Map containing the Modified Configuration Properties.
+        std::wstring errorMessage = {};             // A message describing why the Terraria Configuration File could not be processed.
+
+    } BatchResult;
 
 
     /* Global Variables */
 
-    static Console::console_ptr_t console = {};         // The `Console` used to interact with the Windows Console.
-    static ChangedValuesMap changedValues = {};         // A Map containing the Modified Configuration Properties.
-    static std::wstring dryRunOutput = {};              // Used to store the output when performing a Dry Run (`--dry-run`).
-    std::optional<std::wstring> configFilePath = {};    // The path to the Terraria Configuration File being used.
+    static Console::console_ptr_t console = {};             // The `Console` used to interact with the Windows Console.
+    static ChangedValuesMap changedValues = {};             // A Map containing the Modified Configuration Properties.
+    static const ConfigurationFile* dryRunConfigFile = {};  // The Terraria Configuration File printed when performing a Dry Run (`--dry-run`).
+    std::optional<std::wstring> configFilePath = {};        // The path to the Terraria Configuration File being used.
 
 
     /* Helper Functions */
 
     /**
-     * Get the Connected Display Monitors that can be set as 
-     * the Active Display Monitor in the Terraria Configuration File. 
+     * Expand the specified paths to Terraria Configuration Files into the paths of the files they match.
      * 
-     * @return  A `DisplayMonitorList` containing the Connected Display Monitors,
-     *          wrapped in an `std::optional` object.
+     * @param configPathPatterns    The paths to each of the Terraria Configuration Files,
+     *                              each of which may contain the Wildcard Patterns accepted by `expandPathPattern()`.
      * 
-     *          If the Connected Display Monitors could not be retrieved due to
-     *          an error with the Windows API, an empty `std::optional` will be returned.
+     * @returns                     The paths matched by each of the `configPathPatterns` in turn,
+     *                              with any path matched by more than one of them only included once.
      */
-    static std::optional<DisplayMonitorList> getDisplayMonitors () {
-
-        // The `std::optional<DisplayMonitorList>` returned by the method.
-        std::optional<DisplayMonitorList> finalMonitorList = std::make_optional<DisplayMonitorList>();
-        
-        // A map of Display IDs to `DisplayMonitor` objects used
-        // to temporarily store the `DisplayMonitor` objects before
-        // they are ultimately moved to the `finalMonitorList`.
-        std::map<std::wstring, DisplayMonitor> tempMonitorMap = {};
-
-        // The Display Number of the current Display Monitor being processed. 
-        DisplayMonitor::display_number_t currentMonitorNum = 1U;
-
-        std::vector<DISPLAYCONFIG_PATH_INFO> configPaths;   // Configuration Paths to be used with the Windows API.
-        std::vector<DISPLAYCONFIG_MODE_INFO> configModes;   // Configuration Modes to be used with the Windows API.
-        UINT32 configFlags = QDC_ONLY_ACTIVE_PATHS;         // Configuration Flags to be passed to the Windows API.
-        LONG result = ERROR_SUCCESS;                        // The result of the most recent Windows API operation.
-
-        /**
-         * A lambda function used to print the last Windows API Error
-         * to the Console Error Output Buffer.
-         * 
-         * Depends on the `result` variable.
-         * 
-         * @param msg   The message to print to the Console prior to the error message
-         *              returned by the Windows API, suffixed by ": ".
-         */
-        auto printWindowsApiError = [&result]( const std::wstring& msg ) {
-
-            // A Null-Terminated Wide-Character String containing the error message returned by the Windows API.
-            // Must be freed using `LocalFree()` according to the Windows API.
-            LPWSTR errMsgBuf = nullptr;
-
-            FormatMessageW(
-                FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
-                NULL,
-                result,
-                MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
-                (LPWSTR) &errMsgBuf,
-                0,
-                NULL
-            );
+    static std::vector<std::wstring> expandConfigPathPatterns ( const std::vector<std::wstring>& configPathPatterns ) {
 
-            console->err().print(msg).print(L": ").println(errMsgBuf);
-            LocalFree(errMsgBuf);
+        std::vector<std::wstring> configFilePaths = {};         // The paths matched by the `configPathPatterns`.
+        std::unordered_set<std::wstring> matchedPaths = {};     // The paths already added to the `configFilePaths`.
 
-        };
+        for ( const std::wstring& pattern : configPathPatterns ) {
+            for ( std::wstring& filePath : UTILS_NAMESPACE::expandPathPattern(pattern) ) {
+                if ( matchedPaths.insert(filePath).second )
+                    configFilePaths.push_back( std::move(filePath) );
+            }
+        }
 
-        // Loop until the `configPaths` and `configModes` have been properly populated.
-        do {
-            UINT32 pathCount = 0U;  // The number of Display Paths returned by the Windows API.
-            UINT32 modeCount = 0U;  // The number of Display Modes returned by the Windows API.
+        return configFilePaths;
 
-            result = GetDisplayConfigBufferSizes(configFlags, &pathCount, &modeCount);
+    }
 
-            if (result == ERROR_SUCCESS) {
-                configPaths.resize(pathCount);
-                configModes.resize(modeCount);
+    /**
+     * Set the Active Display Monitor in each of the specified Terraria Configuration Files
+     * without any user interaction, printing a JSON Summary of the results.
+     * 
+     * The Connected Display Monitors are only retrieved once for all of the Terraria Configuration Files,
+     * which are then read and written concurrently by a small pool of worker threads.
+     * 
+     * When the Standard Output Buffer has been redirected to a file or pipe, the JSON Summary is
+     * written to it as UTF-8. Otherwise, it is printed to the Console.
+     * 
+     * @param monitorSelector       A Wide-Character String identifying the new Active Display Monitor,
+     *                              as accepted by `findDisplayMonitor()`.
+     * 
+     * @param configPathPatterns    The paths to each of the Terraria Configuration Files,
+     *                              each of which may contain the Wildcard Patterns accepted by `expandPathPattern()`.
+     * 
+     * @returns                     The `ProgramStatusCode` to be returned by the program.
+     */
+    static int runBatchMode (
+        const std::wstring& monitorSelector,
+        const std::vector<std::wstring>& configPathPatterns
+    ) {
 
-                result = QueryDisplayConfig(configFlags, &pathCount, configPaths.data(), &modeCount, configModes.data(), nullptr);
+        std::optional<DisplayMonitorList> displayMonitors = getDisplayMonitors();   // The Connected Display Monitors.
+        std::optional<DisplayMonitor> selectedMonitor = {};                         // The new Active Display Monitor.
+        std::vector<std::wstring> configFilePaths = {};                             // The paths to each of the Terraria Configuration Files.
+        std::vector<BatchResult> results = {};                                      // The results for each of the `configFilePaths`.
+        std::vector<std::thread> workers = {};                                      // The worker threads processing the `configFilePaths`.
+        std::atomic<size_t> nextFileIndex = 0ULL;                                   // The index of the next file to be processed by a worker.
+        size_t failureCount = 0ULL;                                                 // The number of Terraria Configuration Files that could not be processed.
+        std::wstring summary = {};                                                  // The JSON Summary of the `results`.
+        HANDLE stdOutHandle = GetStdHandle(STD_OUTPUT_HANDLE);                      // The handle to the Standard Output Buffer.
+        DWORD consoleMode = 0;                                                      // Receives the Console Mode of the `stdOutHandle`.
+
+        if (!displayMonitors) {
+            console->err().print(L"Failed to retrieve the Connected Display Monitors from the Windows API.");
+            return ProgramStatusCode::DISPLAY_MONITOR_QUERY_FAILURE;
+        }
 
-                configPaths.resize(pathCount);
-                configModes.resize(modeCount);
-            }
+        if ( !(selectedMonitor = findDisplayMonitor(*displayMonitors, monitorSelector)) ) {
+            console->err().printf(L"No single Connected Display Monitor matches \"{:s}\".", monitorSelector);
+            return ProgramStatusCode::INVALID_ARGUMENTS;
         }
-        while (result == ERROR_INSUFFICIENT_BUFFER);
-
-        // Details about the Connected Display Monitors was successfully retrieved from the Windows API.
-        if (result == ERROR_SUCCESS) {
-            // A structure containing information about the Current Resolution
-            // of the Current Display Monitor being processed.
-            DEVMODEW displayMode = { .dmSize = sizeof DEVMODEW, .dmDriverExtra = 0UL };
-            // A structure containing information about the Current Display Monitor being processed.
-            DISPLAY_DEVICEW displayDevice = { .cb = sizeof DISPLAY_DEVICEW };
-
-            // Retrieve details about each Connected Display Monitor from the Windows API.
-            while ( EnumDisplayDevicesW( NULL, (DWORD) (currentMonitorNum - 1), &displayDevice, 0 ) == TRUE ) {
-                // Exclude Virtual and Disconnected Display Monitors. 
-                if (displayDevice.StateFlags & DISPLAY_DEVICE_ATTACHED_TO_DESKTOP) {
-                    EnumDisplaySettingsW(displayDevice.DeviceName, ENUM_CURRENT_SETTINGS, &displayMode);
-
-                    // Store the details about the Current Display Monitor in the `tempMonitorMap`
-                    // to be processed at the next stage.
-                    tempMonitorMap.emplace(
-                        displayDevice.DeviceName,
-                        DisplayMonitor(
-                            currentMonitorNum,
-                            displayDevice.DeviceName,
-                            L"",
-                            displayMode.dmPelsWidth,
-                            displayMode.dmPelsHeight,
-                            displayMode.dmDisplayFrequency,
-                            (displayDevice.StateFlags & DISPLAY_DEVICE_PRIMARY_DEVICE)
-                        )
-                    );
-                }
 
-                currentMonitorNum++;
-            }
+        configFilePaths = expandConfigPathPatterns(configPathPatterns);
 
-            // Ensure the `currentMonitorNum` is properly reset before being used again.
-            currentMonitorNum = 1U;
-
-            // Retrieve additional information about each of the Connected Display Monitors from the Windows API.
-            for (auto& path : configPaths) {
-                // A structure type containing the Friendly Display Name of the Display Monitor.
-                DISPLAYCONFIG_TARGET_DEVICE_NAME targetName = {
-                    .header = {
-                        .type = DISPLAYCONFIG_DEVICE_INFO_GET_TARGET_NAME,
-                        .size = sizeof(DISPLAYCONFIG_TARGET_DEVICE_NAME),
-                        .adapterId = path.targetInfo.adapterId,
-                        .id = path.targetInfo.id
-                    }
-                };
-                // A structure type containing the Display ID of the Display Monitor.
-                DISPLAYCONFIG_SOURCE_DEVICE_NAME sourceName = {
-                    .header = {
-                        .type = DISPLAYCONFIG_DEVICE_INFO_GET_SOURCE_NAME,
-                        .size = sizeof(DISPLAYCONFIG_SOURCE_DEVICE_NAME),
-                        .adapterId = path.sourceInfo.adapterId,
-                        .id = path.sourceInfo.id
-                    }
-                };
-                // DISPLAYCONFIG_ADAPTER_NAME adapterName = {
-                //     .header = {
-                //         .type = DISPLAYCONFIG_DEVICE_INFO_GET_ADAPTER_NAME,
-                //         .size = sizeof(DISPLAYCONFIG_ADAPTER_NAME),
-                //         .adapterId = path.sourceInfo.adapterId
-                //     }
-                // };
-
-                result = DisplayConfigGetDeviceInfo(&targetName.header);
-                result &= DisplayConfigGetDeviceInfo(&sourceName.header);
-                // result &= DisplayConfigGetDeviceInfo(&adapterName.header);
-
-                // Successfully retrieved information about the Current Display Monitor from the Windows API.
-                if (result == ERROR_SUCCESS) {
-                    // The node in the `tempMonitorMap` corresponding to the Current Display Monitor.
-                    auto node = tempMonitorMap.extract(sourceName.viewGdiDeviceName);
-                    // The Current Display Monitor being processed.
-                    DisplayMonitor& displayMonitor = node.mapped();
-                    // Indicates if the Display Monitor is an Internal Device or not.
-                    bool isInternalDevice = (
-                           targetName.outputTechnology == DISPLAYCONFIG_OUTPUT_TECHNOLOGY_INTERNAL
-                        || targetName.outputTechnology == DISPLAYCONFIG_OUTPUT_TECHNOLOGY_DISPLAYPORT_EMBEDDED
-                        || targetName.outputTechnology == DISPLAYCONFIG_OUTPUT_TECHNOLOGY_UDI_EMBEDDED
-                    );
+        if ( configFilePaths.empty() ) {
+            console->err().print(L"No Terraria Configuration Files were matched by the specified paths.");
+            return ProgramStatusCode::INVALID_ARGUMENTS;
+        }
 
-                    displayMonitor.monitorName = (
-                        targetName.monitorFriendlyDeviceName[0] != L'\0'
-                            ? targetName.monitorFriendlyDeviceName
-                            : ( isInternalDevice ? L"Internal Display" : L"Unnamed Display" )
-                    );
-                    finalMonitorList->push_back( std::move(displayMonitor) );
-                }
-                // Failed to retrieve information about the Current Display Monitor from the Windows API.
-                else {
-                    printWindowsApiError(L"Failed to Query Display Information from the Windows API");
-                    return std::optional<DisplayMonitorList>();
+        results.resize( configFilePaths.size() );
+
+        // Each worker repeatedly claims the next unprocessed Terraria Configuration File until none remain.
+        for (
+            size_t i = 0ULL, workerCount = std::min<size_t>( configFilePaths.size(), std::clamp(std::thread::hardware_concurrency(), 1U, 4U) );
+            i < workerCount;
+            i++
+        ) {
+            workers.emplace_back( [&configFilePaths, &results, &nextFileIndex, &selectedMonitor] () {
+
+                size_t fileIndex = 0ULL;    // The index of the Terraria Configuration File being processed.
+
+                while ( (fileIndex = nextFileIndex++) < configFilePaths.size() ) {
+                    BatchResult& result = results[fileIndex];           // The result for the current Terraria Configuration File.
+                    ConfigurationFile configFile = { configFilePaths[fileIndex] };
+
+                    result.filePath = configFilePaths[fileIndex];
+
+                    if ( !configFile.isOpen() )
+                        result.errorMessage = L"The Terraria Configuration File could not be opened.";
+                    else if ( !setActiveMonitorInConfigFile(configFile, *selectedMonitor, result.changedValues) )
+                        result.errorMessage = L"The Terraria Configuration File could not be modified.";
+                    else
+                        result.success = true;
+
+                    if ( result.success && !programSettings.dryRun )
+                        MonitorAssignmentStore::assignMonitor(result.filePath, *selectedMonitor);
                 }
 
-                currentMonitorNum++;
+            } );
+        }
+
+        for ( std::thread& worker : workers )
+            worker.join();
+
+        // Print anything posted to the `console` by the workers before the JSON Summary.
+        console->flushPostedOutput();
+
+        // Assemble the JSON Summary of the results.
+        summary += std::format(
+            L"{{\n  \"monitor\": {{ \"displayNum\": {:d}, \"displayId\": \"{:s}\", \"monitorName\": \"{:s}\", "
+            L"\"displayWidth\": {:d}, \"displayHeight\": {:d}, \"refreshRate\": {:d} }},\n"
+            L"  \"dryRun\": {:s},\n  \"results\": [",
+            selectedMonitor->displayNum,
+            UTILS_NAMESPACE::escapeJsonString(selectedMonitor->displayId),
+            UTILS_NAMESPACE::escapeJsonString(selectedMonitor->monitorName),
+            selectedMonitor->currentResolution.displayWidth,
+            selectedMonitor->currentResolution.displayHeight,
+            selectedMonitor->currentResolution.refreshRate,
+            ( programSettings.dryRun ? L"true" : L"false" )
+        );
+
+        for ( size_t i = 0ULL; i < results.size(); i++ ) {
+            const BatchResult& result = results[i];     // The result for the current Terraria Configuration File.
+            std::wstring changes = {};                  // The JSON Object containing the Modified Configuration Properties.
+
+            for ( const auto& [key, values] : result.changedValues ) {
+                changes += std::format(
+                    L"{:s}\"{:s}\": {{ \"old\": \"{:s}\", \"new\": \"{:s}\" }}",
+                    ( changes.empty() ? L"" : L", " ),
+                    UTILS_NAMESPACE::escapeJsonString(key),
+                    UTILS_NAMESPACE::escapeJsonString(values.first),
+                    UTILS_NAMESPACE::escapeJsonString(values.second)
+                );
             }
+
+            if (!result.success)
+                failureCount++;
+
+            summary += std::format(
+                L"{:s}\n    {{ \"path\": \"{:s}\", \"status\": \"{:s}\", \"changes\": {{ {:s} }}{:s} }}",
+                ( i > 0ULL ? L"," : L"" ),
+                UTILS_NAMESPACE::escapeJsonString(result.filePath),
+                ( !result.success ? L"failed" : (result.changedValues.empty() ? L"unchanged" : L"modified") ),
+                changes,
+                (
+                    !result.success
+                        ? std::format(L", \"error\": \"{:s}\"", UTILS_NAMESPACE::escapeJsonString(result.errorMessage))
+                        : std::wstring()
+                )
+            );
+        }
+
+        summary += std::format(
+            L"\n  ],\n  \"succeeded\": {:d},\n  \"failed\": {:d}\n}}",
+            results.size() - failureCount,
+            failureCount
+        );
+
+        if ( GetConsoleMode(stdOutHandle, &consoleMode) ) {
+            console->println(summary);
         }
-        // Failed to retrieve details about the Connected Display Monitors from the Windows API.
         else {
-            printWindowsApiError(L"Failed to Query Display Configuration from the Windows API");
-            return std::optional<DisplayMonitorList>();
+            std::string utf8Summary = UTILS_NAMESPACE::wideStringToUtf8(summary + L'\n');  // The UTF-8 Encoded JSON Summary.
+            DWORD bytesWritten = 0;                                                         // Receives the number of bytes written.
+
+            WriteFile(stdOutHandle, utf8Summary.data(), (DWORD) utf8Summary.size(), &bytesWritten, NULL);
         }
 
-        return finalMonitorList;
+        return ( failureCount == 0ULL ? ProgramStatusCode::SUCCESS : ProgramStatusCode::BATCH_MODE_FAILURE );
 
     }
 
     /**
-     * Get the Active Display Monitor from the Specified Terraria Configuration File.
-     * 
-     * @param configFilePath    A Wide-Character String containing the path to the Terraria Configuration File.
+     * List or restore the Backup Generations of each of the specified Terraria Configuration Files
+     * without any user interaction.
      * 
-     * @param displayMonitors   The `DisplayMonitorList` containing the Connected Display Monitors to 
-     *                          compare to the Active Display Monitor in the Terraria Configuration File.
+     * @param configPathPatterns    The paths to each of the Terraria Configuration Files,
+     *                              each of which may contain the Wildcard Patterns accepted by `expandPathPattern()`.
      * 
-     * @returns                 On success, returns the zero-based index of the Connected Display Monitor
-     *                          in the specified list of `displayMonitors` that is set as the Active Display Monitor
-     *                          in the Terraria Configuration File, wrapped in an `std::optional` object.
+     * @param restoredGeneration    The number of the Backup Generation to be restored in each of the
+     *                              Terraria Configuration Files. If empty, the Backup Generations are only listed.
      * 
-     *                          If the specified Terraria Configuration File could not be found or opened,
-     *                          or if the Active Display Monitor in the Specified Terraria Configuration File
-     *                          was not found in the specified list of `displayMonitors`, 
-     *                          an empty `std::optional` will be returned.
+     * @returns                     The `ProgramStatusCode` to be returned by the program.
      */
-    static std::optional<DisplayMonitor::display_number_t> getActiveMonitorFromConfigFile (
-        const std::wstring& configFilePath,
-        const DisplayMonitorList& displayMonitors
+    static int runBackupMode (
+        const std::vector<std::wstring>& configPathPatterns,
+        std::optional<size_t> restoredGeneration
     ) {
 
-        // The Regular Expression used to match the "Display" Configuration Property and Value.
-        const std::wregex DISPLAY_REGEX = std::wregex(L"\"Display\": \"([^\"]+)\",");
-        // The Regular Expression used to match Double-Escaped Backslashes in the Property Value.
-        const std::wregex BACKSLASH_REGEX = std::wregex(L"\\\\\\\\");
-
-        // The File Stream used to read from the Terraria Configuration File.
-        std::wifstream configFileStream(configFilePath);
-        // The index of the Active Display Monitor, if applicable.
-        std::optional<DisplayMonitor::display_number_t> selectedMonitorNum = {};
-        // Contains the current line of the Terraria Configuration File.
-        std::wstring currentConfigFileLine = L"";
-        // The Display ID of the Active Display Monitor.
-        std::wstring selectedDisplayId = L"";
-        // Contains the results of matching the `displayRegex` to the `currentConfigFileLine`.
-        std::wsmatch matches;
-
-        // Process each line of the Terraria Configuration File until
-        // the Active Display Monitor has been determined.
-        while ( configFileStream.good() && selectedDisplayId.empty() ) {
-            std::getline(configFileStream, currentConfigFileLine);
-
-            if ( std::regex_search(currentConfigFileLine, matches, DISPLAY_REGEX) ) {
-                // Remove double-escaped backslashes.
-                selectedDisplayId = std::regex_replace(matches[1].str(), BACKSLASH_REGEX, L"\\");
-            }
+        std::vector<std::wstring> configFilePaths = {};     // The paths to each of the Terraria Configuration Files.
+        size_t failureCount = 0ULL;                         // The number of Terraria Configuration Files that could not be restored.
+
+        configFilePaths = expandConfigPathPatterns(configPathPatterns);
+
+        if ( configFilePaths.empty() ) {
+            console->err().print(L"No Terraria Configuration Files were matched by the specified paths.");
+            return ProgramStatusCode::INVALID_ARGUMENTS;
         }
 
-        // Attempt to match the Active Display Monitor to one of the provided `displayMonitors`.
-        for (const auto& monitor : displayMonitors) {
-            if (monitor.displayId == selectedDisplayId) {
-                selectedMonitorNum = monitor.displayNum;
-                break;
+        for ( const std::wstring& filePath : configFilePaths ) {
+            if (restoredGeneration) {
+                if ( programSettings.dryRun ) {
+                    console->printfln(L"Generation {:d} of {:s} would be restored.", *restoredGeneration, filePath);
+                }
+                else if ( ConfigurationBackupStore::restoreGeneration(filePath, *restoredGeneration) ) {
+                    console->printfln(L"Restored Generation {:d} of {:s}.", *restoredGeneration, filePath);
+                }
+                else {
+                    console->err().printfln(L"Failed to restore Generation {:d} of {:s}.", *restoredGeneration, filePath);
+                    failureCount++;
+                }
+            }
+            else {
+                // The Backup Generations of the Terraria Configuration File.
+                ConfigurationBackupStore::BackupGenerationList generations = ConfigurationBackupStore::getGenerations(filePath);
+
+                console->printfln(L"{:s} ({:d} Backup Generations):", filePath, generations.size());
+
+                for ( const ConfigurationBackupStore::BackupGeneration& generation : generations ) {
+                    console->printfln(
+                        L"   {:4d}   {:%Y-%m-%d %H:%M:%S}",
+                        generation.generation,
+                        std::chrono::zoned_time(
+                            std::chrono::current_zone(),
+                            std::chrono::floor<std::chrono::seconds>( std::chrono::system_clock::from_time_t(generation.timestamp) )
+                        )
+                    );
+                }
             }
         }
 
-        return selectedMonitorNum;
+        return ( failureCount == 0ULL ? ProgramStatusCode::SUCCESS : ProgramStatusCode::BACKUP_RESTORE_FAILURE );
 
     }
 
     /**
-     * Set the Active Display Monitor in the Specified Terraria Configuration File.
+     * Save a Monitor Preset binding each of the specified Terraria Configuration Files
+     * to the Current Display Resolution of a Connected Display Monitor, without any user interaction.
      * 
-     * @param configFilePath        A Wide-Character String containing the path to the Terraria Configuration File.
+     * @param name                  The name of the Monitor Preset.
      * 
-     * @param newSelectedMonitor    The `DisplayMonitor` corresponding to the Connected Display Monitor to
-     *                              be set as the new Active Display Monitor.
+     * @param monitorSelector       A Wide-Character String identifying the Display Monitor of the Monitor Preset,
+     *                              as accepted by `findDisplayMonitor()`.
      * 
-     * @returns                     `true` on success and `false` on failure.
+     * @param configPathPatterns    The paths to each of the Terraria Configuration Files,
+     *                              each of which may contain the Wildcard Patterns accepted by `expandPathPattern()`.
+     * 
+     * @returns                     The `ProgramStatusCode` to be returned by the program.
      */
-    static bool setActiveMonitorInConfigFile (
-        const std::wstring& configFilePath,
-        const DisplayMonitor& newSelectedMonitor
+    static int runSavePresetMode (
+        const std::wstring& name,
+        const std::wstring& monitorSelector,
+        const std::vector<std::wstring>& configPathPatterns
     ) {
 
-        // Catch any exceptions that are raised and return `false` on error.
-        try {
-            std::optional<std::wstring> tempFilePath = UTILS_NAMESPACE::createTempFile();
-
-            if (tempFilePath) {
-                // The File Stream used to read from the Current Terraria Configuration File.
-                std::wifstream configFileStream(configFilePath);
-                // The File Stream used to write to the Temporary File.
-                std::wofstream tempConfigFileStream(*tempFilePath);
-                // Contains the current line read in from the Current Terraria Configuration File.
-                std::wstring currentLine = {};
-                // A Regular Expression Pattern used to match specified Configuration Properties starting with `Display`. 
-                std::wregex displayRegex = std::wregex(L"(^[^\"]*\"(Display(?:Width|Height|Screen)?)\"): \"?([^\"]+)\"?,");
-                // Contains the results of matching the `displayRegex` against the `currentLine`.
-                std::wsmatch matches;
-                // Contains the Display ID of the Active Display Monitor, in which all
-                // of the backslashes have already been double-escaped for writing.
-                std::wstring selectedDisplayId = std::regex_replace( newSelectedMonitor.displayId, std::wregex(L"\\\\"), L"\\\\" );
-                std::wstring outputData = {};
-
-                if ( configFileStream.good() && tempConfigFileStream.good() ) {
-                    if ( programSettings.dryRun && !dryRunOutput.empty() )
-                        dryRunOutput.clear();
-
-                    // Write each line of the Current Terraria Configuration File to the
-                    // Temporary File, modifying the line as necessary.
-                    while ( configFileStream.good() ) {
-                        outputData.clear();
-                        std::getline(configFileStream, currentLine);
-
-                        // Copy unmatched lines from the Current Config File
-                        // directly to the Temporary File without modification.
-                        if ( !std::regex_search(currentLine, matches, displayRegex) ) {
-                            outputData = currentLine;
-
-                            if ( configFileStream.good() )
-                                outputData.push_back(L'\n');
-                        }
-                        else {
-                            std::wstring oldValueStr = matches[3];  // The old value to be added to the `changedValues` map.
-                            std::wstring newValueStr = {};          // The new value to be added to the `changedValues` map.
-
-                            if ( matches[2] == L"DisplayWidth" || matches[2] == L"DisplayHeight" ) {
-                                // The previous width or height, converted to an integer type.
-                                DWORD matchValue = std::stoul(matches[3]);
-
-                                if ( matches[2] == L"DisplayWidth" && newSelectedMonitor.currentResolution.displayWidth != matchValue ) {
-                                    outputData = std::format(
-                                        L"{:s}: {:d},\n",
-                                        matches[1].str(),
-                                        newSelectedMonitor.currentResolution.displayWidth
-                                    );
-                                    newValueStr = std::to_wstring(newSelectedMonitor.currentResolution.displayWidth);
-                                }
-                                else if ( matches[2] == L"DisplayHeight" && newSelectedMonitor.currentResolution.displayHeight != matchValue ) {
-                                    outputData = std::format(
-                                        L"{:s}: {:d},\n",
-                                        matches[1].str(),
-                                        newSelectedMonitor.currentResolution.displayHeight
-                                    );
-                                    newValueStr = std::to_wstring(newSelectedMonitor.currentResolution.displayHeight);
-                                }
-                                else {
-                                    outputData = currentLine + L'\n';
-                                }
-                            }
-                            else if ( matches[2] == L"Display" || matches[2] == L"DisplayScreen" ) {
-                                outputData = std::format( L"{:s}: \"{:s}\",\n", matches[1].str(), selectedDisplayId );
-                                oldValueStr = (L'"' + oldValueStr + L'"');
-                                newValueStr = (L'"' + selectedDisplayId + L'"');
-                            }
-
-                            // We assume that changes have been made anytime `newValueStr` is populated.
-                            if ( !newValueStr.empty() ) {
-                                if ( !changedValues.contains(matches[2]) ) {
-                                    changedValues.emplace( matches[2], std::make_pair(oldValueStr, newValueStr) );
-                                }
-                                else if ( changedValues[matches[2]].first != newValueStr ) {
-                                    changedValues[matches[2]].second = newValueStr;
-                                }
-                                else {
-                                    changedValues.erase(matches[2]);
-                                }
-                            }
-                        }
+        std::optional<DisplayMonitorList> displayMonitors = getDisplayMonitors();   // The Connected Display Monitors.
+        std::optional<DisplayMonitor> selectedMonitor = {};                         // The Display Monitor of the Monitor Preset.
+        std::vector<std::wstring> configFilePaths = {};                             // The paths to each of the Terraria Configuration Files.
 
-                        if ( !programSettings.dryRun )
-                            tempConfigFileStream << outputData;
-                        else
-                            dryRunOutput += outputData;
-                    }
+        if (!displayMonitors) {
+            console->err().print(L"Failed to retrieve the Connected Display Monitors from the Windows API.");
+            return ProgramStatusCode::DISPLAY_MONITOR_QUERY_FAILURE;
+        }
 
-                    if ( !programSettings.dryRun ) {
-                        // Once we have finished writing the updated contents of the
-                        // Terraria Configuration File to the Temporary File, we can
-                        // replace the contents of the Config File with the Temporary File.
-                        configFileStream.close();
-                        tempConfigFileStream.close();
-                        std::filesystem::rename(*tempFilePath, configFilePath);
-                    }
+        if ( !(selectedMonitor = findDisplayMonitor(*displayMonitors, monitorSelector)) ) {
+            console->err().printf(L"No single Connected Display Monitor matches \"{:s}\".", monitorSelector);
+            return ProgramStatusCode::INVALID_ARGUMENTS;
+        }
 
-                    return true;
-                }
-            }
+        configFilePaths = expandConfigPathPatterns(configPathPatterns);
+
+        if ( configFilePaths.empty() ) {
+            console->err().print(L"No Terraria Configuration Files were matched by the specified paths.");
+            return ProgramStatusCode::INVALID_ARGUMENTS;
         }
-        catch (...) {}
 
-        return false;
+        if ( !MonitorPresetStore::savePreset(name, *selectedMonitor, std::nullopt, configFilePaths) ) {
+            console->err().printf(L"Failed to save the Monitor Preset \"{:s}\".", name);
+            return ProgramStatusCode::PRESET_FAILURE;
+        }
+
+        console->printf(
+            L"Saved the Monitor Preset \"{:s}\" for {:s} ({:s}) and {:d} Terraria Configuration Files.",
+            name,
+            selectedMonitor->monitorName,
+            selectedMonitor->currentResolution.resolutionString,
+            configFilePaths.size()
+        );
+
+        return ProgramStatusCode::SUCCESS;
+
+    }
+
+    /**
+     * Print each of the saved Monitor Presets, along with their Terraria Configuration Files.
+     * 
+     * @returns     The `ProgramStatusCode` to be returned by the program.
+     */
+    static int runListPresetsMode () {
+
+        MonitorPresetStore::MonitorPresetMap presets = MonitorPresetStore::fetchFromFile();  // The saved Monitor Presets.
+
+        if ( presets.empty() ) {
+            console->print(L"No Monitor Presets have been saved.");
+            return ProgramStatusCode::SUCCESS;
+        }
+
+        for ( const auto& [name, preset] : presets ) {
+            console->printfln(
+                L"{:s} ({:s}, {:d} Terraria Configuration Files):",
+                name,
+                preset.resolution.resolutionString,
+                preset.patchPlans.size()
+            );
+
+            for ( const MonitorPresetStore::PatchPlan& plan : preset.patchPlans )
+                console->printfln(L"   {:s}", plan.filePath);
+        }
+
+        return ProgramStatusCode::SUCCESS;
 
     }
 
@@ -450,6 +424,44 @@ namespace PROGRAM_NAMESPACE {
 
     }
 
+    /**
+     * Print the changes made to the `dryRunConfigFile` as a Unified Diff when performing a Dry Run (`--dry-run`).
+     * 
+     * All Alternate Output Buffers of the `Console` are cleared first, and each line of the Unified Diff
+     * is then printed to the Primary Output Buffer as soon as it has been found, comparing the unmodified
+     * Terraria Configuration File, which is never written to during a Dry Run, to the `dryRunConfigFile`.
+     * 
+     * The `dryRunConfigFile` is cleared afterwards, so the changes are only ever printed once.
+     */
+    static void printDryRunDiff () {
+
+        // The Terraria Configuration File whose changes are being printed.
+        const ConfigurationFile* configFile = std::exchange(dryRunConfigFile, nullptr);
+
+        if ( !configFile )
+            return;
+
+        // Clear all Alternate Output Buffers
+        while ( console->getCurrentBufferNum() > 0ULL )
+            console->restorePreviousBuffer();
+
+        // The unmodified Terraria Configuration File.
+        ConfigurationFile unmodifiedFile = { configFile->getFilePath() };
+
+        if ( !unmodifiedFile.isOpen() )
+            return;
+
+        writeConfigFileDiff(
+            unmodifiedFile.getContents(),
+            configFile->getContents(),
+            programSettings.dryRunContextLines,
+            configFile->getFilePath(),
+            configFile->getFilePath() + L" (Dry Run)",
+            [] ( const std::wstring& line ) { console->println(line); }
+        );
+
+    }
+
     /**
      * The Program Exit Handler run at the end of `wmain()` and when calling `std::exit()`.
      *  
@@ -470,9 +482,8 @@ namespace PROGRAM_NAMESPACE {
      * consider the Terraria Configuration File to be "unmodified", despite
      * the fact that it was overwritten two or more times.
      * 
-     * If the `--dry-mode` Flag was used and the Terraria Configuration File
-     * was "modified" one or more times, the output of the most recent operation
-     * will be printed to the console prior to the final output message.
+     * If the `--dry-run` Flag was used and the program exits while the Terraria Configuration File
+     * is still in use, its changes are printed using `printDryRunDiff()` prior to the final output message.
      */
     static void programExitHandler () {
 
@@ -480,8 +491,7 @@ namespace PROGRAM_NAMESPACE {
         while ( console->getCurrentBufferNum() > 0ULL )
             console->restorePreviousBuffer();
 
-        if ( programSettings.dryRun && !dryRunOutput.empty() )
-            console->println(dryRunOutput);
+        printDryRunDiff();
 
         if (configFilePath) {
             if ( !changedValues.empty() ) {
@@ -530,14 +540,40 @@ int wmain ( int argc, const wchar_t* argv[] ) {
         bool versionMode = false;
         // Indicates if the `--clear-program-data` flag was used.
         bool clearProgramDataAtStart = false;
+        // The Display Monitor specified by the `--monitor` flag, which enables Non-Interactive Mode.
+        std::optional<std::wstring> batchMonitorSelector = {};
+        // The paths and Wildcard Patterns specified by the `--config` and `--config-list` flags.
+        std::vector<std::wstring> batchConfigPaths = {};
+        // Indicates if the `--watch` flag was used.
+        bool watchMode = false;
+        // Indicates if the `--apply-last` flag was used.
+        bool applyLastMode = false;
+        // The name of the Monitor Preset specified by the `--preset` flag.
+        std::optional<std::wstring> appliedPresetName = {};
+        // The name of the Monitor Preset specified by the `--save-preset` flag.
+        std::optional<std::wstring> savedPresetName = {};
+        // The name of the Monitor Preset specified by the `--delete-preset` flag.
+        std::optional<std::wstring> deletedPresetName = {};
+        // Indicates if the `--list-presets` flag was used.
+        bool listPresetsMode = false;
+        // Indicates if the `--list-backups` flag was used.
+        bool listBackupsMode = false;
+        // The Backup Generation specified by the `--restore-backup` flag.
+        std::optional<size_t> restoredBackupGeneration = {};
+        // The path to the Trace File specified by the `--trace` flag.
+        std::optional<std::wstring> traceFilePath = {};
     } programFlags;                                 // A structure containing the status of each of the Program Flags.
     int statusCode = ProgramStatusCode::SUCCESS;    // The Result Status Code returned by the Program.
 
 
+    // The lowercase value of the current Command-Line Argument, whose buffer is reused for each argument.
+    std::wstring lcArg = {};
+
     // Process Command-Line Arguments
     for ( int i = 1; i < argc; i++ ) {
-        std::wstring arg(argv[i]);
-        std::wstring lcArg = UTILS_NAMESPACE::stringToLowercase(arg);
+        std::wstring_view arg = argv[i];
+
+        UTILS_NAMESPACE::stringToLowercase(arg, lcArg);
 
         if (i == 1) {
             // Display Help/Usage Information
@@ -556,6 +592,13 @@ int wmain ( int argc, const wchar_t* argv[] ) {
         if ( arg == L"-d" || lcArg == L"--dry-run" ) {
             programSettings.dryRun = true;
         }
+        // Set the number of unchanged lines printed around each change during a Dry Run
+        else if ( lcArg == L"--diff-context" && i + 1 < argc ) {
+            try {
+                programSettings.dryRunContextLines = std::stoull(argv[++i]);
+            }
+            catch (...) {}
+        }
         // Enable Stateless Mode
         else if ( arg == L"-s" || lcArg == L"--stateless" ) {
             programSettings.statelessMode = true;
@@ -576,8 +619,81 @@ int wmain ( int argc, const wchar_t* argv[] ) {
         else if ( lcArg == L"--debug" ) {
             programSettings.debugMode = true;
         }
+        // Record a Performance Trace to a File
+        else if ( lcArg == L"--trace" && i + 1 < argc ) {
+            programFlags.traceFilePath = argv[++i];
+        }
+        // Select the Display Monitor for Non-Interactive Mode
+        else if ( (arg == L"-m" || lcArg == L"--monitor") && i + 1 < argc ) {
+            programFlags.batchMonitorSelector = argv[++i];
+        }
+        // Add a Terraria Configuration File for Non-Interactive Mode
+        else if ( (arg == L"-c" || lcArg == L"--config") && i + 1 < argc ) {
+            programFlags.batchConfigPaths.push_back(argv[++i]);
+        }
+        // Add each of the Terraria Configuration Files listed in a file for Non-Interactive Mode
+        else if ( lcArg == L"--config-list" && i + 1 < argc ) {
+            std::wifstream listFileStream(argv[++i]);   // The File Stream used to read the list of Terraria Configuration Files.
+            std::wstring currentLine = {};              // Contains the Current Line of the list.
+
+            while ( std::getline(listFileStream, currentLine) ) {
+                std::wstring_view trimmedLine = UTILS_NAMESPACE::trimStringView(currentLine);  // The Current Line, without any surrounding whitespace.
+
+                if ( !trimmedLine.empty() )
+                    programFlags.batchConfigPaths.emplace_back(trimmedLine);
+            }
+        }
+        // Enable Watch Mode
+        else if ( arg == L"-w" || lcArg == L"--watch" ) {
+            programFlags.watchMode = true;
+        }
+        // Enable Apply-Last Mode
+        else if ( lcArg == L"--apply-last" ) {
+            programFlags.applyLastMode = true;
+        }
+        // Apply a Monitor Preset
+        else if ( lcArg == L"--preset" && i + 1 < argc ) {
+            programFlags.appliedPresetName = argv[++i];
+        }
+        // Save a Monitor Preset for the Display Monitor and Terraria Configuration Files of Non-Interactive Mode
+        else if ( lcArg == L"--save-preset" && i + 1 < argc ) {
+            programFlags.savedPresetName = argv[++i];
+        }
+        // Delete a Monitor Preset
+        else if ( lcArg == L"--delete-preset" && i + 1 < argc ) {
+            programFlags.deletedPresetName = argv[++i];
+        }
+        // List the saved Monitor Presets
+        else if ( lcArg == L"--list-presets" ) {
+            programFlags.listPresetsMode = true;
+        }
+        // List the Backup Generations of the Terraria Configuration Files
+        else if ( lcArg == L"--list-backups" ) {
+            programFlags.listBackupsMode = true;
+        }
+        // Restore a Backup Generation of the Terraria Configuration Files
+        else if ( lcArg == L"--restore-backup" && i + 1 < argc ) {
+            try {
+                programFlags.restoredBackupGeneration = std::stoull(argv[++i]);
+            }
+            catch (...) {
+                programFlags.restoredBackupGeneration = 0ULL;
+            }
+        }
     }
 
+    // The Trace File is written when the program exits, however it exits.
+    if (programFlags.traceFilePath)
+        TraceRecorder::start(*programFlags.traceFilePath);
+
+    // Apply-Last Mode is run before the `Console` is created, as it never uses the Console UI.
+    if (programFlags.applyLastMode)
+        return runApplyLastMode();
+
+    // Preset Mode is run before the `Console` is created for the same reason.
+    if (programFlags.appliedPresetName)
+        return runPresetMode(*programFlags.appliedPresetName);
+
 
     if ( !(console = Console::getConsole()) ) {
         std::wcerr << L"Failed to initialize the Console via the Windows API.";
@@ -632,73 +748,279 @@ int wmain ( int argc, const wchar_t* argv[] ) {
         clearProgramData(ui);
     }
 
+    // Listing and restoring Backup Generations also runs without any user interaction.
+    if ( programFlags.listBackupsMode || programFlags.restoredBackupGeneration ) {
+        if ( programFlags.batchConfigPaths.empty() ) {
+            console->err().print(L"At least one Terraria Configuration File must be specified using --config or --config-list.");
+            return ProgramStatusCode::INVALID_ARGUMENTS;
+        }
+        else if ( programFlags.restoredBackupGeneration && *programFlags.restoredBackupGeneration == 0ULL ) {
+            console->err().print(L"The Backup Generation specified by --restore-backup must be a positive integer.");
+            return ProgramStatusCode::INVALID_ARGUMENTS;
+        }
+
+        return runBackupMode(
+            programFlags.batchConfigPaths,
+            ( programFlags.listBackupsMode ? std::nullopt : programFlags.restoredBackupGeneration )
+        );
+    }
+
+    // Managing the Monitor Presets also runs without any user interaction.
+    if (programFlags.savedPresetName) {
+        if ( !programFlags.batchMonitorSelector || programFlags.batchConfigPaths.empty() ) {
+            console->err().print(L"A Display Monitor must be specified using --monitor, and at least one Terraria Configuration File using --config or --config-list.");
+            return ProgramStatusCode::INVALID_ARGUMENTS;
+        }
+
+        return runSavePresetMode(*programFlags.savedPresetName, *programFlags.batchMonitorSelector, programFlags.batchConfigPaths);
+    }
+    else if (programFlags.deletedPresetName) {
+        if ( !MonitorPresetStore::deletePreset(*programFlags.deletedPresetName) ) {
+            console->err().printf(L"No Monitor Preset named \"{:s}\" has been saved.", *programFlags.deletedPresetName);
+            return ProgramStatusCode::PRESET_FAILURE;
+        }
+
+        console->printf(L"Deleted the Monitor Preset \"{:s}\".", *programFlags.deletedPresetName);
+        return ProgramStatusCode::SUCCESS;
+    }
+    else if (programFlags.listPresetsMode) {
+        return runListPresetsMode();
+    }
+
+    // Watch Mode runs in the background until it is terminated, and never uses the Main Menu either.
+    if (programFlags.watchMode)
+        return runWatchMode(programFlags.batchConfigPaths);
+
+    // Non-Interactive Mode does not use the Main Menu or the Program Exit Handler,
+    // and reports its results through its own JSON Summary instead.
+    if (programFlags.batchMonitorSelector) {
+        if ( programFlags.batchConfigPaths.empty() ) {
+            console->err().print(L"At least one Terraria Configuration File must be specified using --config or --config-list.");
+            return ProgramStatusCode::INVALID_ARGUMENTS;
+        }
+
+        return runBatchMode(*programFlags.batchMonitorSelector, programFlags.batchConfigPaths);
+    }
+
 
     // Once the `Console` has been initialized and we're sure that the program isn't
     // in `helpMode` or `versionMode`, we can register the Program Exit Handler.
     std::atexit(programExitHandler);
 
 
-    // The Connected Display Monitors.
-    std::optional<DisplayMonitorList> displayMonitors = getDisplayMonitors();
-    // The current width of the "Monitor Name" column of a Connected Display Monitor Menu Option.
-    auto monitorNameColSize = ui.getTextSizing().monitorNameColSize;
+    // Listens for changes to the Display Topology while the program is running.
+    DisplayChangeListener displayChangeListener = {};
+    // The error message returned by the Windows API if the Connected Display Monitors could not be retrieved.
+    std::optional<std::wstring> displayMonitorsError = {};
+    /**
+     * Retrieves the Connected Display Monitors on another thread while the user selects
+     * the Terraria Configuration File, as they are not needed until the Main Menu is drawn.
+     */
+    std::future< std::optional<DisplayMonitorList> > displayMonitorsTask = std::async(
+        std::launch::async,
+        [&displayMonitorsError] () { return getDisplayMonitors(true, &displayMonitorsError); }
+    );
+    // The Connected Display Monitors, once the `displayMonitorsTask` has completed.
+    std::optional<DisplayMonitorList> displayMonitors = {};
 
-    if (!displayMonitors) {
-        console->err().print(L"Failed to retrieve the Connected Display Monitors from the Windows API.");
-        return ProgramStatusCode::DISPLAY_MONITOR_QUERY_FAILURE;
-    }
+    /**
+     * A lambda function used to determine the width of the "Monitor Name" column
+     * based on the length of the longest monitor in the specified list of `monitors`.
+     * 
+     * Depends on the `ui`, whose `TextSizing` may be modified by this function.
+     * 
+     * @param monitors  The `DisplayMonitorList` containing the Connected Display Monitors.
+     */
+    auto fitMonitorNameColumn = [&ui] ( const DisplayMonitorList& monitors ) {
 
-    // Determine the width of the "Monitor Name" column based on the length
-    // of the longest monitor in the list of `displayMonitors`.
-    for (const auto& monitor : *displayMonitors) {
-        unsigned short monitorNameLength = (unsigned short) monitor.monitorName.length();
+        // The current width of the "Monitor Name" column of a Connected Display Monitor Menu Option.
+        auto monitorNameColSize = ui.getTextSizing().monitorNameColSize;
 
-        if (monitorNameLength > monitorNameColSize)
-            monitorNameColSize = monitorNameLength;
-    }
+        for (const auto& monitor : monitors) {
+            unsigned short monitorNameLength = (unsigned short) monitor.monitorName.length();
 
-    if ( monitorNameColSize != ui.getTextSizing().monitorNameColSize )
-        ui.changeTextSizing( ui.getTextSizing().withNewMonitorNameColSize(monitorNameColSize) );
+            if (monitorNameLength > monitorNameColSize)
+                monitorNameColSize = monitorNameLength;
+        }
+
+        if ( monitorNameColSize != ui.getTextSizing().monitorNameColSize )
+            ui.changeTextSizing( ui.getTextSizing().withNewMonitorNameColSize(monitorNameColSize) );
+
+    };
 
 
     // Get the path to the Terraria Configuration File to use from the user.
     console->createAltBuffer();
     configFilePath = ui.promptForConfigFilePath();
 
+    // Only wait for the Connected Display Monitors once they are actually needed.
+    if (configFilePath) {
+        displayMonitors = displayMonitorsTask.get();
+
+        if (!displayMonitors) {
+            console->restorePreviousBuffer();
+
+            if (displayMonitorsError)
+                console->err().println(*displayMonitorsError);
+
+            console->err().print(L"Failed to retrieve the Connected Display Monitors from the Windows API.");
+            return ProgramStatusCode::DISPLAY_MONITOR_QUERY_FAILURE;
+        }
+
+        fitMonitorNameColumn(*displayMonitors);
+    }
+
     if (configFilePath) {
-        // The Active Display Monitor, if a valid one is currently set.
-        std::optional<DisplayMonitor::display_number_t> selectedMonitorNum = getActiveMonitorFromConfigFile(
-            *configFilePath, *displayMonitors
+        // The Terraria Configuration File, which is shared between each of the Main Menu selections and only read again once it changes.
+        ConfigurationFile configFile = { *configFilePath };
+        // The Connected Display Monitors, each of which is identified by its Handle within the Main Menu.
+        DisplayMonitorRegistry monitorRegistry = { std::move(*displayMonitors) };
+        // The Handle of the Active Display Monitor, if a valid one is currently set.
+        std::optional<DisplayMonitorRegistry::monitor_handle_t> selectedMonitorHandle = getActiveMonitorFromConfigFile(
+            configFile, monitorRegistry
         );
         // The last selection from the Main Menu of the Program.
         std::optional<UserInterface::MainMenuSelection> selection = {};
-        // Indicates whether the `selection` contains a `DisplayMonitor` or not.
+        // Indicates whether the `selection` contains the Handle of a Display Monitor or not.
         bool isMonitorSelection = false;
+        // Indicates whether the `selection` contains a request to choose the Display Resolution of a Display Monitor.
+        bool isResolutionSelection = false;
+        // Indicates whether the `selection` contains a request to choose a Monitor Preset to be applied.
+        bool isPresetSelection = false;
+        // Indicates whether the Main Menu needs to be rendered from scratch.
+        bool renderMenu = true;
+
+        // The changes made during a Dry Run are printed once the program is done with the `configFile`.
+        if ( programSettings.dryRun )
+            dryRunConfigFile = &configFile;
 
         // Repeatedly draw the Main Menu until an Alternative Menu Option is selected
-        // (i.e., `selection` does not contain a `DisplayMonitor`).
+        // (i.e., `selection` does not refer to a Display Monitor).
         do {
+            // The Terraria Configuration File is never kept mapped while waiting on the user, so that other programs,
+            // such as Terraria itself, can still save it. Any changes are picked up by `setActiveMonitorInConfigFile()`.
+            configFile.close();
+
             selection = ui.mainMenu(
                 *configFilePath,
-                *displayMonitors,
-                !selection.has_value(),
-                selectedMonitorNum ? *selectedMonitorNum : 1U
+                monitorRegistry,
+                renderMenu,
+                selectedMonitorHandle ? *selectedMonitorHandle : 0U
+            );
+            renderMenu = false;
+
+            isMonitorSelection = selection && std::holds_alternative<DisplayMonitorRegistry::monitor_handle_t>(*selection);
+            isResolutionSelection = selection && std::holds_alternative<UserInterface::ResolutionMenuSelection>(*selection);
+            isPresetSelection = (
+                   selection
+                && std::holds_alternative<UserInterface::MainMenuOption>(*selection)
+                && std::get<UserInterface::MainMenuOption>(*selection) == UserInterface::MONITOR_PRESETS_MENU_OPTION
             );
-
-            isMonitorSelection = selection && std::holds_alternative<DisplayMonitor>(*selection);
 
             if ( !selection )
                 statusCode = ProgramStatusCode::TERMINATED;
 
-            if (isMonitorSelection) {
-                // The `DisplayMonitor` selected by the user.
-                const DisplayMonitor& selectedMonitor = std::get<DisplayMonitor>(*selection);
+            if (isPresetSelection) {
+                // The saved Monitor Presets.
+                MonitorPresetStore::MonitorPresetMap presets = MonitorPresetStore::fetchFromFile();
+                // The name of the Monitor Preset chosen by the user.
+                std::optional<std::wstring> presetName = ui.promptForMonitorPreset(presets);
+
+                if (!presetName)
+                    continue;
+
+                // The Monitor Preset chosen by the user.
+                const MonitorPresetStore::MonitorPreset& preset = presets.at(*presetName);
+
+                // The Terraria Configuration File being edited must not be mapped while the Monitor Preset replaces it.
+                configFile.close();
+
+                // The result of applying the Monitor Preset to each of its Terraria Configuration Files.
+                std::optional<MonitorPresetStore::PresetApplyResultList> results = MonitorPresetStore::applyPreset(*presetName);
+                // Receives any errors raised while resolving the absolute path to the Terraria Configuration File being edited.
+                std::error_code errorCode = {};
+                // The absolute path to the Terraria Configuration File being edited, as used by the Patch Plans of the Monitor Preset,
+                // which is compared to the path of each result without regard to case, just like paths on Windows.
+                std::wstring absoluteConfigFilePath = std::filesystem::absolute(*configFilePath, errorCode).wstring();
 
-                // Only update the Terraria Configuration File when the selected
-                // Display Monitor is not already the Active Display Monitor.
-                if ( !selectedMonitorNum || selectedMonitor.displayNum != *selectedMonitorNum ) {
-                    if ( setActiveMonitorInConfigFile(*configFilePath, selectedMonitor) ) {
-                        selectedMonitorNum = selectedMonitor.displayNum;
+                for ( const MonitorPresetStore::PresetApplyResult& result : results.value_or(MonitorPresetStore::PresetApplyResultList()) ) {
+                    if (!result.success) {
+                        console->err().printfln(L"Failed to apply the Monitor Preset to {:s}", result.filePath);
+                    }
+                    else if ( CompareStringOrdinal(result.filePath.c_str(), -1, absoluteConfigFilePath.c_str(), -1, TRUE) == CSTR_EQUAL ) {
+                        // The Terraria Configuration File is never written to during a Dry Run,
+                        // so the changes are made to the `configFile` instead in order to be printed.
+                        if (programSettings.dryRun) {
+                            // The Handle of the Display Monitor of the Monitor Preset, if it is currently connected.
+                            std::optional<DisplayMonitorRegistry::monitor_handle_t> presetHandle = monitorRegistry.findByStableId(preset.stableId);
+
+                            if (presetHandle)
+                                setActiveMonitorInConfigFile(configFile, monitorRegistry[*presetHandle], changedValues, preset.resolution);
+                        }
+                        else {
+                            mergeChangedValues(changedValues, result.changedValues);
+                            configFile.reload();
+                        }
+
+                        selectedMonitorHandle = getActiveMonitorFromConfigFile(configFile, monitorRegistry);
+                    }
+                }
+
+                continue;
+            }
+
+            if (isMonitorSelection || isResolutionSelection) {
+                // The Handle of the Display Monitor selected by the user.
+                DisplayMonitorRegistry::monitor_handle_t selectedHandle = (
+                    isMonitorSelection
+                        ? std::get<DisplayMonitorRegistry::monitor_handle_t>(*selection)
+                        : std::get<UserInterface::ResolutionMenuSelection>(*selection).monitorHandle
+                );
+                // The Display Resolution chosen by the user, if one was chosen.
+                std::optional<DisplayMonitor::DisplayResolution> selectedResolution = {};
+
+                // If the Display Topology changed while the Main Menu was open, the selection refers to an
+                // outdated `monitorRegistry`, so the Main Menu is rendered again using the updated Connected Display Monitors,
+                // and the selected Display Monitor is found again by its Stable Identity, as its Display ID may have been reassigned.
+                if ( displayChangeListener.consumeDisplayChange() ) {
+                    // The Connected Display Monitors of the updated Display Topology.
+                    std::optional<DisplayMonitorList> updatedMonitors = getDisplayMonitors(false);
+
+                    if (updatedMonitors) {
+                        // The Stable Identity of the Display Monitor selected by the user.
+                        std::wstring selectedStableId = monitorRegistry.getStableId(selectedHandle);
+                        // The Handle of the selected Display Monitor in the updated Display Topology, if it is still connected.
+                        std::optional<DisplayMonitorRegistry::monitor_handle_t> updatedHandle = {};
+
+                        monitorRegistry = DisplayMonitorRegistry( std::move(*updatedMonitors) );
+                        selectedMonitorHandle = getActiveMonitorFromConfigFile(configFile, monitorRegistry);
+                        renderMenu = true;
+
+                        fitMonitorNameColumn( monitorRegistry.getMonitors() );
+                        console->clear();
+
+                        if ( !(updatedHandle = monitorRegistry.findByStableId(selectedStableId)) )
+                            continue;
+
+                        selectedHandle = *updatedHandle;
+                    }
+                }
+
+                // The Display Monitor selected by the user.
+                const DisplayMonitor& selectedMonitor = monitorRegistry[selectedHandle];
+
+                // Return to the Main Menu if the user did not choose a Display Resolution.
+                if ( isResolutionSelection && !(selectedResolution = ui.promptForDisplayResolution(selectedMonitor)) )
+                    continue;
+
+                // Only update the Terraria Configuration File when the selected Display Monitor
+                // is not already the Active Display Monitor, or a Display Resolution was chosen for it.
+                if ( isResolutionSelection || !selectedMonitorHandle || selectedHandle != *selectedMonitorHandle ) {
+                    if ( setActiveMonitorInConfigFile(configFile, selectedMonitor, changedValues, selectedResolution) ) {
+                        selectedMonitorHandle = selectedHandle;
+
+                        if ( !programSettings.dryRun )
+                            MonitorAssignmentStore::assignMonitor(*configFilePath, selectedMonitor);
                     }
                     else {
                         console->err().println(L"Failed to Set the Display Monitor in the Terraria Configuration File.");
@@ -706,11 +1028,14 @@ int wmain ( int argc, const wchar_t* argv[] ) {
                 }
             }
         }
-        while (isMonitorSelection);
+        while (isMonitorSelection || isResolutionSelection || isPresetSelection);
 
         // Remove the Main Menu at the end of the program.
         console->restorePreviousBuffer();
         console->toggleCursorVisibility(true);
+
+        // The changes must be printed while the `configFile` still exists.
+        printDryRunDiff();
     }
     else {
         statusCode = ProgramStatusCode::TERMINATED;
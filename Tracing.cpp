@@ -0,0 +1,335 @@
+/*
+* Tracing.cpp
+*
+* Source File defining the `TraceRecorder` and `ScopedTraceTimer` classes, which are used
+* to record the timing of the hot paths of the program, along with several Performance Counters,
+* to a Trace File in the Chrome Trace Event Format when the `--trace` flag is used.
+*/
+
+
+#include "Tracing.h"
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <new>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Type Definitions */
+
+    /**
+     * A structure type representing a single recorded Trace Event.
+     */
+    typedef struct TraceEventStruct {
+
+        const char* name;                   // The name of the Trace Event, or `nullptr` for a Counter Event.
+        const char* category;               // The category of the Trace Event.
+        DWORD threadId;                     // The ID of the thread that recorded the Trace Event.
+        int64_t startTime;                  // The time at which the Trace Event began, in nanoseconds since tracing was started.
+        int64_t duration;                   // The duration of the Trace Event, in nanoseconds.
+        std::wstring detail;                // A Wide-Character String describing the Trace Event, if any.
+        std::array<uint64_t, TraceRecorder::COUNTER_COUNT> counters;    // The values of the Performance Counters for a Counter Event.
+
+    } TraceEvent;
+
+
+    /* Internal Variables */
+
+    // Indicates if Trace Events and Performance Counters are currently being recorded.
+    static std::atomic<bool> tracingEnabled = false;
+    // The current value of each of the Performance Counters.
+    static std::array<std::atomic<uint64_t>, TraceRecorder::COUNTER_COUNT> traceCounters = {};
+    // Serializes access to the `traceEvents` and the `traceFilePath`.
+    static std::mutex traceMutex = {};
+    // The Trace Events that have been recorded so far.
+    static std::vector<TraceEvent> traceEvents = {};
+    // The path to the Trace File being written.
+    static std::filesystem::path traceFilePath = {};
+    // The time at which tracing was started, which all Trace Events are relative to.
+    static TraceRecorder::trace_time_t traceStartTime = {};
+
+    // The number of `ScopedTraceTimer`s currently alive on the Current Thread.
+    static thread_local unsigned int scopedTimerDepth = 0U;
+    // Indicates if the Current Thread is currently recording a Trace Event, so its own allocations aren't counted.
+    static thread_local bool isRecordingEvent = false;
+
+
+    /* Internal Helper Functions */
+
+    /**
+     * Append a string to the Trace File as a JSON String Literal.
+     *
+     * @param oJson     The contents of the Trace File being appended to.
+     * @param str       The UTF-8 Encoded String being appended.
+     */
+    static void appendJsonString ( _Out_ std::string& oJson, std::string_view str ) {
+
+        oJson.push_back('"');
+
+        for ( char ch : str ) {
+            if ( ch == '"' || ch == '\\' ) {
+                oJson.push_back('\\');
+                oJson.push_back(ch);
+            }
+            else if ( (unsigned char) ch < 0x20U ) {
+                oJson.append( std::format("\\u{:04x}", (unsigned int) (unsigned char) ch) );
+            }
+            else {
+                oJson.push_back(ch);
+            }
+        }
+
+        oJson.push_back('"');
+
+    }
+
+
+    /* TraceRecorder */
+    // Static Methods
+
+    bool TraceRecorder::start ( const std::filesystem::path& iTraceFilePath ) {
+
+        {
+            std::lock_guard<std::mutex> lock(traceMutex);
+
+            if ( tracingEnabled.load() )
+                return false;
+
+            traceFilePath = iTraceFilePath;
+            traceStartTime = std::chrono::steady_clock::now();
+            tracingEnabled.store(true);
+        }
+
+        // The Trace File is written once all of the program's other work is complete.
+        std::atexit( [] () { TraceRecorder::finish(); } );
+        return true;
+
+    }
+    bool TraceRecorder::isEnabled () {
+
+        return tracingEnabled.load(std::memory_order_relaxed);
+
+    }
+
+    void TraceRecorder::recordEvent (
+        const char* name,
+        const char* category,
+        trace_time_t startTime,
+        trace_time_t endTime,
+        std::wstring_view detail
+    ) {
+
+        if ( !isEnabled() )
+            return;
+
+        isRecordingEvent = true;
+
+        {
+            std::lock_guard<std::mutex> lock(traceMutex);
+
+            traceEvents.push_back({
+                .name = name,
+                .category = category,
+                .threadId = GetCurrentThreadId(),
+                .startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(startTime - traceStartTime).count(),
+                .duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count(),
+                .detail = std::wstring(detail),
+                .counters = {}
+            });
+        }
+
+        isRecordingEvent = false;
+
+    }
+    void TraceRecorder::recordCounters () {
+
+        if ( !isEnabled() )
+            return;
+
+        // The Counter Event being recorded.
+        TraceEvent counterEvent = {
+            .name = nullptr,
+            .category = "counters",
+            .threadId = GetCurrentThreadId(),
+            .startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceStartTime).count(),
+            .duration = 0LL,
+            .detail = {},
+            .counters = {}
+        };
+
+        for ( size_t i = 0ULL; i < COUNTER_COUNT; i++ )
+            counterEvent.counters[i] = traceCounters[i].load(std::memory_order_relaxed);
+
+        isRecordingEvent = true;
+
+        {
+            std::lock_guard<std::mutex> lock(traceMutex);
+            traceEvents.push_back( std::move(counterEvent) );
+        }
+
+        isRecordingEvent = false;
+
+    }
+    void TraceRecorder::incrementCounter ( Counter counter, uint64_t amount ) {
+
+        if ( isEnabled() && !isRecordingEvent )
+            traceCounters[counter].fetch_add(amount, std::memory_order_relaxed);
+
+    }
+
+    bool TraceRecorder::finish () {
+
+        // The names of each of the Performance Counters within the Trace File.
+        static const std::array<const char*, COUNTER_COUNT> COUNTER_NAMES = {
+            "WriteConsoleW Calls",
+            "Console Bytes Written",
+            "Allocations"
+        };
+        // The ID of the Current Process, which all Trace Events belong to.
+        DWORD processId = GetCurrentProcessId();
+        // The contents of the Trace File.
+        std::string json = {};
+
+        if ( !isEnabled() )
+            return true;
+
+        // Record the final value of each of the Performance Counters before tracing is stopped.
+        recordCounters();
+
+        std::lock_guard<std::mutex> lock(traceMutex);
+
+        tracingEnabled.store(false);
+        json.reserve( 64ULL + (traceEvents.size() * 160ULL) );
+        json.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+        for ( size_t i = 0ULL; i < traceEvents.size(); i++ ) {
+            const TraceEvent& traceEvent = traceEvents[i];  // The current Trace Event being written.
+
+            if (i > 0ULL)
+                json.push_back(',');
+
+            // Timestamps and Durations are written in microseconds, as required by the Chrome Trace Event Format.
+            json.append("{\"name\":");
+            appendJsonString(json, ( traceEvent.name != nullptr ? traceEvent.name : "Performance Counters" ));
+            json.append(",\"cat\":");
+            appendJsonString(json, traceEvent.category);
+            json.append( std::format(
+                ",\"ph\":\"{:s}\",\"pid\":{:d},\"tid\":{:d},\"ts\":{:.3f}",
+                ( traceEvent.name != nullptr ? "X" : "C" ),
+                processId,
+                traceEvent.threadId,
+                (double) traceEvent.startTime / 1000.0
+            ) );
+
+            if (traceEvent.name != nullptr) {
+                json.append( std::format(",\"dur\":{:.3f}", (double) traceEvent.duration / 1000.0) );
+
+                if ( !traceEvent.detail.empty() ) {
+                    json.append(",\"args\":{\"detail\":");
+                    appendJsonString( json, UTILS_NAMESPACE::wideStringToUtf8(traceEvent.detail) );
+                    json.push_back('}');
+                }
+            }
+            else {
+                json.append(",\"args\":{");
+
+                for ( size_t j = 0ULL; j < COUNTER_COUNT; j++ ) {
+                    if (j > 0ULL)
+                        json.push_back(',');
+
+                    appendJsonString(json, COUNTER_NAMES[j]);
+                    json.append( std::format(":{:d}", traceEvent.counters[j]) );
+                }
+
+                json.push_back('}');
+            }
+
+            json.push_back('}');
+        }
+
+        json.append("]}");
+        traceEvents.clear();
+
+        if ( !UTILS_NAMESPACE::writeFileAtomically(traceFilePath, json) ) {
+            std::wcerr << L"Failed to write the Trace File: " << traceFilePath.wstring() << std::endl;
+            return false;
+        }
+
+        return true;
+
+    }
+
+
+    /* ScopedTraceTimer */
+    // Class Constructors & Destructors
+
+    ScopedTraceTimer::ScopedTraceTimer ( const char* iName, const char* iCategory, std::wstring_view iDetail ) :
+        name(iName),
+        category(iCategory),
+        detail(),
+        startTime(),
+        enabled( TraceRecorder::isEnabled() )
+    {
+
+        if (this->enabled) {
+            this->detail = iDetail;
+            scopedTimerDepth++;
+            this->startTime = std::chrono::steady_clock::now();
+        }
+
+    }
+
+    ScopedTraceTimer::~ScopedTraceTimer () {
+
+        if (this->enabled) {
+            TraceRecorder::recordEvent( this->name, this->category, this->startTime, std::chrono::steady_clock::now(), this->detail );
+
+            if ( --scopedTimerDepth == 0U )
+                TraceRecorder::recordCounters();
+        }
+
+    }
+
+}
+
+
+/* Global Allocation Functions */
+
+/*
+ * The replaceable global allocation functions are replaced so that Dynamic Memory Allocations can be
+ * counted by the `TraceRecorder`. The array and `std::nothrow_t` forms are implemented by the
+ * Standard Library in terms of these functions, so they are counted as well. Outside of tracing,
+ * the only difference from the default allocation functions is a single atomic load.
+ */
+
+void* operator new ( std::size_t size ) {
+
+    PROGRAM_NAMESPACE::TraceRecorder::incrementCounter(PROGRAM_NAMESPACE::TraceRecorder::ALLOCATIONS);
+
+    while (true) {
+        if ( void* ptr = std::malloc(size > 0ULL ? size : 1ULL) )
+            return ptr;
+
+        // Give the New Handler a chance to free up some memory before failing.
+        if ( std::new_handler newHandler = std::get_new_handler() )
+            newHandler();
+        else
+            throw std::bad_alloc();
+    }
+
+}
+
+void operator delete ( void* ptr ) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete ( void* ptr, std::size_t ) noexcept {
+
+    std::free(ptr);
+
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+
+/*
+* Tracing.h
+*
+* Header File defining the `TraceRecorder` and `ScopedTraceTimer` classes, which are used
+* to record the timing of the hot paths of the program, along with several Performance Counters,
+* to a Trace File in the Chrome Trace Event Format when the `--trace` flag is used.
+*/
+
+
+#include "framework.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/**
+	 * A class providing a process-wide recorder of Trace Events and Performance Counters.
+	 *
+	 * Tracing is disabled until `start()` is called, in which case recording a Trace Event
+	 * or incrementing a Performance Counter only costs a single atomic load. Once started,
+	 * the recorded Trace Events are kept in memory and written to the Trace File all at once
+	 * when the program exits, so that writing the Trace File does not affect the timings being recorded.
+	 *
+	 * The Trace File uses the Chrome Trace Event Format, and can be opened using `chrome://tracing`,
+	 * Perfetto (`ui.perfetto.dev`), or any other viewer supporting the format.
+	 */
+	class TraceRecorder {
+
+		/* Type Definitions */
+		public:
+			// A Monotonic Clock Time Point used to time Trace Events.
+			typedef std::chrono::steady_clock::time_point trace_time_t;
+
+			// An enumeration defining the Performance Counters recorded alongside the Trace Events.
+			enum Counter : size_t {
+
+				CONSOLE_WRITE_CALLS = 0ULL,		// The number of calls made to `WriteConsoleW()` and `WriteConsoleOutputW()`.
+				CONSOLE_BYTES_WRITTEN,			// The number of bytes written to the console using `WriteConsoleW()` and `WriteConsoleOutputW()`.
+				ALLOCATIONS,					// The number of Dynamic Memory Allocations made through the global `operator new`.
+
+				COUNTER_COUNT					// The number of Performance Counters.
+
+			};
+
+
+		/* Static Methods */
+		public:
+			/**
+			 * Start recording Trace Events and Performance Counters.
+			 *
+			 * The Trace File is written when the program exits, including when it exits using `std::exit()`.
+			 *
+			 * @param traceFilePath		The path to the Trace File being written.
+			 *
+			 * @returns					`true` if tracing was started, or `false` if it had already been started.
+			 */
+			static bool start ( const std::filesystem::path& traceFilePath );
+			/**
+			 * Determine if Trace Events and Performance Counters are currently being recorded.
+			 *
+			 * @returns		`true` if tracing has been started, otherwise `false`.
+			 */
+			static bool isEnabled ();
+
+			/**
+			 * Record a Trace Event spanning the specified period of time.
+			 *
+			 * Outside of tracing, prefer using a `ScopedTraceTimer` instead, which only reads
+			 * the clock at all when tracing is enabled.
+			 *
+			 * @param name			The name of the Trace Event, which must have a Static Storage Duration.
+			 * @param category		The category of the Trace Event, which must have a Static Storage Duration.
+			 * @param startTime		The time at which the Trace Event began.
+			 * @param endTime		The time at which the Trace Event ended.
+			 * @param detail		An optional Wide-Character String describing the Trace Event, such as a file path.
+			 */
+			static void recordEvent (
+				const char* name,
+				const char* category,
+				trace_time_t startTime,
+				trace_time_t endTime,
+				std::wstring_view detail = {}
+			);
+			/**
+			 * Record the current value of each of the Performance Counters as a Counter Event.
+			 */
+			static void recordCounters ();
+			/**
+			 * Increment one of the Performance Counters.
+			 *
+			 * @param counter	The Performance Counter being incremented.
+			 * @param amount	The amount to increment the Performance Counter by.
+			 */
+			static void incrementCounter ( Counter counter, uint64_t amount = 1ULL );
+
+			/**
+			 * Stop recording and write the recorded Trace Events to the Trace File.
+			 *
+			 * Called automatically when the program exits once tracing has been started.
+			 *
+			 * @returns		`true` if the Trace File was written successfully or tracing was never started,
+			 * 				otherwise `false`.
+			 */
+			static bool finish ();
+
+	};
+
+	/**
+	 * A class used to record a Trace Event spanning its own lifetime.
+	 *
+	 * If tracing is not enabled when the `ScopedTraceTimer` is constructed, nothing is recorded.
+	 * Once the outermost `ScopedTraceTimer` on a thread is destroyed, the current value of each of the
+	 * Performance Counters is also recorded, so that the Performance Counters can be attributed to it.
+	 */
+	class ScopedTraceTimer {
+
+		/* Instance Properties */
+		private:
+			const char* name;							// The name of the Trace Event.
+			const char* category;						// The category of the Trace Event.
+			std::wstring detail;						// A Wide-Character String describing the Trace Event, if any.
+			TraceRecorder::trace_time_t startTime;		// The time at which the `ScopedTraceTimer` was constructed.
+			bool enabled;								// Indicates if tracing was enabled when the `ScopedTraceTimer` was constructed.
+
+
+		/* Class Constructors & Destructors */
+		public:
+			/**
+			 * Construct a new `ScopedTraceTimer`, starting the timer for its Trace Event.
+			 *
+			 * @param iName			The name of the Trace Event, which must have a Static Storage Duration.
+			 * @param iCategory		The category of the Trace Event, which must have a Static Storage Duration.
+			 * @param iDetail		An optional Wide-Character String describing the Trace Event, such as a file path.
+			 */
+			ScopedTraceTimer ( const char* iName, const char* iCategory, std::wstring_view iDetail = {} );
+			ScopedTraceTimer ( const ScopedTraceTimer& ) = delete;
+			ScopedTraceTimer& operator= ( const ScopedTraceTimer& ) = delete;
+
+			/**
+			 * Destroy the `ScopedTraceTimer`, recording its Trace Event.
+			 */
+			~ScopedTraceTimer ();
+
+	};
+
+}
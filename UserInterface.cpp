@@ -7,10 +7,16 @@
 
 
 #include "UserInterface.h"
+#include "ConfigurationDiscovery.h"
+#include "ConfigurationMetadata.h"
+#include "DisplayTopology.h"
+#include "Tracing.h"
+#include <chrono>
 #include <filesystem>
-#include <fstream>
-#include <regex>
-#include <ShlObj.h>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 
 namespace PROGRAM_NAMESPACE {
@@ -39,7 +45,15 @@ namespace PROGRAM_NAMESPACE {
             + 2U                            // Box Border
         ),
         boxBorder( L"+" + std::wstring(this->consoleBoxWidth + 2U, L'-') + L"+" ),
-        boxSpace( L"|" + std::wstring(this->consoleBoxWidth + 2U, L' ') + L"|" )
+        boxSpace( L"|" + std::wstring(this->consoleBoxWidth + 2U, L' ') + L"|" ),
+        columnHeaders( std::format(
+            L"| {:{}s} {:{}s} {:{}s} {:{}s} {:{}s} |",
+            L"",                     (iLeftColSize + iExtraColPadding),
+            L"Display:",             (iDisplayIdColSize + iExtraColPadding),
+            L"Monitor Name:",        (iMonitorNameColSize + iExtraColPadding),
+            L"Current Resolution:",  (iResolutionColSize + iExtraColPadding),
+            L"Comments:",            (iCommentsColSize + iExtraColPadding)
+        ) )
     {}
 
     // Structure Methods
@@ -59,6 +73,67 @@ namespace PROGRAM_NAMESPACE {
 
     const std::wstring UserInterface::ConfigurationPathHistory::PATH_HISTORY_FILE_NAME = L"path_history";
     const std::filesystem::path UserInterface::ConfigurationPathHistory::PATH_HISTORY_FILE_PATH = { PROGRAM_DATA_PATH / PATH_HISTORY_FILE_NAME };
+    const std::string_view UserInterface::ConfigurationPathHistory::PATH_HISTORY_FILE_SIGNATURE = { "TMPH\x01", 5ULL };
+
+    // Instance Methods
+
+    UserInterface::ConfigurationPathHistory::const_iterator UserInterface::ConfigurationPathHistory::begin () const {
+
+        return this->paths.cbegin();
+
+    }
+    UserInterface::ConfigurationPathHistory::const_iterator UserInterface::ConfigurationPathHistory::end () const {
+
+        return this->paths.cend();
+
+    }
+    size_t UserInterface::ConfigurationPathHistory::size () const {
+
+        return this->paths.size();
+
+    }
+    bool UserInterface::ConfigurationPathHistory::empty () const {
+
+        return this->paths.empty();
+
+    }
+    bool UserInterface::ConfigurationPathHistory::contains ( const std::filesystem::path& path ) const {
+
+        return this->pathIndex.contains( path.native() );
+
+    }
+
+    bool UserInterface::ConfigurationPathHistory::promote ( const std::filesystem::path& path ) {
+
+        // The existing position of the `path` within the `paths`, if any.
+        auto indexItr = this->pathIndex.find( path.native() );
+
+        if ( indexItr == this->pathIndex.end() ) {
+            this->paths.push_front(path);
+            this->pathIndex.emplace( path.native(), this->paths.begin() );
+            return true;
+        }
+        else if ( indexItr->second != this->paths.begin() ) {
+            // Splicing the existing element keeps its position in the `pathIndex` valid.
+            this->paths.splice(this->paths.begin(), this->paths, indexItr->second);
+            return true;
+        }
+
+        return false;
+
+    }
+    UserInterface::ConfigurationPathHistory::const_iterator UserInterface::ConfigurationPathHistory::erase ( const_iterator pos ) {
+
+        this->pathIndex.erase( pos->native() );
+        return this->paths.erase(pos);
+
+    }
+    void UserInterface::ConfigurationPathHistory::clear () {
+
+        this->pathIndex.clear();
+        this->paths.clear();
+
+    }
 
     // Serialization & Persistence to File
 
@@ -67,22 +142,57 @@ namespace PROGRAM_NAMESPACE {
         // The new `ConfigurationPathHistory` object being returned.
         ConfigurationPathHistory pathHistory = {};
 
+        /**
+         * A lambda function used to add a saved Configuration File Path to the end of the `pathHistory`.
+         * 
+         * Depends on and modifies the `pathHistory`.
+         * 
+         * @param path  A Wide-Character String containing the saved Configuration File Path.
+         */
+        auto addSavedPath = [&pathHistory] ( std::wstring&& path ) {
+
+            try {
+                std::filesystem::path savedPath = { std::move(path) };
+
+                if ( !savedPath.empty() && !pathHistory.contains(savedPath) ) {
+                    pathHistory.paths.push_back( std::move(savedPath) );
+                    pathHistory.pathIndex.emplace( pathHistory.paths.back().native(), std::prev(pathHistory.paths.end()) );
+                }
+            }
+            catch (...) {
+                // Ignore invalid paths
+            }
+
+        };
+
         if ( !programSettings.statelessMode ) {
-            std::wifstream fileStream(PATH_HISTORY_FILE_PATH);  // The File Stream used to read the Configuration Path History File.
-            std::wstring currentLine = {};                      // Contains the Current Line from the Configuration Path History File.
+            // The Configuration Path History File, mapped into memory so that it is read all at once.
+            UTILS_NAMESPACE::MemoryMappedFile file = { PATH_HISTORY_FILE_PATH.wstring() };
+            // The raw contents of the Configuration Path History File.
+            std::string_view contents = file.getContents();
 
-            while ( fileStream.good() ) {
-                std::getline(fileStream, currentLine);
+            if ( contents.starts_with(PATH_HISTORY_FILE_SIGNATURE) ) {
+                // Reads each Configuration File Path following the signature in turn.
+                UTILS_NAMESPACE::BinaryReader reader = { contents, PATH_HISTORY_FILE_SIGNATURE.size(), false };
 
-                if ( !currentLine.empty() ) {
-                    try {
-                        pathHistory.emplace_back(currentLine);
-                    }
-                    catch (...) {
-                        // Ignore invalid lines
-                    }
+                while ( reader.pos < reader.contents.size() ) {
+                    std::string_view encodedPath = UTILS_NAMESPACE::readBytes(reader);
+
+                    // Stop reading at the first truncated Configuration File Path.
+                    if (reader.failed)
+                        break;
+
+                    addSavedPath( UTILS_NAMESPACE::utf8ToWideString(encodedPath) );
                 }
             }
+            else {
+                // Configuration Path History Files saved by earlier versions contain one path per line.
+                std::wistringstream fileStream( UTILS_NAMESPACE::utf8ToWideString(contents) );
+                std::wstring currentLine = {};  // Contains the Current Line from the Configuration Path History File.
+
+                while ( std::getline(fileStream, currentLine) )
+                    addSavedPath( std::move(currentLine) );
+            }
         }
 
         // Return the `pathHistory`, regardless of if it was populated with
@@ -97,48 +207,18 @@ namespace PROGRAM_NAMESPACE {
         if (programSettings.statelessMode)
             return true;
 
-        // The path to the Temporary File used to write the contents of the
-        // Configuration Path History to file. 
-        std::optional<std::wstring> tempFilePath = UTILS_NAMESPACE::createTempFile();
-    
-        if (tempFilePath) {
-            // The File Stream used to write to the Temporary File.
-            std::wofstream fileStream(*tempFilePath);
-
-            if ( fileStream.good() ) {
-                if ( !this->empty() ) {
-                    // A reference to the first path in the Configuration Path History.
-                    const std::filesystem::path& firstPath = this->front();
-
-                    for ( const std::filesystem::path& path: *this ) {
-                        if (path != firstPath)
-                            fileStream << L'\n';
-
-                        // We need to explicitly call a method like `c_str()` to avoid passing the 
-                        // `path` directly to `<<`, which will use `std::quoted()` in the output.
-                        fileStream << path.c_str();
-
-                        if ( !fileStream.good() )
-                            break;
-                    }
+        // The contents of the Configuration Path History File, in the Compact Format.
+        std::string contents( PATH_HISTORY_FILE_SIGNATURE );
 
-                    // Once we have finished writing the updated contents of the
-                    // to the Temporary File, we can replace the contents of the 
-                    // Configuration Path History File with the Temporary File.
-                    if ( fileStream.good() ) {
-                        fileStream.close();
-                        
-                        if ( ensureProgramDataDirectoryExists(nullptr) ) {
-                            std::filesystem::rename(*tempFilePath, PATH_HISTORY_FILE_PATH);
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
+        for ( const std::filesystem::path& path : this->paths )
+            UTILS_NAMESPACE::writeBytes( contents, UTILS_NAMESPACE::wideStringToUtf8( path.wstring() ) );
 
+        // The Configuration Path History File is written next to its existing contents,
+        // so the Program Data Directory needs to exist first.
+        if ( !ensureProgramDataDirectoryExists(nullptr) )
+            return false;
 
-        return false;
+        return UTILS_NAMESPACE::writeFileAtomically(PATH_HISTORY_FILE_PATH, contents);
     
     }
 
@@ -172,35 +252,38 @@ namespace PROGRAM_NAMESPACE {
     }
     UserInterface::TextSizing UserInterface::changeTextSizing ( const TextSizing& newTextSizing ) {
     
-        std::wstring greenTermSeq = Console::getVirtualTerminalSequence(L"[92m");
+        static const std::wstring greenTermSeq = Console::getVirtualTerminalSequence(L"[92m");
+        // The colorized `PROGRAM_TITLE`, which does not depend on the `TextSizing` and is only generated once.
+        static const std::wstring colorizedTitle = std::format(
+            L"{:s} by {:s}{:s}{:s} ({:s}v{:s}{:s})",
+            PRIMARY_PROGRAM_TITLE,
+            Console::getVirtualTerminalSequence(L"[94m"),
+            PROGRAM_AUTHOR,
+            greenTermSeq,
+            Console::getVirtualTerminalSequence(L"[96m"),
+            PROGRAM_VERSION,
+            greenTermSeq
+        );
         TextSizing oldTextSizing = std::move(this->textSizing);
+        // The total amount of padding needed to center the `PROGRAM_TITLE`, excluding the Virtual Terminal Sequences.
+        size_t titlePadding = (
+            newTextSizing.consoleBoxWidth > PROGRAM_TITLE.length()
+                ? (newTextSizing.consoleBoxWidth - PROGRAM_TITLE.length())
+                : 0ULL
+        );
 
         this->textSizing = newTextSizing;
 
-        // Generate the `programTitle` according to the new `TextSizing` structure.
-        this->programTitle = std::regex_replace(
-            std::regex_replace(
-                std::format(
-                    L"| {:s}{:^{}s}{:s} |",
-                    greenTermSeq,
-                    PROGRAM_TITLE,
-                    newTextSizing.consoleBoxWidth,
-                    Console::getVirtualTerminalSequence(L"[39m")
-                ), 
-                std::wregex(L"by (.+) \\("), 
-                std::format(
-                    L"by {:s}$1{:s} (",
-                    Console::getVirtualTerminalSequence(L"[94m"),
-                    greenTermSeq
-                )
-            ),
-            std::wregex(L"v[0-9a-zA-z.]+"),
-            std::format(
-                L"{:s}$&{:s}",
-                Console::getVirtualTerminalSequence(L"[96m"),
-                greenTermSeq
-            )
-        );
+        // Generate the `programTitle` according to the new `TextSizing` structure,
+        // centering the title the same way as the `^` Format Specifier.
+        this->programTitle.clear();
+        this->programTitle.append(L"| ")
+                          .append(greenTermSeq)
+                          .append(titlePadding / 2ULL, L' ')
+                          .append(colorizedTitle)
+                          .append(titlePadding - (titlePadding / 2ULL), L' ')
+                          .append( Console::getVirtualTerminalSequence(L"[39m") )
+                          .append(L" |");
 
         return std::move(oldTextSizing);
     
@@ -212,33 +295,61 @@ namespace PROGRAM_NAMESPACE {
 
         // Defines the minimum width of the column containing the Command-Line Flags
         // and Switches for the Program Help/Usage Message. 
-        const unsigned short MAIN_USAGE_FLAG_WIDTH = 40U;
+        static constexpr unsigned short MAIN_USAGE_FLAG_WIDTH = 40U;
 
         // Defines the Command-Line Flags and their associated quick summaries,
         // to be printed for the Program Help/Usage Message.
-        const std::vector< std::pair<std::wstring, std::wstring> > FLAG_SUMMARY_MAP = {
+        static constexpr std::pair<std::wstring_view, std::wstring_view> FLAG_SUMMARY_MAP[] = {
             { L"/?, --help, --usage",                   L"Get help and usage information" },
             { L"-v, --version",                         L"Display Version Information" },
             { L"-d, --dry-run",                         L"Don't write changes to the Configuration File" },
+            { L"    --diff-context <Lines>",            L"Set the unchanged lines printed around each change" },
             { L"-s, --stateless",                       L"Skips reading from or writing to any program files" },
             { L"-y, --yes",                             L"Automatically answer \"yes\" to all Confirmation Prompts" },
             { L"-b, --disable-custom-buffer-behavior",  L"Disable custom behavior for Console Output Buffers" },
+            { L"-m, --monitor <Display Monitor>",       L"Set the Display Monitor without the Main Menu" },
+            { L"-c, --config <Path or Pattern>",        L"Add a Configuration File for use with --monitor" },
+            { L"    --config-list <File>",              L"Add each Configuration File listed in a File" },
+            { L"-w, --watch",                           L"Keep Configuration Files on the same Display Monitor" },
+            { L"    --apply-last",                      L"Restore the Display Monitor of the last Configuration File" },
+            { L"    --preset <Name>",                   L"Apply a Monitor Preset without the Main Menu" },
+            { L"    --save-preset <Name>",              L"Save --monitor and --config as a Monitor Preset" },
+            { L"    --delete-preset <Name>",            L"Delete a Monitor Preset" },
+            { L"    --list-presets",                    L"List the saved Monitor Presets" },
+            { L"    --list-backups",                    L"List the Backups of each Configuration File" },
+            { L"    --restore-backup <Generation>",     L"Restore a Backup of each Configuration File" },
             { L"    --clear-program-data",              L"Clear existing Program Data before launch" },
+            { L"    --trace <File>",                    L"Record a Performance Trace to a File" },
             { L"    --debug",                           L"Enable functionality useful for debugging" }
         };
+        // The Flag Summary Table printed for the Program Help/Usage Message,
+        // which never changes and is therefore only formatted once.
+        static const std::wstring FLAG_SUMMARY_TABLE = [] () {
+
+            std::wstring table = {};
+
+            for ( const auto& [flags, summary] : FLAG_SUMMARY_MAP )
+                std::format_to( std::back_inserter(table), L"\n{:<{}s} {:s}", flags, MAIN_USAGE_FLAG_WIDTH, summary );
+
+            return table;
+
+        } ();
 
         // Print the Help/Usage Message for the Specified Command-Line Argument, Flag, or Switch (if possible).
         if ( argc > 2 ) {
-            std::wstring arg(argv[2]);                                      // The value of the current Command-Line Argument being processed.
+            std::wstring_view arg = argv[2];                                // The value of the current Command-Line Argument being processed.
             std::wstring lcArg = UTILS_NAMESPACE::stringToLowercase(arg);   // The lowercase value of the current Command-Line Argument being processed.
             
-            if ( arg == L"-d" || lcArg == L"--dry-run" ) {
+            if ( arg == L"-d" || lcArg == L"--dry-run" || lcArg == L"--diff-context" ) {
                 this->printArgUsageMessage(
                     L"Dry Run Mode",
-                    L"[ -d | --dry-run ]",
+                    L"[ -d | --dry-run [ --diff-context <Lines> ] ]",
 
-                    L"Writes the contents of the modified Terraria Configuration File to",
-                    L"the Console instead of saving them to the Configuration File."
+                    L"Prints the changes made to the Terraria Configuration File to the Console",
+                    L"as a Unified Diff instead of saving them to the Configuration File.",
+                    L"",
+                    L"Only the changed lines are printed, along with 3 unchanged lines before",
+                    L"and after each of them, which can be changed using --diff-context."
                 );
                 return;
             }
@@ -301,6 +412,85 @@ namespace PROGRAM_NAMESPACE {
                 );
                 return;
             }
+            else if (
+                   arg == L"-m" || lcArg == L"--monitor"
+                || arg == L"-c" || lcArg == L"--config"
+                || lcArg == L"--config-list"
+            ) {
+                this->printArgUsageMessage(
+                    L"Non-Interactive Mode",
+                    L"[ -m | --monitor <Display Monitor> ] [ -c | --config <Path or Pattern> ]... [ --config-list <File> ]",
+
+                    L"Sets the Active Display Monitor in one or more Terraria Configuration Files",
+                    L"without displaying the Main Menu, and prints a JSON Summary of the results.",
+                    L"",
+                    L"The Display Monitor can be specified by its Display Number, Display ID,",
+                    L"EDID Code (e.g., DEL40F7), or Friendly Display Name (e.g., \"DELL U2719D\").",
+                    L"",
+                    L"Each Configuration File path may contain * and ? wildcards in any component,",
+                    L"such as \"C:\\Users\\*\\Documents\\My Games\\Terraria\\config.json\".",
+                    L"The --config-list flag reads one path or pattern from each line of the specified File."
+                );
+                return;
+            }
+            else if ( arg == L"-w" || lcArg == L"--watch" ) {
+                this->printArgUsageMessage(
+                    L"Watch Mode",
+                    L"[ -w | --watch ] [ -c | --config <Path or Pattern> ]...",
+
+                    L"Runs in the background and waits for Windows to change the Display Topology,",
+                    L"then sets the same Display Monitor as the Active Display Monitor in each known",
+                    L"Terraria Configuration File again, even if its Display ID has been reassigned.",
+                    L"",
+                    L"The known Terraria Configuration Files are those previously modified by the program,",
+                    L"those in the Configuration Path History, and any specified using --config.",
+                    L"",
+                    L"While running, other programs can query or correct the Active Display Monitor of each",
+                    L"known Terraria Configuration File over the \\\\.\\pipe\\TerrariaMonitorTool Named Pipe.",
+                    L"Press CTRL + C to stop Watch Mode."
+                );
+                return;
+            }
+            else if ( lcArg == L"--apply-last" ) {
+                this->printArgUsageMessage(
+                    L"Apply-Last Mode",
+                    L"[ --apply-last ]",
+
+                    L"Sets the Display Monitor previously chosen for the most recently used Terraria Configuration File",
+                    L"as its Active Display Monitor again under its current Display ID, and then exits immediately.",
+                    L"",
+                    L"The Console UI is never displayed, making Apply-Last Mode suitable for Windows Shortcuts",
+                    L"and Login Scripts. The Configuration File is only written to if anything actually differs."
+                );
+                return;
+            }
+            else if ( lcArg == L"--preset" || lcArg == L"--save-preset" || lcArg == L"--delete-preset" || lcArg == L"--list-presets" ) {
+                this->printArgUsageMessage(
+                    L"Monitor Presets",
+                    L"[ --preset <Name> | --save-preset <Name> -m <Display Monitor> -c <Path>... | --delete-preset <Name> | --list-presets ]",
+
+                    L"Monitor Presets bind a set of Terraria Configuration Files to a Display Monitor and its Current Display Resolution.",
+                    L"--save-preset saves the Display Monitor and Configuration Files specified using --monitor and --config,",
+                    L"and --preset applies a saved Monitor Preset without displaying the Console UI, after which the program exits.",
+                    L"",
+                    L"The changes made by each Monitor Preset are prepared ahead of time, so applying one usually only writes",
+                    L"the Configuration Files. Monitor Presets can also be applied from the Monitor Presets Menu."
+                );
+                return;
+            }
+            else if ( lcArg == L"--list-backups" || lcArg == L"--restore-backup" ) {
+                this->printArgUsageMessage(
+                    L"Configuration File Backups",
+                    L"[ --list-backups | --restore-backup <Generation> ] [ -c | --config <Path or Pattern> ]...",
+
+                    L"Lists or restores the Backup Generations of the specified Terraria Configuration Files.",
+                    L"",
+                    L"A new Backup Generation is recorded every time a Terraria Configuration File is modified,",
+                    L"and the most recent 50 Backup Generations of each Terraria Configuration File are kept.",
+                    L"The current contents are backed up before a Backup Generation is restored."
+                );
+                return;
+            }
             else if ( arg == L"-v" || lcArg == L"--version" ) {
                 this->printArgUsageMessage(
                     L"Version Details",
@@ -320,6 +510,19 @@ namespace PROGRAM_NAMESPACE {
                 );
                 return;
             }
+            else if ( lcArg == L"--trace" ) {
+                this->printArgUsageMessage(
+                    L"Performance Tracing",
+                    L"[ --trace <File> ]",
+
+                    L"Records how long the slowest parts of the program take, such as querying the Display Monitors,",
+                    L"reading and writing Configuration Files, and drawing to the Console, to the specified File.",
+                    L"",
+                    L"The File is written when the program exits in the Chrome Trace Event Format,",
+                    L"which can be opened using chrome://tracing or https://ui.perfetto.dev."
+                );
+                return;
+            }
         }
 
         // Print the Help/Usage Message for the Main Program.
@@ -330,13 +533,16 @@ namespace PROGRAM_NAMESPACE {
         ->println()
          .println(L"Usage:")
          .println(L"TerrariaMonitorTool [ /?|--help|--usage [<Option or Switch>] ] [ -v | --version ]")
-         .println(L"                    [ -d|--dry-run ] [ -s|--stateless ] [ -y|--yes ]")
+         .println(L"                    [ -d|--dry-run [ --diff-context <Lines> ] ] [ -s|--stateless ] [ -y|--yes ]")
          .println(L"                    [ -b|--disable-custom-buffer-behavior ]")
-         .println(L"                    [ --clear-program-data ] [ --debug ]")
+         .println(L"                    [ -m|--monitor <Display Monitor> [ -c|--config <Path or Pattern> ]...")
+         .println(L"                                                     [ --config-list <File> ] ]")
+         .println(L"                    [ -w|--watch ] [ --apply-last ] [ --list-backups | --restore-backup <Generation> ]")
+         .println(L"                    [ --preset <Name> | --save-preset <Name> | --delete-preset <Name> | --list-presets ]")
+         .println(L"                    [ --clear-program-data ] [ --debug ] [ --trace <File> ]")
          .println();
 
-        for ( const auto& pair : FLAG_SUMMARY_MAP )
-            console->printf(L"\n{:<{}s} {:s}", pair.first, MAIN_USAGE_FLAG_WIDTH, pair.second);
+        console->print(FLAG_SUMMARY_TABLE);
     
     }
 
@@ -362,8 +568,7 @@ namespace PROGRAM_NAMESPACE {
         std::optional<size_t> selectionNum = {};                    // The current selection in the list of `menuOptions`.
 
         std::vector<Console::MenuOptionList::MenuOptionListAction>
-        actionList(Console::MenuOptionList::DEFAULT_ACTIONS);       // The actions applied to the list of `menuOptions`.
-        actionList[1].instructions[0] = L"Press ESC to exit the program.";
+        actionList = {};                                            // The additional actions applied to the list of `menuOptions`.
 
         size_t deletePathActionIndex = actionList.size();           // The index of the Action used to remove individual paths from the Configuration Path History.
 
@@ -397,7 +602,11 @@ namespace PROGRAM_NAMESPACE {
             std::optional<std::wstring> customPath = console.waitForInputData(MAX_CUSTOM_PATH_LENGTH + 1ULL);
 
             if (customPath) {
-                customPath = UTILS_NAMESPACE::trimString(*customPath);
+                // The `customPath` without any surrounding whitespace, which is trimmed in place.
+                std::wstring_view trimmedPath = UTILS_NAMESPACE::trimStringView(*customPath);
+
+                customPath->erase( 0ULL, (size_t) (trimmedPath.data() - customPath->data()) );
+                customPath->resize( trimmedPath.length() );
 
                 if (customPath->ends_with(L"\\"))
                     customPath->pop_back();
@@ -424,40 +633,56 @@ namespace PROGRAM_NAMESPACE {
 
         };
 
+        // The directories containing a Terraria Configuration File that have been discovered so far, in the order they were discovered.
+        std::vector<ConfigurationDiscovery::DiscoveredConfigDirectory> discoveredDirs = {};
+        // The `MenuOption`s of the discovered directories, mapped to the paths of the directories they represent.
+        std::unordered_map<std::wstring, std::wstring> discoveredOptions = {};
+
         /**
-         * A lambda helper function used to get and add the Default Configuration File Path
-         * to the list of `menuOptions`, if it can be detected for the current user.
+         * A lambda helper function used to add a discovered directory to the list of `menuOptions`,
+         * unless it is already present in the `pathHistory` or the list of `menuOptions`.
+         * 
+         * The directory is added after the paths from the `pathHistory`, and the Currently-Selected
+         * `MenuOption` is adjusted so that the same `MenuOption` remains selected.
+         * 
+         * Depends on this object, as well as the `pathHistory` and `discoveredOptions` variables,
+         * the latter of which this lambda function may modify.
+         * 
+         * @param menuOptions   The `MenuOptionList` being modified.
+         * @param directory     The discovered directory being added.
          * 
-         * Depends on this object and the `changeConfigFilePaths()` lambda function, as well as the
-         * `configFileDirPath` and `configFilePath` variables, which this lambda function may modify.
+         * @returns             `true` if the directory was added to the list of `menuOptions`, otherwise `false`.
          */
-        auto addDefaultConfigPath = [this, &changeConfigFilePaths, &configFileDirPath, &configFilePath] (
-            Console::MenuOptionList& menuOptions
-        ) {
+        auto addDiscoveredOption = [this, &pathHistory, &discoveredOptions] (
+            Console::MenuOptionList& menuOptions,
+            const ConfigurationDiscovery::DiscoveredConfigDirectory& directory
+        ) -> bool {
+
+            // The lowercase path of the discovered directory, used to compare it against the `pathHistory`.
+            std::wstring lcDirectoryPath = UTILS_NAMESPACE::stringToLowercase(directory.directoryPath);
+            // The `MenuOption` displayed for the discovered directory.
+            std::wstring option = UTILS_NAMESPACE::truncatePathString(
+                directory.directoryPath + ( directory.isDefault ? std::wstring(L" (Default)") : std::format(L" ({:s})", directory.profileName) ),
+                this->textSizing.consoleBoxWidth
+            );
+            // The position at which the `MenuOption` is inserted, which is just before the non-Configuration Path `MenuOption`s.
+            size_t insertPos = menuOptions.size() - 2ULL;
 
-            // Wide-Character Null-Terminated String to the Current User's Documents Folder.
-            // Has to be freed using `CoTaskMemFree` according to the Windows API.
-            PWSTR documentsFolderPath;
-            // The Folder ID being retrieved from the Windows API.
-            // Has to be stored in a variable according to the Windows API.
-            KNOWNFOLDERID folderId = FOLDERID_Documents;
-
-            if ( SUCCEEDED( SHGetKnownFolderPath(folderId, 0, NULL, &documentsFolderPath) ) ) {
-                changeConfigFilePaths( documentsFolderPath + std::wstring(L"\\My Games\\Terraria") );
-
-                // Only display the Default Configuration File Path if it has been detected for the current user.
-                if ( std::filesystem::exists(configFilePath) ) {
-                    menuOptions.emplace(
-                        menuOptions.cbegin(),
-                        UTILS_NAMESPACE::truncatePathString(
-                            *configFileDirPath + L" (Default)",
-                            this->textSizing.consoleBoxWidth
-                        )
-                    );
-                }
+            for ( const std::filesystem::path& path : pathHistory ) {
+                if ( UTILS_NAMESPACE::stringToLowercase(path.wstring()) == lcDirectoryPath )
+                    return false;
             }
 
-            CoTaskMemFree(documentsFolderPath);
+            if ( !discoveredOptions.emplace(option, directory.directoryPath).second )
+                return false;
+
+            menuOptions.emplace(std::next(menuOptions.cbegin(), insertPos), std::move(option));
+
+            // If no `MenuOption` has been explicitly selected yet, the selection simply stays on the first `MenuOption`.
+            if ( menuOptions.getSelectedOption() && *menuOptions.getSelectedOption() >= insertPos )
+                menuOptions.setSelectedOption(*menuOptions.getSelectedOption() + 1ULL);
+
+            return true;
 
         };
 
@@ -465,13 +690,13 @@ namespace PROGRAM_NAMESPACE {
          * A lambda helper function used to remove the Actions used to manage the
          * `pathHistory` from the list of `menuOptions`.
          * 
-         * Depends on the `addDefaultConfigPath()` lambda function, as well as
-         * the `deletePathActionIndex` and `pathHistory` variables, which this
+         * Depends on the `addDiscoveredOption()` lambda function and the `discoveredDirs` variable,
+         * as well as the `deletePathActionIndex` and `pathHistory` variables, which this
          * lambda function may potentially modify.
          * 
          * @param menuOptions   The `MenuOptionList` being modified.
          */
-        auto removePathActions = [&addDefaultConfigPath, &deletePathActionIndex, &pathHistory] ( Console::MenuOptionList& menuOptions ) {
+        auto removePathActions = [&addDiscoveredOption, &discoveredDirs, &deletePathActionIndex, &pathHistory] ( Console::MenuOptionList& menuOptions ) {
 
             auto& actionList = menuOptions.getActions();    // A reference to the list of Actions for the list of `menuOptions`.
             auto actionListStartItr = actionList.begin();   // Iterator to the first element of the `actionList` being deleted.
@@ -485,8 +710,9 @@ namespace PROGRAM_NAMESPACE {
             pathHistory.deleteSavedData();
             // Remove the actions from the list of `menuOptions`.
             actionList.erase(actionListStartItr, actionListEndItr);
-            // Try to add the Default Configuration File Path to the list of `menuOptions`.
-            addDefaultConfigPath(menuOptions);
+            // Add any discovered directories that were hidden by the Configuration Path History.
+            for ( const ConfigurationDiscovery::DiscoveredConfigDirectory& directory : discoveredDirs )
+                addDiscoveredOption(menuOptions, directory);
 
         };
 
@@ -494,7 +720,7 @@ namespace PROGRAM_NAMESPACE {
         if ( !pathHistory.empty() ) {
             // Remove individual paths from the Configuration Path History
             actionList.emplace_back(
-                [this, &pathHistory, &printUserInterface, &removePathActions, deletePathActionIndex](
+                [this, &pathHistory, &discoveredDirs, &addDiscoveredOption, &printUserInterface, &removePathActions, deletePathActionIndex](
                     const Console::WinConsoleInputKey& key,
                     Console::MenuOptionList& menuOptions,
                     Console& console,
@@ -509,7 +735,7 @@ namespace PROGRAM_NAMESPACE {
                     // Matches `DEL` (but explicitly *not* `SHIFT + DEL`)
                     if ( key.wVirtualKeyCode == VK_DELETE && !(key.dwControlKeyState & SHIFT_PRESSED) ) {
                         // Only trigger for `MenuOption`s that correspond to elements in the `pathHistory`.
-                        if ( currentSelectionNum && *currentSelectionNum < (menuOptions.size() - 2ULL) ) {
+                        if ( currentSelectionNum && *currentSelectionNum < pathHistory.size() ) {
                             auto pathHistoryItr = pathHistory.begin();  // Iterator to the path in the `pathHistory` being removed.
                             auto menuOptionsItr = menuOptions.begin();  // Iteraror to the `MenuOption` in the list of `menuOptions` being removed.
 
@@ -533,8 +759,14 @@ namespace PROGRAM_NAMESPACE {
 
                                 // If the Configuration Path History is empty, remove the additional
                                 // Menu Option Actions used to manage it since they are no longer needed.
-                                if ( pathHistory.empty() )
+                                if ( pathHistory.empty() ) {
                                     removePathActions(menuOptions);
+                                }
+                                // Otherwise, the removed path may have been hiding one of the discovered directories.
+                                else {
+                                    for ( const ConfigurationDiscovery::DiscoveredConfigDirectory& directory : discoveredDirs )
+                                        addDiscoveredOption(menuOptions, directory);
+                                }
 
                                 // Re-draw the User Interface to reflect the changes made to the Configuration Path History.
                                 console.clear();
@@ -576,12 +808,12 @@ namespace PROGRAM_NAMESPACE {
                             // On confirmation, remove the path from the Configuration Path History.
                             // Otherwise, we will simply return the selection menu.
                             if (confirmation && *confirmation) {
-                                // Iterator to the first non-path `MenuOption` in the list of `menuOptions`.
-                                auto menuOptionsItr = menuOptions.end();
+                                // Iterator to the first `MenuOption` in the list of `menuOptions` after the paths from the `pathHistory`.
+                                auto menuOptionsItr = menuOptions.begin();
 
-                                std::advance(menuOptionsItr, -2);
+                                std::advance(menuOptionsItr, pathHistory.size());
 
-                                // Erase all of the path `MenuOption`s in the list of `menuOptions`.
+                                // Erase all of the `pathHistory` `MenuOption`s in the list of `menuOptions`.
                                 menuOptions.erase(menuOptions.begin(), menuOptionsItr);
                                 // Clear the Configuration Path History.
                                 pathHistory.clear();
@@ -609,7 +841,7 @@ namespace PROGRAM_NAMESPACE {
 
         // The list of `MenuOption`s presented to the user.
         Console::MenuOptionList menuOptions = {
-            actionList,
+            std::move(actionList),
             L"| ",
             L" |",
             this->textSizing.boxBorder,
@@ -617,16 +849,44 @@ namespace PROGRAM_NAMESPACE {
             6
         };
 
+        menuOptions.setEscapeInstruction(L"Press ESC to exit the program.");
+
         // Add each of the paths from the `pathHistory` to the list of `menuOptions`.
         if ( !pathHistory.empty() ) {
             for ( const std::filesystem::path& path : pathHistory )
                 menuOptions.emplace_back(
                     UTILS_NAMESPACE::truncatePathString(path.wstring(), this->textSizing.consoleBoxWidth)
                 );
-        }
-        // Get the default path to the Terraria Configuration File.
-        else {
-            addDefaultConfigPath(menuOptions);
+
+            // Checking whether a path still exists can block for some time when it is on a disconnected drive
+            // or network share, so each path is checked on a Background Thread instead, in the order they are displayed.
+            // Each check is the same single File Identity query used by the `ConfigurationMetadataCache`,
+            // and any paths that no longer exist are dimmed as soon as they have been checked.
+            std::thread(
+                [
+                    updateQueue = menuOptions.getUpdateQueue(),
+                    paths = std::vector<std::filesystem::path>(pathHistory.begin(), pathHistory.end()),
+                    consoleBoxWidth = this->textSizing.consoleBoxWidth
+                ] () {
+
+                    for ( const std::filesystem::path& path : paths ) {
+                        if ( ConfigurationMetadataCache::getFileIdentity( (path / CONFIG_FILE_NAME).wstring() ) )
+                            continue;
+
+                        updateQueue->post(
+                            [option = UTILS_NAMESPACE::truncatePathString(path.wstring(), consoleBoxWidth)] ( Console::MenuOptionList& menuOptions ) {
+
+                                for ( Console::MenuOption& menuOption : menuOptions ) {
+                                    if (menuOption.option == option)
+                                        menuOption.dimmed = true;
+                                }
+
+                            }
+                        );
+                    }
+
+                }
+            ).detach();
         }
 
         // Add the non-Configuration Path `MenuOption`s.
@@ -638,6 +898,43 @@ namespace PROGRAM_NAMESPACE {
         );
         menuOptions.emplace_back(L"Exit", L'.');
 
+        // Searching every User Profile for Terraria Configuration Files can take some time, so the search is performed
+        // on a Background Thread instead, and each discovered directory is added to the list of `menuOptions` as soon as it is found.
+        // The updates are only ever applied while waiting for a selection below, and the search is stopped before this method returns.
+        this->discoveryThread = std::jthread(
+            [
+                this,
+                updateQueue = menuOptions.getUpdateQueue(),
+                &discoveredDirs,
+                &addDiscoveredOption,
+                &printUserInterface
+            ] ( std::stop_token stopToken ) {
+
+                ConfigurationDiscovery::discover(
+                    [&] ( const ConfigurationDiscovery::DiscoveredConfigDirectory& directory ) {
+
+                        updateQueue->post(
+                            [this, &discoveredDirs, &addDiscoveredOption, &printUserInterface, directory] ( Console::MenuOptionList& menuOptions ) {
+
+                                discoveredDirs.push_back(directory);
+
+                                // Each added `MenuOption` moves the instructions below the list of `menuOptions`,
+                                // so the entire User Interface is re-drawn rather than only the changed rows.
+                                if ( addDiscoveredOption(menuOptions, directory) ) {
+                                    console->clear();
+                                    printUserInterface(*console, menuOptions);
+                                }
+
+                            }
+                        );
+
+                    },
+                    stopToken
+                );
+
+            }
+        );
+
         // Print the User Interface.
         console->toggleCursorVisibility(false);
         printUserInterface(*console, menuOptions);
@@ -688,10 +985,13 @@ namespace PROGRAM_NAMESPACE {
                 }
             }
             else if (selection.option != L"Exit") {
-                // When a path from the Configuration Path History is selected,
+                // When a path from the Configuration Path History or a discovered directory is selected,
                 // `configFileDirPath` and `configFilePath` need to be updated to the selected path.
-                if ( !selection.option.ends_with(L" (Default)") )
-                    changeConfigFilePaths(selection.option);
+                // The `MenuOption` itself may have been truncated, so the full path is used instead.
+                if ( *selectionNum < pathHistory.size() )
+                    changeConfigFilePaths( std::next(pathHistory.begin(), *selectionNum)->wstring() );
+                else if ( auto discoveredOptionItr = discoveredOptions.find(selection.option); discoveredOptionItr != discoveredOptions.end() )
+                    changeConfigFilePaths( std::wstring(discoveredOptionItr->second) );
 
                 // Ensure the previously-used path still exists.
                 if ( !(isValidPath = std::filesystem::exists(configFilePath)) ) {
@@ -711,31 +1011,18 @@ namespace PROGRAM_NAMESPACE {
                 selectionNum = console->waitForSelection(menuOptions);
         }
 
+        // The discovered directories are no longer needed, and the updates posted by the search refer to the local variables.
+        this->discoveryThread.request_stop();
+        this->discoveryThread.join();
+
         // Once we are done selecting the Configuration File Path, we can remove
         // the Alternate Output Buffer and restore the previous User Interface.
         console->clear(true);
 
         // If a valid Configuration File Path is specified, add it to the
         // `pathHistory` or move it to the front if it already has been.
-        if (isValidPath) {
-            // Iterator to the end of the `pathHistory`.
-            auto pathHistoryEndItr = pathHistory.end();
-            // Iterator to the existing path in the `pathHistory` or `pathHistoryEndItr` if
-            // the path does not exist in the `pathHistory` yet.
-            auto existingPathItr = std::find( pathHistory.begin(), pathHistoryEndItr, *configFileDirPath );
-
-            // If the path does not exist in the `pathHistory` yet, it is added to the front.
-            if ( existingPathItr == pathHistoryEndItr ) {
-                pathHistory.emplace_front( std::filesystem::path(*configFileDirPath).native() );
-                pathHistory.saveToFile();
-            }
-            // If the path already exists in the `pathHistory`, it will be
-            // moved to the front if it is not already.
-            else if ( existingPathItr != pathHistory.begin() ) {
-                pathHistory.splice(pathHistory.begin(), pathHistory, existingPathItr);
-                pathHistory.saveToFile();
-            }
-        }
+        if ( isValidPath && pathHistory.promote( std::filesystem::path(*configFileDirPath) ) )
+            pathHistory.saveToFile();
 
         return (
             isValidPath
@@ -747,15 +1034,40 @@ namespace PROGRAM_NAMESPACE {
     
     std::optional<UserInterface::MainMenuSelection> UserInterface::mainMenu (
         const std::wstring& configFilePath,
-        const DisplayMonitorList& displayMonitors,
+        const DisplayMonitorRegistry& displayMonitors,
         bool renderMenu,
-        DisplayMonitor::display_number_t selectedMonitorNum
+        DisplayMonitorRegistry::monitor_handle_t selectedMonitor
     ) const {
     
         const TextSizing& ts = this->textSizing;                // Constant reference to this object's `TextSizing` object.
         size_t displayMonitorCount = displayMonitors.size();    // The number of Connected Display Monitors.
-        auto menuOptionActions = Console::MenuOptionList::DEFAULT_ACTIONS;
-             menuOptionActions[1].instructions[0] = L"Press ESC to exit the program.";
+        std::vector<Console::MenuOptionList::MenuOptionListAction>
+        menuOptionActions = {};                                 // The additional actions applied to the Main Menu.
+
+        // Indicates if the Display Resolution Menu has been requested for the Currently-Selected `MenuOption`,
+        // which is static since the Actions of the static `menuOptions` below are only created once.
+        static bool resolutionMenuRequested = false;
+
+        // Choose the Display Resolution of the selected Connected Display Monitor
+        menuOptionActions.emplace_back(
+            [](
+                const Console::WinConsoleInputKey& key,
+                Console::MenuOptionList& menuOptions,
+                Console& console,
+                std::optional<size_t>& currentSelectionNum
+            ) -> Console::MenuOptionList::MenuOptionListAction::InputProcessingResult {
+
+                // Matches `R`, but only for the `MenuOption`s of the Connected Display Monitors, which are the only ones without a Hotkey.
+                if ( key.wVirtualKeyCode == L'R' && currentSelectionNum && !menuOptions[*currentSelectionNum].hotkey ) {
+                    resolutionMenuRequested = true;
+                    return std::make_pair(true, true);
+                }
+
+                return std::make_pair(false, false);
+
+            },
+            L"Press R to choose the Display Resolution of the selected monitor."
+        );
 
         /**
          * The `MenuOptionList` used to render the Main Menu,
@@ -763,15 +1075,45 @@ namespace PROGRAM_NAMESPACE {
          * Main Menu's position in the console.
          */
         static Console::MenuOptionList menuOptions = {
-            menuOptionActions,
+            std::move(menuOptionActions),
             L"| ",
             L" |",
             ts.boxBorder,
             (unsigned short) ts.consoleBoxWidth,
             8
         };
-        // Keeps track of the `selectedMonitorNum` between method calls.
-        static DisplayMonitor::display_number_t previousSelectedMonitorNum;
+
+        menuOptions.setEscapeInstruction(L"Press ESC to exit the program.");
+        // Keeps track of the `selectedMonitor` between method calls.
+        static DisplayMonitorRegistry::monitor_handle_t previousSelectedMonitor;
+        /**
+         * Formats the `MenuOption` text for the specified Connected Display Monitor
+         * into the specified buffer, reusing any memory it has already allocated.
+         * 
+         * @param handle        The Handle of the Connected Display Monitor being formatted.
+         * @param oOptionText   The buffer receiving the `MenuOption` text for the Connected Display Monitor.
+         */
+        auto formatMonitorOption = [&ts, &displayMonitors, &selectedMonitor] (
+            DisplayMonitorRegistry::monitor_handle_t handle,
+            _Out_ std::wstring& oOptionText
+        ) {
+            const DisplayMonitor& monitor = displayMonitors[handle];    // The Connected Display Monitor being formatted.
+
+            oOptionText.clear();
+            std::format_to(
+                std::back_inserter(oOptionText),
+                MONITOR_OPTION_FORMAT,
+                (
+                    (selectedMonitor == handle)
+                        ? L"*"
+                        : L""
+                ),                                          (1U + ts.extraColPadding),
+                monitor.displayId,                          (ts.displayIdColSize + ts.extraColPadding),
+                monitor.monitorName,                        (ts.monitorNameColSize + ts.extraColPadding),  
+                monitor.currentResolution.resolutionString, (ts.resolutionColSize + ts.extraColPadding),
+                monitor.comments,                           (ts.commentsColSize + ts.extraColPadding)
+            );
+        };
 
         // Render the Main Menu for the first time.
         if (renderMenu) {
@@ -781,101 +1123,83 @@ namespace PROGRAM_NAMESPACE {
                 menuOptions.clear();
             }
             
-            previousSelectedMonitorNum = selectedMonitorNum;
+            previousSelectedMonitor = selectedMonitor;
 
             // Generate a `MenuOption` object for each Connected Display Monitor
             // and add it to our list of `menuOptions`.
-            for (const DisplayMonitor& monitor : displayMonitors) {
+            for (DisplayMonitorRegistry::monitor_handle_t handle = 0U; handle < displayMonitorCount; handle++) {
+                std::wstring optionText = {};   // The `MenuOption` text for the Connected Display Monitor.
+
+                formatMonitorOption(handle, optionText);
                 menuOptions.emplace_back(
-                    std::format(
-                        L"{:^{}s} {:{}s} {:{}s} {:{}s} {:{}s}",
-                        (
-                            (selectedMonitorNum == monitor.displayNum)
-                                ? L"*"
-                                : L""
-                        ),                                          (1U + ts.extraColPadding),
-                        monitor.displayId,                          (ts.displayIdColSize + ts.extraColPadding),
-                        monitor.monitorName,                        (ts.monitorNameColSize + ts.extraColPadding),  
-                        monitor.currentResolution.resolutionString, (ts.resolutionColSize + ts.extraColPadding),
-                        monitor.comments,                           (ts.commentsColSize + ts.extraColPadding)
-                    ),
+                    std::move(optionText),
                     std::optional<wchar_t>()
                 );
                 
-                if (selectedMonitorNum == monitor.displayNum)
+                if (selectedMonitor == handle)
                     menuOptions.setSelectedOption(menuOptions.size() - 1ULL);
             }
 
             // Add the remaining `MenuOption`s to our list of `menuOptions`.
             menuOptions.emplace_back(
-                L"Configuration File Backups", L'b', 
+                L"Monitor Presets", L'p', 
                 true, 
                 Console::MenuOption::MenuOptionPadding(true)
             );
+            menuOptions.emplace_back(L"Configuration File Backups", L'b', true);
             menuOptions.emplace_back(L"Settings", L's', true);
             menuOptions.emplace_back(L"Exit", L'.', false);
 
-            // Render the Main Menu 
-            this->console->toggleCursorVisibility(false);
+            // Render the Main Menu as a single Output Frame.
+            this->console->beginFrame()
+                 .toggleCursorVisibility(false);
             this->printInterfaceHeader(
                 L"",
                 L"Editing Configuration File:",
                 UTILS_NAMESPACE::truncatePathString(configFilePath, ts.consoleBoxWidth - 4ULL)
             )
                  .console
-                ->printfln(
-                    L"| {:{}s} {:{}s} {:{}s} {:{}s} {:{}s} |",
-                    L"",                     (ts.leftColSize + ts.extraColPadding),
-                    L"Display:",             (ts.displayIdColSize + ts.extraColPadding),
-                    L"Monitor Name:",        (ts.monitorNameColSize + ts.extraColPadding),
-                    L"Current Resolution:",  (ts.resolutionColSize + ts.extraColPadding),
-                    L"Comments:",            (ts.commentsColSize + ts.extraColPadding)
-                 )
+                ->println(ts.columnHeaders)
                  .println(ts.boxSpace)
-                 .printMenuOptions(menuOptions, true);
+                 .printMenuOptions(menuOptions, true)
+                 .commitFrame();
         }
         // Update the Main Menu to reflect any changes.
-        else if (selectedMonitorNum != previousSelectedMonitorNum) {
+        else if (selectedMonitor != previousSelectedMonitor) {
             if ( !menuOptions.getCursorStartPos() )
                 throw std::logic_error("The Cursor Start Position of the MenuOptionList has not been properly set.");
 
-            auto markerPos = *menuOptions.getCursorStartPos();
-                 markerPos.X += 6;
-
-            previousSelectedMonitorNum = selectedMonitorNum;
-            this->console->saveCursorPos();
+            previousSelectedMonitor = selectedMonitor;
 
             // Re-render the list of Connected Display Monitors to reflect any changes
-            // made to the Active Display Monitor.
-            for (size_t i = 0ULL; i < displayMonitors.size(); i++) {
-                const DisplayMonitor& monitor = displayMonitors[i];
-                Console::MenuOption& menuOption = menuOptions[i];
+            // made to the Active Display Monitor. Only the rows that have changed are repainted.
+            for (DisplayMonitorRegistry::monitor_handle_t handle = 0U; handle < displayMonitorCount; handle++) {
+                Console::MenuOption& menuOption = menuOptions[handle];
 
-                this->console->setCursorPos(markerPos);
+                formatMonitorOption(handle, menuOption.option);
 
-                if (monitor.displayNum != selectedMonitorNum) {
-                    this->console->print(L' ');
-                }
-                else {
-                    this->console->print(L'*');
-                    menuOptions.setStatusMessage(L"Successfully set " + monitor.monitorName + L" as the Active Display Monitor!");
-                }
-
-                markerPos.Y += 1;
+                if (handle == selectedMonitor)
+                    menuOptions.setStatusMessage(L"Successfully set " + displayMonitors[handle].monitorName + L" as the Active Display Monitor!");
             }
 
-            this->console->restoreSavedCursorPos();
+            this->console->redrawMenuOptions(menuOptions);
         }
 
         // Wait for the user to make a valid selection and return the appropriate value.
         std::optional<size_t> selection = this->console->waitForSelection(menuOptions);
 
         if (selection) {
+            // The Display Resolution of a Connected Display Monitor is to be chosen before it is made the Active Display Monitor.
+            if ( std::exchange(resolutionMenuRequested, false) && *selection < displayMonitorCount )
+                return ResolutionMenuSelection{ .monitorHandle = (DisplayMonitorRegistry::monitor_handle_t) *selection };
+
             // A Connected Display Monitor was selected to be made the Active Display Monitor.
-            if ( *selection < displayMonitors.size() )
-                return displayMonitors[*selection];
+            else if ( *selection < displayMonitorCount )
+                return (DisplayMonitorRegistry::monitor_handle_t) *selection;
 
             // Another Menu Option was selected.
+            else if ( menuOptions[*selection].option == L"Monitor Presets" )
+                return MONITOR_PRESETS_MENU_OPTION;
             else if ( menuOptions[*selection].option == L"Configuration File Backups" )
                 return CONFIG_FILE_BACKUPS_MENU_OPTION;
             else if ( menuOptions[*selection].option == L"Settings" )
@@ -887,6 +1211,138 @@ namespace PROGRAM_NAMESPACE {
         // `ESC` was used to exit the Main Menu (or an invalid option was somehow selected).
         return std::optional<MainMenuOption>();
     
+    }
+    std::optional<DisplayMonitor::DisplayResolution> UserInterface::promptForDisplayResolution ( const DisplayMonitor& monitor ) const {
+
+        // The pending Display Resolutions supported by the `monitor`, which are usually already available.
+        std::shared_future<DisplayModeCatalog::DisplayResolutionList> pendingResolutions = DisplayModeCatalog::requestSupportedResolutions(monitor);
+        // The Display Resolutions supported by the `monitor`.
+        DisplayModeCatalog::DisplayResolutionList resolutions = {};
+        // The current selection in the list of `menuOptions`.
+        std::optional<size_t> selection = {};
+
+
+        this->console->createAltBuffer();
+        this->console->toggleCursorVisibility(false);
+        this->printInterfaceHeader(L"Display Resolution", monitor.monitorName);
+
+        // The Display Modes of the `monitor` are only enumerated the first time for the Current Display Topology.
+        if ( pendingResolutions.wait_for(std::chrono::seconds(0)) != std::future_status::ready ) {
+            this->console->println(L"Retrieving the Display Resolutions supported by the Display Monitor...");
+
+            pendingResolutions.wait();
+            this->console->clear();
+            this->printInterfaceHeader(L"Display Resolution", monitor.monitorName);
+        }
+
+        try {
+            resolutions = pendingResolutions.get();
+        }
+        catch (...) {}
+
+        // The list of `MenuOption`s presented to the user.
+        Console::MenuOptionList menuOptions = {
+            {},
+            L"| ",
+            L" |",
+            this->textSizing.boxBorder,
+            this->textSizing.consoleBoxWidth,
+            8
+        };
+
+        menuOptions.setEscapeInstruction(L"Press ESC to return to the Main Menu.");
+
+        // Add each of the supported Display Resolutions to the list of `menuOptions`,
+        // initially selecting the Current Display Resolution of the `monitor`.
+        for ( const DisplayMonitor::DisplayResolution& resolution : resolutions ) {
+            if ( resolution.resolutionString == monitor.currentResolution.resolutionString ) {
+                menuOptions.emplace_back(resolution.resolutionString + L" (Current)");
+                menuOptions.setSelectedOption( menuOptions.size() - 1ULL );
+            }
+            else {
+                menuOptions.emplace_back(resolution.resolutionString);
+            }
+        }
+
+        if ( resolutions.empty() )
+            menuOptions.setStatusMessage(L"The supported Display Resolutions could not be retrieved from the Windows API.");
+
+        menuOptions.emplace_back(
+            L"Return to Main Menu",
+            L'.',
+            false,
+            Console::MenuOption::MenuOptionPadding(true)
+        );
+
+        this->console->printMenuOptions(menuOptions, true);
+
+        // Wait for the user to make a selection in the Interactive Menu.
+        selection = this->console->waitForSelection(menuOptions);
+        this->console->restorePreviousBuffer();
+
+        if ( selection && *selection < resolutions.size() )
+            return resolutions[*selection];
+
+        return std::nullopt;
+
+    }
+
+    std::optional<std::wstring> UserInterface::promptForMonitorPreset ( const MonitorPresetStore::MonitorPresetMap& presets ) const {
+
+        // The names of the `presets`, in the same order as their `MenuOption`s.
+        std::vector<std::wstring> presetNames = {};
+        // The current selection in the list of `menuOptions`.
+        std::optional<size_t> selection = {};
+
+
+        // The list of `MenuOption`s presented to the user.
+        Console::MenuOptionList menuOptions = {
+            {},
+            L"| ",
+            L" |",
+            this->textSizing.boxBorder,
+            this->textSizing.consoleBoxWidth,
+            8
+        };
+
+        menuOptions.setEscapeInstruction(L"Press ESC to return to the Main Menu.");
+
+        // Add each of the saved Monitor Presets to the list of `menuOptions`.
+        for ( const auto& [name, preset] : presets ) {
+            presetNames.push_back(name);
+            menuOptions.emplace_back( std::format(
+                L"{:s} ({:s}, {:d} Terraria Configuration Files)",
+                name,
+                preset.resolution.resolutionString,
+                preset.patchPlans.size()
+            ) );
+        }
+
+        if ( presets.empty() )
+            menuOptions.setStatusMessage(L"No Monitor Presets have been saved yet. Use --save-preset to save one.");
+
+        menuOptions.emplace_back(
+            L"Return to Main Menu",
+            L'.',
+            false,
+            Console::MenuOption::MenuOptionPadding(true)
+        );
+
+        this->console->createAltBuffer();
+        this->console->toggleCursorVisibility(false);
+        this->printInterfaceHeader(L"Monitor Presets")
+             .console
+            ->printMenuOptions(menuOptions, true);
+
+        // Wait for the user to make a selection in the Interactive Menu.
+        selection = this->console->waitForSelection(menuOptions);
+        this->console->restorePreviousBuffer();
+
+        if ( selection && *selection < presetNames.size() )
+            return presetNames[*selection];
+
+        return std::nullopt;
+
     }
 
     std::optional<bool> UserInterface::promptForConfirmation (
@@ -900,7 +1356,7 @@ namespace PROGRAM_NAMESPACE {
                 { L"Yes", L'y' },
                 { L"No", L'n' }
             },
-            Console::MenuOptionList::DEFAULT_ACTIONS,
+            {},
             L"| ",
             L" |",
             this->textSizing.boxBorder,
@@ -963,7 +1419,7 @@ namespace PROGRAM_NAMESPACE {
 
         // Executes the lambda function once per line of the `subtitle`.
         ([&] {
-            console.printfln(L"| {:^{}s} |", subtitle, this->textSizing.consoleBoxWidth);
+            console.println( std::format(HEADER_SUBTITLE_FORMAT, subtitle, this->textSizing.consoleBoxWidth) );
         } (), ...);
         
         console.println(this->textSizing.boxBorder);
@@ -12,7 +12,9 @@
 
 #include "framework.h"
 #include "Console.h"
+#include "MonitorPresets.h"
 #include <list>
+#include <thread>
 
 
 namespace PROGRAM_NAMESPACE {
@@ -32,21 +34,33 @@ namespace PROGRAM_NAMESPACE {
 			 */
 			enum MainMenuOption {
 
+				MONITOR_PRESETS_MENU_OPTION,		// Navigate to the Monitor Presets Menu.
 				CONFIG_FILE_BACKUPS_MENU_OPTION,	// Navigate to the Configuration File Backups Menu.
 				PROGRAM_SETTINGS_MENU_OPTION,		// Navigate to the Program Settings Menu.
 				EXIT_MENU_OPTION					// Exit the Program.
 
 			};
 
+			/**
+			 * A structure type representing a request made in the Main Menu of the User Interface
+			 * to choose the Display Resolution of a Connected Display Monitor.
+			 */
+			typedef struct ResolutionMenuSelectionStruct {
+
+				DisplayMonitorRegistry::monitor_handle_t monitorHandle;		// The Handle of the Connected Display Monitor.
+
+			} ResolutionMenuSelection;
+
 			/**
 			 * A Type-Safe Union representing the selection
 			 * made in the Main Menu of the User Interface.
 			 * 
-			 * The `std::variant` will contain either a `DisplayMonitor`
-			 * representing a Connected Display Monitor to make the new Active Display Monitor,
-			 * or a `MainMenuOption` representing an alternate menu option that has been selected.
+			 * The `std::variant` will contain either the Handle of a Connected Display Monitor
+			 * within the `DisplayMonitorRegistry` to make the new Active Display Monitor,
+			 * a `ResolutionMenuSelection` if the Display Resolution of a Connected Display Monitor
+			 * is to be chosen first, or a `MainMenuOption` representing an alternate menu option that has been selected.
 			 */
-			typedef std::variant<MainMenuOption, DisplayMonitor> MainMenuSelection;
+			typedef std::variant<MainMenuOption, DisplayMonitorRegistry::monitor_handle_t, ResolutionMenuSelection> MainMenuSelection;
 
 
 		/* Inner Classes & Structure Types */
@@ -79,6 +93,7 @@ namespace PROGRAM_NAMESPACE {
 					text_sizing_t consoleBoxWidth;		// The total width of a single line of the User Interface.
 					std::wstring boxBorder;				// A Wide-Character String containing the "border line" for the User Interface.
 					std::wstring boxSpace;				// A Wide-Character String containing a "blank line" for the User Interface.
+					std::wstring columnHeaders;			// A Wide-Character String containing the column headings of the Connected Display Monitor Menu Options.
 
 
 				/* Structure Constructors */
@@ -131,27 +146,120 @@ namespace PROGRAM_NAMESPACE {
 
 			} TextSizing;
 
+		public:
 			/**
-			 * An internal class comprising a collection of `std::filesystem::path` objects
-			 * that represents the history of previously-used Configuration File Paths.
+			 * An internal class representing the history of previously-used Configuration File Paths,
+			 * ordered from the most-recently used to the least-recently used.
 			 * 
-			 * This class is an extension of an `std::list` of `std::filesystem::path` objects
-			 * that inherits and exports all of its public members, including the `std::list` constructors.
+			 * The Configuration File Paths are stored in an `std::list`, alongside an index of the position of
+			 * each path within it, so that both finding a path and promoting it to the front take constant time
+			 * regardless of the length of the history.
 			 * 
 			 * @internal	This class and all of its associated functionality are for
 			 * 				internal use only and are subject to change at any time.
+			 * 				It is only accessible outside of the `UserInterface` so that
+			 * 				Watch Mode can find previously-used Terraria Configuration Files.
 			 */
-			class ConfigurationPathHistory : public std::list<std::filesystem::path> {
+			class ConfigurationPathHistory {
+
+				/* Type Definitions */
+				public:
+					// A Bidirectional Iterator over the Configuration File Paths, from the most- to the least-recently used.
+					typedef std::list<std::filesystem::path>::const_iterator const_iterator;
+
 
 				/* Class Constants */
 				protected:
 					static const std::wstring PATH_HISTORY_FILE_NAME;			// The name of the file used to store the Configuration Path History.
 					static const std::filesystem::path PATH_HISTORY_FILE_PATH;	// The path to the file used to store the Configuration Path History.
+					/**
+					 * The bytes at the beginning of a Configuration Path History File stored in the Compact Format.
+					 * 
+					 * In the Compact Format, the signature is followed by each Configuration File Path, 
+					 * each of which is encoded as UTF-8 and prefixed by its length in bytes as a
+					 * Variable-Length Integer (7 bits per byte, least-significant group first).
+					 * 
+					 * Files without the signature are read as the original format, with one path per line.
+					 */
+					static const std::string_view PATH_HISTORY_FILE_SIGNATURE;
+
+
+				/* Instance Properties */
+				private:
+					// The Configuration File Paths, ordered from the most-recently used to the least-recently used.
+					std::list<std::filesystem::path> paths = {};
+					// The position of each of the Configuration File Paths within the `paths`, indexed by their native strings.
+					std::unordered_map<std::filesystem::path::string_type, std::list<std::filesystem::path>::iterator> pathIndex = {};
+
 
-			
 				/* Class Constructors */
 				public:
-					using list::list;	// Inherit and export the `std::list` constructors.
+					ConfigurationPathHistory () = default;
+					// As the `pathIndex` refers to the elements of the `paths`, the `ConfigurationPathHistory` can only be moved.
+					ConfigurationPathHistory ( const ConfigurationPathHistory& ) = delete;
+					ConfigurationPathHistory ( ConfigurationPathHistory&& ) = default;
+
+					ConfigurationPathHistory& operator= ( const ConfigurationPathHistory& ) = delete;
+					ConfigurationPathHistory& operator= ( ConfigurationPathHistory&& ) = default;
+
+
+				/* Instance Methods */
+				public:
+					/**
+					 * Get an iterator to the most-recently used Configuration File Path.
+					 * 
+					 * @returns		A `const_iterator` to the first Configuration File Path.
+					 */
+					const_iterator begin () const;
+					/**
+					 * Get an iterator to one position past the least-recently used Configuration File Path.
+					 * 
+					 * @returns		A `const_iterator` to one position past the last Configuration File Path.
+					 */
+					const_iterator end () const;
+					/**
+					 * Get the number of Configuration File Paths in the Configuration Path History.
+					 * 
+					 * @returns		The number of Configuration File Paths.
+					 */
+					size_t size () const;
+					/**
+					 * Determine if the Configuration Path History is empty.
+					 * 
+					 * @returns		`true` if there are no Configuration File Paths in the Configuration Path History.
+					 */
+					bool empty () const;
+					/**
+					 * Determine if the Configuration Path History contains the specified Configuration File Path.
+					 * 
+					 * @param path	The Configuration File Path being searched for.
+					 * 
+					 * @returns		`true` if the `path` is in the Configuration Path History, otherwise `false`.
+					 */
+					bool contains ( const std::filesystem::path& path ) const;
+
+					/**
+					 * Mark the specified Configuration File Path as the most-recently used,
+					 * adding it to the front of the Configuration Path History or moving it there if it already exists.
+					 * 
+					 * @param path	The Configuration File Path being promoted.
+					 * 
+					 * @returns		`true` if the Configuration Path History was modified, or `false`
+					 * 				if the `path` was already the most-recently used Configuration File Path.
+					 */
+					bool promote ( const std::filesystem::path& path );
+					/**
+					 * Remove a Configuration File Path from the Configuration Path History.
+					 * 
+					 * @param pos	A `const_iterator` to the Configuration File Path being removed.
+					 * 
+					 * @returns		A `const_iterator` to the Configuration File Path following the removed one.
+					 */
+					const_iterator erase ( const_iterator pos );
+					/**
+					 * Remove all of the Configuration File Paths from the Configuration Path History.
+					 */
+					void clear ();
 
 
 				/* Serialization & Persistence to File */
@@ -160,7 +268,8 @@ namespace PROGRAM_NAMESPACE {
 					 * Fetch the Configuration Path History from the saved 
 					 * Configuration Path History File, if applicable.
 					 * 
-					 * The Configuration Path History is stored in a file located at `PATH_HISTORY_FILE_PATH`.
+					 * The Configuration Path History is stored in a file located at `PATH_HISTORY_FILE_PATH`,
+					 * which is read using a single Memory-Mapped View of the file.
 					 * 
 					 * @returns		A new `ConfigurationPathHistory` object.
 					 * 
@@ -176,7 +285,8 @@ namespace PROGRAM_NAMESPACE {
 					/**
 					 * Save the Configuration File Paths stored in this object to a file.
 					 * 
-					 * The Configuration Path History is stored in a file located at `PATH_HISTORY_FILE_PATH`.
+					 * The Configuration Path History is stored in a file located at `PATH_HISTORY_FILE_PATH`,
+					 * and is always written in the Compact Format described by `PATH_HISTORY_FILE_SIGNATURE`.
 					 * 
 					 * @return		`true` on success and `false` on failure.
 					 */
@@ -185,10 +295,9 @@ namespace PROGRAM_NAMESPACE {
 					 * Delete the Configuration Path History File.
 					 * 
 					 * This method does *not* call or replicate the behavior of
-					 * the `clear()` method inherited from `std::list`, meaning that
-					 * all of the Configuration File Paths currently stored in this object
-					 * will still be accessible even after invoking this method and
-					 * deleting the Configuration Path History File.
+					 * the `clear()` method, meaning that all of the Configuration File Paths
+					 * currently stored in this object will still be accessible even after
+					 * invoking this method and deleting the Configuration Path History File.
 					 * 
 					 * All of the Configuration File Paths currently stored in the
 					 * Configuration Path History File located at `PATH_HISTORY_FILE_PATH`
@@ -205,6 +314,15 @@ namespace PROGRAM_NAMESPACE {
 			};
 
 
+		/* Class Constants */
+		protected:
+			// The Format Specification of a Connected Display Monitor Menu Option, whose column widths are taken from the
+			// `TextSizing`. As a constant expression, it is checked and parsed when the program is compiled rather than on every redraw.
+			static constexpr std::wstring_view MONITOR_OPTION_FORMAT = L"{:^{}s} {:{}s} {:{}s} {:{}s} {:{}s}";
+			// The Format Specification of each line of the subtitle of the Interface Header.
+			static constexpr std::wstring_view HEADER_SUBTITLE_FORMAT = L"| {:^{}s} |";
+
+
 		/* Instance Properties */
 		private:
 			// The `TextSizing` structure containing all of the properties associated with
@@ -222,6 +340,14 @@ namespace PROGRAM_NAMESPACE {
 			 */
 			std::wstring programTitle = {};
 
+			/**
+			 * The Background Thread searching for Terraria Configuration Files while the Configuration File Path Screen is displayed.
+			 *
+			 * The search is stopped and the thread is joined before `promptForConfigFilePath()` returns, as well as when
+			 * the `UserInterface` is destroyed, so that it never outlives the Program Data and Program Settings it uses.
+			 */
+			mutable std::jthread discoveryThread = {};
+
 
 		/* Class Constructors */
 		public:
@@ -312,24 +438,27 @@ namespace PROGRAM_NAMESPACE {
 			 * 
 			 * The user will have the option to select the Active Display Monitor
 			 * from the list of Connected Display Monitors, as well as navigate
-			 * to the Configuration File Backups Menu, navigate to the Program Settings Menu,
-			 * or exit the program.
+			 * to the Monitor Presets Menu, navigate to the Configuration File Backups Menu,
+			 * navigate to the Program Settings Menu, or exit the program.
+			 * 
+			 * Pressing `R` on a Connected Display Monitor returns a `ResolutionMenuSelection`
+			 * instead, so that its Display Resolution can be chosen using `promptForDisplayResolution()`.
 			 * 
 			 * This method is intended to be repeatedly invoked each time
-			 * that a `DisplayMonitor` is returned and until a `MainMenuOption`
+			 * that a Display Monitor Handle is returned and until a `MainMenuOption`
 			 * is returned instead. When using the method in this manner, the `renderMenu` argument
 			 * should be `true` for the *first call only*, and it should be made `false` for
 			 * *all subsequent calls* until a `MainMenuOption` is returned.
 			 * 
 			 * @param configFilePath		The current path to the Terraria Configuration File being used.
 			 * 
-			 * @param displayMonitors		A `DisplayMonitorList` containing the Connected Display Monitors to choose from.
+			 * @param displayMonitors		A `DisplayMonitorRegistry` containing the Connected Display Monitors to choose from.
 			 * 
 			 * @param renderMenu			Indicates whether the Main Menu should be rendered for the first time (`true`),
 			 * 								or if the Main Menu should be updated to reflect any changes to
 			 * 								the Active Display Monitor (`false`).
 			 * 
-			 * @param selectedMonitorNum	The Display Number of the Active Display Monitor.
+			 * @param selectedMonitor		The Handle of the Active Display Monitor.
 			 * 
 			 * @returns						Returns a Type-Safe `MainMenuSelection` Union, 
 			 * 								wrapped in an `std::optional` object.
@@ -341,10 +470,42 @@ namespace PROGRAM_NAMESPACE {
 			 */
 			std::optional<UserInterface::MainMenuSelection> mainMenu (
 				const std::wstring& configFilePath,
-				const DisplayMonitorList& displayMonitors,
+				const DisplayMonitorRegistry& displayMonitors,
 				bool renderMenu = true,
-				DisplayMonitor::display_number_t selectedMonitorNum = 1U
+				DisplayMonitorRegistry::monitor_handle_t selectedMonitor = 0U
 			) const;
+			/**
+			 * Prompt the user to choose one of the Display Resolutions supported by a Connected Display Monitor.
+			 * 
+			 * The supported Display Resolutions are retrieved from the `DisplayModeCatalog`, so the
+			 * Display Modes of the Display Monitor are only enumerated the first time this menu is opened
+			 * for the Current Display Topology.
+			 * 
+			 * An Alternate Output Buffer will be created to display the Display Resolution Menu,
+			 * and the previous Output Buffer and User Interface will be restored before this method returns.
+			 * 
+			 * @param monitor	The `DisplayMonitor` corresponding to the Connected Display Monitor.
+			 * 
+			 * @returns			The Display Resolution chosen by the user, wrapped in an `std::optional` object.
+			 * 
+			 * 					If the user returned to the Main Menu without choosing a Display Resolution,
+			 * 					an empty `std::optional` object will be returned instead.
+			 */
+			std::optional<DisplayMonitor::DisplayResolution> promptForDisplayResolution ( const DisplayMonitor& monitor ) const;
+			/**
+			 * Prompt the user to choose one of the saved Monitor Presets to be applied.
+			 * 
+			 * An Alternate Output Buffer will be created to display the Monitor Presets Menu,
+			 * and the previous Output Buffer and User Interface will be restored before this method returns.
+			 * 
+			 * @param presets	The `MonitorPresetMap` containing the saved Monitor Presets.
+			 * 
+			 * @returns			The name of the Monitor Preset chosen by the user, wrapped in an `std::optional` object.
+			 * 
+			 * 					If the user returned to the Main Menu without choosing a Monitor Preset,
+			 * 					an empty `std::optional` object will be returned instead.
+			 */
+			std::optional<std::wstring> promptForMonitorPreset ( const MonitorPresetStore::MonitorPresetMap& presets ) const;
 
 			/**
 			 * Prompt the user for confirmation to proceed with an action.
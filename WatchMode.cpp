@@ -0,0 +1,657 @@
+/*
+* WatchMode.cpp
+*
+* Source File defining the `MonitorAssignmentStore` class, which remembers the Display Monitor
+* assigned to each Terraria Configuration File by its Stable Identity, as well as the functions
+* used to run Watch Mode, which keeps those assignments correct as the Display Topology changes,
+* and Apply-Last Mode, which restores the assignment of the most recently used file once.
+*/
+
+
+#include "WatchMode.h"
+#include "Console.h"
+#include "ControlPipe.h"
+#include "Tracing.h"
+#include "UserInterface.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+
+
+namespace PROGRAM_NAMESPACE {
+
+    /* Internal Type Definitions */
+
+    /**
+     * A structure type representing the Active Display Monitor parsed from a Terraria Configuration File,
+     * which is kept by Watch Mode until the Terraria Configuration File is modified again.
+     */
+    typedef struct ParsedConfigFileStruct {
+
+        std::filesystem::file_time_type lastWriteTime = {};     // The time the Terraria Configuration File was last modified when it was parsed.
+        std::optional<std::wstring> activeDisplayId = {};       // The Display ID of the Active Display Monitor, if one is set.
+
+    } ParsedConfigFile;
+
+
+    /* Internal Variables */
+
+    // Serializes all modifications of the Monitor Assignments File made by this process,
+    // such as when multiple Terraria Configuration Files are modified concurrently in Non-Interactive Mode.
+    static std::mutex assignmentStoreMutex = {};
+
+
+    /* Internal Helper Functions */
+
+    /**
+     * Get the key used for a Terraria Configuration File within a `MonitorAssignmentMap`.
+     *
+     * @param filePath  The path to the Terraria Configuration File.
+     *
+     * @returns         The absolute path to the Terraria Configuration File.
+     */
+    static std::wstring getAssignmentKey ( const std::wstring& filePath ) {
+
+        std::error_code errorCode = {};     // Receives any errors raised while resolving the absolute path.
+        std::filesystem::path absolutePath = std::filesystem::absolute(filePath, errorCode);
+
+        return ( errorCode ? filePath : absolutePath.wstring() );
+
+    }
+
+
+    /**
+     * Find the Connected Display Monitor with the specified Stable Identity.
+     *
+     * @param displayMonitors   The Connected Display Monitors.
+     * @param stableId          The Stable Identity of the Display Monitor, as returned by `DisplayMonitor::getStableId()`.
+     *
+     * @returns                 An iterator to the Display Monitor within the `displayMonitors`,
+     *                          or the end iterator if it is not currently connected.
+     */
+    static DisplayMonitorList::const_iterator findMonitorByStableId ( const DisplayMonitorList& displayMonitors, const std::wstring& stableId ) {
+
+        return std::find_if(
+            displayMonitors.begin(),
+            displayMonitors.end(),
+            [&stableId] ( const DisplayMonitor& monitor ) { return monitor.getStableId() == stableId; }
+        );
+
+    }
+
+
+    /* MonitorAssignmentStore */
+    // Class Constants
+
+    const std::wstring MonitorAssignmentStore::ASSIGNMENTS_FILE_NAME = L"monitor_assignments";
+    const std::filesystem::path MonitorAssignmentStore::ASSIGNMENTS_FILE_PATH = { PROGRAM_DATA_PATH / ASSIGNMENTS_FILE_NAME };
+
+    // Static Methods
+
+    bool MonitorAssignmentStore::assignMonitor ( const std::wstring& filePath, const DisplayMonitor& monitor ) {
+
+        return assignMonitor( filePath, monitor.getStableId() );
+
+    }
+
+    bool MonitorAssignmentStore::assignMonitor ( const std::wstring& filePath, const std::wstring& stableId ) {
+
+        std::lock_guard<std::mutex> lock(assignmentStoreMutex);     // Held while the Monitor Assignments File is modified.
+        MonitorAssignmentMap assignments = fetchFromFile();         // The existing Monitor Assignments.
+        std::wstring& assignedId = assignments[getAssignmentKey(filePath)];
+
+        if (assignedId == stableId)
+            return true;
+
+        assignedId = stableId;
+        return saveToFile(assignments);
+
+    }
+
+    std::optional<std::wstring> MonitorAssignmentStore::getAssignedMonitor ( const std::wstring& filePath ) {
+
+        MonitorAssignmentMap assignments = fetchFromFile();                         // The existing Monitor Assignments.
+        MonitorAssignmentMap::iterator assignmentItr = assignments.find( getAssignmentKey(filePath) );
+
+        if ( assignmentItr == assignments.end() )
+            return std::nullopt;
+
+        return std::move(assignmentItr->second);
+
+    }
+
+    std::optional<std::filesystem::file_time_type> MonitorAssignmentStore::getLastWriteTime () {
+
+        std::error_code errorCode = {};     // Receives any errors raised while checking the Monitor Assignments File.
+        std::filesystem::file_time_type lastWriteTime = {};
+
+        // The Monitor Assignments File is never read from in Stateless Mode.
+        if (programSettings.statelessMode)
+            return std::nullopt;
+
+        lastWriteTime = std::filesystem::last_write_time(ASSIGNMENTS_FILE_PATH, errorCode);
+        return ( errorCode ? std::nullopt : std::make_optional(lastWriteTime) );
+
+    }
+
+    // Serialization & Persistence to File
+
+    MonitorAssignmentStore::MonitorAssignmentMap MonitorAssignmentStore::fetchFromFile () {
+
+        MonitorAssignmentMap assignments = {};      // The saved Monitor Assignments.
+
+        // Don't read the Monitor Assignments File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return assignments;
+
+        std::wistringstream fileStream(             // The Stream used to read the Monitor Assignments File.
+            UTILS_NAMESPACE::readTextFile(ASSIGNMENTS_FILE_PATH).value_or(L"")
+        );
+        std::wstring currentLine = {};              // Contains the Current Line from the Monitor Assignments File.
+
+        // Each line contains the Stable Identity of the Display Monitor, followed by
+        // a Tab and the path to the Terraria Configuration File it is assigned to.
+        while ( std::getline(fileStream, currentLine) ) {
+            size_t separatorPos = currentLine.find(L'\t');  // The position of the Tab separating the fields.
+
+            if ( separatorPos != std::wstring::npos && separatorPos + 1ULL < currentLine.size() )
+                assignments[currentLine.substr(separatorPos + 1ULL)] = currentLine.substr(0ULL, separatorPos);
+        }
+
+        return assignments;
+
+    }
+
+    bool MonitorAssignmentStore::saveToFile ( const MonitorAssignmentMap& assignments ) {
+
+        // Don't modify the Monitor Assignments File in Stateless Mode.
+        if (programSettings.statelessMode)
+            return true;
+
+        // The contents of the Monitor Assignments File.
+        std::wstring contents = {};
+
+        for ( const auto& [filePath, stableId] : assignments ) {
+            if ( !contents.empty() )
+                contents.push_back(L'\n');
+
+            contents.append(stableId).append(L"\t").append(filePath);
+        }
+
+        if ( !ensureProgramDataDirectoryExists(nullptr) )
+            return false;
+
+        return UTILS_NAMESPACE::writeFileAtomically( ASSIGNMENTS_FILE_PATH, UTILS_NAMESPACE::wideStringToUtf8(contents) );
+
+    }
+
+    bool MonitorAssignmentStore::deleteSavedData () {
+
+        // Don't modify the Monitor Assignments File in Stateless Mode.
+        if ( programSettings.statelessMode || !std::filesystem::exists(ASSIGNMENTS_FILE_PATH) )
+            return true;
+
+        return std::filesystem::remove(ASSIGNMENTS_FILE_PATH);
+
+    }
+
+
+    /* Watch Mode Functions */
+
+    int runWatchMode ( const std::vector<std::wstring>& configPathPatterns ) {
+
+        using namespace std::chrono_literals;
+
+        // The `Console` used to report each correction.
+        Console::console_ptr_t console = Console::getConsole();
+        // Listens for changes to the Display Topology, which are waited on instead of polled.
+        DisplayChangeListener displayChangeListener = {};
+        // The Monitor Assignments of each known Terraria Configuration File, which are read again before they are used.
+        MonitorAssignmentStore::MonitorAssignmentMap assignments = {};
+        // The time the Monitor Assignments File was last modified when the `assignments` were read from it.
+        std::optional<std::filesystem::file_time_type> assignmentsWriteTime = {};
+        // The keys of the Terraria Configuration Files from the Configuration Path History and the `configPathPatterns`,
+        // which may not have a Monitor Assignment yet.
+        std::vector<std::wstring> knownFileKeys = {};
+        // The Connected Display Monitors of the Current Display Topology.
+        std::optional<DisplayMonitorList> displayMonitors = getDisplayMonitors();
+        // The Active Display Monitor of each known Terraria Configuration File, as last parsed for the Control Pipe.
+        std::map<std::wstring, ParsedConfigFile> parsedConfigFiles = {};
+        // The key of the most recently used Terraria Configuration File, which is used by Control Pipe requests without a path.
+        std::wstring mostRecentFileKey = {};
+
+        /**
+         * A lambda function used to add a known Terraria Configuration File that may not have a Monitor Assignment.
+         *
+         * @param filePath  The path to the Terraria Configuration File.
+         */
+        auto addKnownFile = [&knownFileKeys] ( const std::wstring& filePath ) {
+
+            std::wstring key = getAssignmentKey(filePath);  // The key of the Terraria Configuration File.
+
+            if ( std::find(knownFileKeys.begin(), knownFileKeys.end(), key) == knownFileKeys.end() )
+                knownFileKeys.push_back( std::move(key) );
+
+        };
+
+        /**
+         * A lambda function used to read the Monitor Assignments again, as choosing another Display Monitor
+         * interactively while Watch Mode is running replaces the Monitor Assignment of that Terraria Configuration File.
+         *
+         * The current Active Display Monitor is then assigned to any known Terraria Configuration Files
+         * that still do not have a Monitor Assignment. In Stateless Mode, the Monitor Assignments are never
+         * saved to the Monitor Assignments File, so only those already in memory are used.
+         */
+        auto refreshAssignments = [&assignments, &assignmentsWriteTime, &knownFileKeys, &displayMonitors] () {
+
+            // The Connected Display Monitors, indexed by their Display IDs, which are only indexed if a Terraria Configuration File is unassigned.
+            std::optional<DisplayMonitorRegistry> monitorRegistry = {};
+
+            if (!programSettings.statelessMode)
+                assignments = MonitorAssignmentStore::fetchFromFile();
+
+            for ( const std::wstring& key : knownFileKeys ) {
+                if ( assignments.contains(key) )
+                    continue;
+
+                if (!monitorRegistry)
+                    monitorRegistry.emplace(*displayMonitors);
+
+                // The Handle of the Active Display Monitor in the unassigned Terraria Configuration File,
+                // which is only read if it has changed since it was last cached.
+                std::optional<DisplayMonitorRegistry::monitor_handle_t> activeMonitorHandle = getActiveMonitorFromConfigFile(
+                    key, *monitorRegistry
+                );
+
+                if (activeMonitorHandle) {
+                    assignments[key] = (*monitorRegistry)[*activeMonitorHandle].getStableId();
+                    MonitorAssignmentStore::assignMonitor(key, (*monitorRegistry)[*activeMonitorHandle]);
+                }
+            }
+
+            // Includes any Monitor Assignments that were just saved.
+            assignmentsWriteTime = MonitorAssignmentStore::getLastWriteTime();
+
+        };
+
+        /**
+         * A lambda function used to set the assigned Display Monitor of each known Terraria Configuration File
+         * as its Active Display Monitor wherever its Display ID no longer matches.
+         */
+        auto correctConfigFiles = [&console, &assignments, &displayMonitors] () {
+
+            for ( const auto& [filePath, stableId] : assignments ) {
+                // The Connected Display Monitor with the assigned Stable Identity, if it is still connected.
+                auto monitorItr = findMonitorByStableId(*displayMonitors, stableId);
+                ConfigurationFile configFile = { filePath };    // The Terraria Configuration File being corrected.
+                ChangedValuesMap fileChangedValues = {};        // The Modified Configuration Properties, which are only reported.
+
+                if ( monitorItr == displayMonitors->end() || !configFile.isOpen() || configFile.getActiveDisplayId() == monitorItr->displayId )
+                    continue;
+
+                if ( setActiveMonitorInConfigFile(configFile, *monitorItr, fileChangedValues) ) {
+                    console->printfln(
+                        L"[{:%H:%M:%S}] {:s} {:s} ({:s}) as the Active Display Monitor in {:s}",
+                        std::chrono::floor<std::chrono::seconds>( std::chrono::system_clock::now() ),
+                        ( programSettings.dryRun ? L"Would set" : L"Set" ),
+                        monitorItr->monitorName,
+                        monitorItr->displayId,
+                        filePath
+                    );
+                }
+                else {
+                    console->err().printfln(L"Failed to modify {:s}", filePath);
+                }
+            }
+
+            // Return the memory used while processing the change, as Watch Mode spends almost all of its time idle.
+            SetProcessWorkingSetSize(GetCurrentProcess(), (SIZE_T) -1, (SIZE_T) -1);
+
+        };
+
+        /**
+         * A lambda function used to get the Active Display Monitor of a known Terraria Configuration File,
+         * which is only parsed again once the Terraria Configuration File has been modified.
+         *
+         * @param key   The key of the Terraria Configuration File, as returned by `getAssignmentKey()`.
+         *
+         * @returns     A pointer to the `ParsedConfigFile`, or `nullptr` if the Terraria Configuration File could not be read.
+         */
+        auto getParsedConfigFile = [&parsedConfigFiles] ( const std::wstring& key ) -> const ParsedConfigFile* {
+
+            std::error_code errorCode = {};     // Receives any errors raised while checking the Terraria Configuration File.
+            std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(key, errorCode);
+            auto parsedItr = parsedConfigFiles.find(key);
+
+            if (errorCode)
+                return nullptr;
+
+            if ( parsedItr == parsedConfigFiles.end() || parsedItr->second.lastWriteTime != lastWriteTime ) {
+                ConfigurationFile configFile = { key };     // The Terraria Configuration File being parsed.
+
+                if ( !configFile.isOpen() )
+                    return nullptr;
+
+                parsedItr = parsedConfigFiles.insert_or_assign(key, ParsedConfigFile{ lastWriteTime, configFile.getActiveDisplayId() }).first;
+            }
+
+            return &parsedItr->second;
+
+        };
+
+        /**
+         * A lambda function used to answer each request made over the Control Pipe,
+         * entirely from the Connected Display Monitors and Monitor Assignments already in memory.
+         *
+         * The Monitor Assignments are read again first if the Monitor Assignments File has been modified,
+         * so that a request to apply the Monitor Assignment never reverts the most recent interactive choice.
+         *
+         * @param request   The request being answered.
+         *
+         * @returns         The response to the `request`.
+         */
+        auto handleControlRequest = [
+            &console, &assignments, &assignmentsWriteTime, &displayMonitors, &mostRecentFileKey, &getParsedConfigFile, &refreshAssignments
+        ] ( const ControlPipeServer::Request& request ) {
+
+            ControlPipeServer::Response response = {};  // The response to the `request`.
+            // The key of the requested Terraria Configuration File.
+            std::wstring key = ( request.configFilePath.empty() ? mostRecentFileKey : getAssignmentKey(request.configFilePath) );
+            const ParsedConfigFile* parsedConfigFile = nullptr;
+
+            // Checking the Last Write Time is far cheaper than reading the Monitor Assignments File for every request.
+            if ( displayMonitors && MonitorAssignmentStore::getLastWriteTime() != assignmentsWriteTime )
+                refreshAssignments();
+
+            // The Monitor Assignment of the requested Terraria Configuration File.
+            auto assignmentItr = assignments.find(key);
+
+            if ( assignmentItr == assignments.end() || !(parsedConfigFile = getParsedConfigFile(key)) ) {
+                response.status = ControlPipeServer::ResponseStatus::UNKNOWN_CONFIG_FILE;
+                return response;
+            }
+            // The Connected Display Monitors are missing if they could not be retrieved again after the Display Topology changed.
+            else if (!displayMonitors) {
+                response.status = ControlPipeServer::ResponseStatus::MONITOR_NOT_CONNECTED;
+                return response;
+            }
+
+            // The Connected Display Monitor currently set as the Active Display Monitor, if it is connected.
+            DisplayMonitorList::const_iterator activeMonitorItr = std::find_if(
+                displayMonitors->cbegin(),
+                displayMonitors->cend(),
+                [parsedConfigFile] ( const DisplayMonitor& monitor ) { return monitor.displayId == parsedConfigFile->activeDisplayId; }
+            );
+            // The Connected Display Monitor with the assigned Stable Identity, if it is still connected.
+            DisplayMonitorList::const_iterator assignedMonitorItr = findMonitorByStableId(*displayMonitors, assignmentItr->second);
+
+            if (request.type == ControlPipeServer::RequestType::APPLY_ASSIGNMENT) {
+                if ( assignedMonitorItr == displayMonitors->end() ) {
+                    response.status = ControlPipeServer::ResponseStatus::MONITOR_NOT_CONNECTED;
+                    return response;
+                }
+
+                if (activeMonitorItr != assignedMonitorItr) {
+                    ConfigurationFile configFile = { key };     // The Terraria Configuration File being corrected.
+                    ChangedValuesMap fileChangedValues = {};    // The Modified Configuration Properties, which are only reported.
+
+                    if ( !setActiveMonitorInConfigFile(configFile, *assignedMonitorItr, fileChangedValues) ) {
+                        response.status = ControlPipeServer::ResponseStatus::MODIFICATION_FAILED;
+                        return response;
+                    }
+
+                    console->printfln(
+                        L"[{:%H:%M:%S}] {:s} {:s} ({:s}) as the Active Display Monitor in {:s} via the Control Pipe",
+                        std::chrono::floor<std::chrono::seconds>( std::chrono::system_clock::now() ),
+                        ( programSettings.dryRun ? L"Would set" : L"Set" ),
+                        assignedMonitorItr->monitorName,
+                        assignedMonitorItr->displayId,
+                        key
+                    );
+                    response.flags |= ControlPipeServer::ResponseFlags::FILE_MODIFIED;
+                }
+
+                activeMonitorItr = assignedMonitorItr;
+            }
+
+            if ( activeMonitorItr == displayMonitors->end() ) {
+                response.status = ControlPipeServer::ResponseStatus::MONITOR_NOT_CONNECTED;
+                return response;
+            }
+
+            if (activeMonitorItr == assignedMonitorItr)
+                response.flags |= ControlPipeServer::ResponseFlags::ASSIGNED_MONITOR;
+
+            response.monitor = *activeMonitorItr;
+            return response;
+
+        };
+
+        if ( displayMonitors == std::nullopt ) {
+            console->err().print(L"Failed to retrieve the Connected Display Monitors from the Windows API.");
+            return ProgramStatusCode::DISPLAY_MONITOR_QUERY_FAILURE;
+        }
+        else if ( displayChangeListener.getDisplayChangeEvent() == NULL ) {
+            console->err().print(L"Failed to listen for changes to the Display Topology via the Windows API.");
+            return ProgramStatusCode::DISPLAY_MONITOR_QUERY_FAILURE;
+        }
+
+        // The Configuration Path History only contains the directory of each Terraria Configuration File.
+        for ( const std::filesystem::path& dirPath : UserInterface::ConfigurationPathHistory::fetchFromFile() ) {
+            std::wstring filePath = ( dirPath / CONFIG_FILE_NAME ).wstring();   // The path to the Terraria Configuration File.
+
+            if ( mostRecentFileKey.empty() )
+                mostRecentFileKey = getAssignmentKey(filePath);
+
+            addKnownFile(filePath);
+        }
+
+        for ( const std::wstring& pattern : configPathPatterns ) {
+            for ( const std::wstring& filePath : UTILS_NAMESPACE::expandPathPattern(pattern) )
+                addKnownFile(filePath);
+        }
+
+        refreshAssignments();
+
+        if ( assignments.empty() ) {
+            console->err().print(L"No Terraria Configuration Files with a known Active Display Monitor were found to watch.");
+            return ProgramStatusCode::INVALID_ARGUMENTS;
+        }
+
+        // Answers queries and requests from other programs, such as game launchers, on this thread.
+        ControlPipeServer controlPipe = { handleControlRequest };
+
+        // Requests without a path fall back on the first watched Terraria Configuration File instead.
+        if ( mostRecentFileKey.empty() || !assignments.contains(mostRecentFileKey) )
+            mostRecentFileKey = assignments.begin()->first;
+
+        console->printfln(L"Watching {:d} Terraria Configuration File(s) for changes to the Display Topology.", assignments.size());
+
+        if ( controlPipe.isListening() )
+            console->printfln(L"Answering requests over {:s}.", ControlPipeServer::PIPE_NAME);
+        else
+            console->err().println(L"The Control Pipe is already in use by another process, so no requests will be answered.");
+
+        console->println(L"Press CTRL + C to stop.");
+
+        correctConfigFiles();
+
+        // The objects being waited on, which include the Event Object signaled whenever output is posted to the `console`,
+        // followed by the Event of each Pipe Instance of the `controlPipe`.
+        std::vector<HANDLE> waitHandles = { displayChangeListener.getDisplayChangeEvent() };
+        // The position of the first Event of the `controlPipe` within the `waitHandles`.
+        size_t controlPipeEventPos = 0ULL;
+        // The result of waiting on the `waitHandles`.
+        DWORD waitResult = WAIT_FAILED;
+        // The time at which the Display Topology is considered to have settled, which is empty unless a change is pending.
+        std::optional<std::chrono::steady_clock::time_point> settleDeadline = {};
+
+        if ( console->getPostedOutputEvent() != NULL )
+            waitHandles.push_back( console->getPostedOutputEvent() );
+
+        controlPipeEventPos = waitHandles.size();
+        waitHandles.insert( waitHandles.end(), controlPipe.getEventHandles().begin(), controlPipe.getEventHandles().end() );
+
+        while (true) {
+            // The time at which the `waitHandles` are about to be waited on again.
+            std::chrono::steady_clock::time_point currentTime = std::chrono::steady_clock::now();
+            // The number of milliseconds remaining until the `settleDeadline`, if any.
+            DWORD waitTimeout = INFINITE;
+
+            // Correct the Terraria Configuration Files once the Display Topology has settled,
+            // even if the Control Pipe has been kept busy the entire time.
+            if ( settleDeadline && currentTime >= *settleDeadline ) {
+                settleDeadline.reset();
+
+                // Also invalidates the `DisplayTopologyCache`.
+                displayChangeListener.consumeDisplayChange();
+
+                if ( (displayMonitors = getDisplayMonitors(false)) ) {
+                    refreshAssignments();
+                    correctConfigFiles();
+                }
+            }
+            else if (settleDeadline) {
+                waitTimeout = (DWORD) std::chrono::ceil<std::chrono::milliseconds>(*settleDeadline - currentTime).count();
+            }
+
+            waitResult = WaitForMultipleObjects( (DWORD) waitHandles.size(), waitHandles.data(), FALSE, waitTimeout );
+
+            if (waitResult == WAIT_TIMEOUT)
+                continue;
+            else if ( waitResult >= (WAIT_OBJECT_0 + waitHandles.size()) )
+                break;
+
+            // The position of the signaled object within the `waitHandles`.
+            size_t handlePos = (size_t) (waitResult - WAIT_OBJECT_0);
+
+            // Continue serving the Pipe Instance, which never blocks.
+            if (handlePos >= controlPipeEventPos) {
+                controlPipe.processEvent(handlePos - controlPipeEventPos);
+                continue;
+            }
+            // Print any output posted by Background Threads without waiting for the Display Topology to change.
+            else if (handlePos > 0ULL) {
+                console->flushPostedOutput();
+                continue;
+            }
+
+            // Windows typically broadcasts several changes in a row while the Display Topology settles,
+            // so wait until no further changes have been broadcast for a short time, while still serving the Control Pipe.
+            settleDeadline = currentTime + 1500ms;
+        }
+
+        return ProgramStatusCode::DISPLAY_MONITOR_QUERY_FAILURE;
+
+    }
+
+
+
+    /* Apply-Last Mode Functions */
+
+    int applyMonitorAssignment ( ConfigurationFile& configFile, const std::wstring& stableId, _Out_ ChangedValuesMap& oChangedValues ) {
+
+        // Times the entire restoration of the Monitor Assignment.
+        ScopedTraceTimer traceTimer = { "applyMonitorAssignment", "config", configFile.getFilePath() };
+        // The error message returned by the Windows API if the Connected Display Monitors could not be retrieved.
+        std::optional<std::wstring> displayMonitorsError = {};
+        // The Connected Display Monitors, which are usually loaded from the `DisplayTopologyCache`.
+        std::optional<DisplayMonitorList> displayMonitors = getDisplayMonitors(true, &displayMonitorsError);
+
+        if (!displayMonitors) {
+            if (displayMonitorsError)
+                std::wcerr << *displayMonitorsError << L'\n';
+
+            std::wcerr << L"Failed to retrieve the Connected Display Monitors from the Windows API." << std::endl;
+            return ProgramStatusCode::DISPLAY_MONITOR_QUERY_FAILURE;
+        }
+
+        // The Connected Display Monitor with the assigned Stable Identity, if it is still connected.
+        auto monitorItr = findMonitorByStableId(*displayMonitors, stableId);
+
+        if ( monitorItr == displayMonitors->end() ) {
+            std::wcerr << L"The Display Monitor assigned to " << configFile.getFilePath() << L" is no longer connected." << std::endl;
+            return ProgramStatusCode::APPLY_LAST_FAILURE;
+        }
+        else if ( !setActiveMonitorInConfigFile(configFile, *monitorItr, oChangedValues) ) {
+            std::wcerr << L"Failed to modify " << configFile.getFilePath() << std::endl;
+            return ProgramStatusCode::APPLY_LAST_FAILURE;
+        }
+
+        return ProgramStatusCode::SUCCESS;
+
+    }
+
+    int runApplyLastMode () {
+
+        // The paths and names of Display Monitors printed below may contain any characters.
+        UTILS_NAMESPACE::useUtf16StandardStreams();
+
+        // The Configuration Path History, whose first path is the most recently used Terraria Configuration File.
+        UserInterface::ConfigurationPathHistory pathHistory = UserInterface::ConfigurationPathHistory::fetchFromFile();
+        // The Stable Identity of the Display Monitor assigned to the most recently used Terraria Configuration File.
+        std::optional<std::wstring> stableId = {};
+        // The Modified Configuration Properties, which are printed once the Monitor Assignment has been restored.
+        ChangedValuesMap changedValues = {};
+        // The result of restoring the Monitor Assignment.
+        int statusCode = ProgramStatusCode::SUCCESS;
+
+        if ( pathHistory.empty() ) {
+            std::wcerr << L"No Terraria Configuration File has been used yet." << std::endl;
+            return ProgramStatusCode::APPLY_LAST_FAILURE;
+        }
+
+        // The path to the most recently used Terraria Configuration File, as the Configuration Path History only contains its directory.
+        std::wstring filePath = ( *pathHistory.begin() / CONFIG_FILE_NAME ).wstring();
+
+        if ( !(stableId = MonitorAssignmentStore::getAssignedMonitor(filePath)) ) {
+            std::wcerr << L"No Display Monitor has been assigned to " << filePath << L" yet." << std::endl;
+            return ProgramStatusCode::APPLY_LAST_FAILURE;
+        }
+
+        // The most recently used Terraria Configuration File.
+        ConfigurationFile configFile = { filePath };
+
+        if ( !configFile.isOpen() ) {
+            std::wcerr << L"Failed to open " << filePath << std::endl;
+            return ProgramStatusCode::APPLY_LAST_FAILURE;
+        }
+
+        if ( (statusCode = applyMonitorAssignment(configFile, *stableId, changedValues)) != ProgramStatusCode::SUCCESS )
+            return statusCode;
+
+        // The Terraria Configuration File is never written to during a Dry Run, so it still contains the unmodified contents.
+        if ( programSettings.dryRun && !changedValues.empty() ) {
+            // The unmodified Terraria Configuration File.
+            ConfigurationFile unmodifiedFile = { filePath };
+
+            writeConfigFileDiff(
+                unmodifiedFile.getContents(),
+                configFile.getContents(),
+                programSettings.dryRunContextLines,
+                filePath,
+                filePath + L" (Dry Run)",
+                [] ( const std::wstring& line ) { std::wcout << line << L'\n'; }
+            );
+        }
+
+        if ( !changedValues.empty() ) {
+            std::wcout << L"Changes were made to " << filePath << L':';
+
+            for ( const auto& [key, values] : changedValues )
+                std::wcout << std::format(L"\n   + {:14s} {:s} --> {:s}", key + L":", values.first, values.second);
+
+            std::wcout << std::endl;
+        }
+        else {
+            std::wcout << L"No changes were made to " << filePath << L'.' << std::endl;
+        }
+
+        return ProgramStatusCode::SUCCESS;
+
+    }
+
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+
+/*
+* WatchMode.h
+*
+* Header File defining the `MonitorAssignmentStore` class, which remembers the Display Monitor
+* assigned to each Terraria Configuration File by its Stable Identity, as well as the functions
+* used to run Watch Mode, which keeps those assignments correct as the Display Topology changes,
+* and Apply-Last Mode, which restores the assignment of the most recently used file once.
+*/
+
+
+#include "ConfigurationFile.h"
+#include "DisplayTopology.h"
+
+#include <map>
+
+
+namespace PROGRAM_NAMESPACE {
+
+	/**
+	 * A class providing a persistent store of the Display Monitor assigned to each Terraria Configuration File.
+	 *
+	 * Display Monitors are stored by their Stable Identity (see `DisplayMonitor::getStableId()`) rather
+	 * than their Display ID, as the Display ID is exactly what Windows reassigns when the
+	 * Display Topology changes.
+	 */
+	class MonitorAssignmentStore {
+
+		/* Type Definitions */
+		public:
+			// A Map of the absolute paths to Terraria Configuration Files to the Stable Identity of their assigned Display Monitor.
+			typedef std::map<std::wstring, std::wstring> MonitorAssignmentMap;
+
+
+		/* Class Constants */
+		protected:
+			static const std::wstring ASSIGNMENTS_FILE_NAME;			// The name of the file used to store the Monitor Assignments.
+			static const std::filesystem::path ASSIGNMENTS_FILE_PATH;	// The path to the file used to store the Monitor Assignments.
+
+
+		/* Static Methods */
+		public:
+			/**
+			 * Assign the specified Display Monitor to a Terraria Configuration File,
+			 * replacing any Display Monitor previously assigned to it.
+			 *
+			 * @param filePath	The path to the Terraria Configuration File.
+			 * @param monitor	The Display Monitor that was set as the Active Display Monitor in the Terraria Configuration File.
+			 *
+			 * @returns			`true` on success and `false` on failure.
+			 */
+			static bool assignMonitor ( const std::wstring& filePath, const DisplayMonitor& monitor );
+			/**
+			 * Assign the Display Monitor with the specified Stable Identity to a Terraria Configuration File,
+			 * replacing any Display Monitor previously assigned to it.
+			 *
+			 * @param filePath	The path to the Terraria Configuration File.
+			 * @param stableId	The Stable Identity of the Display Monitor, as returned by `DisplayMonitor::getStableId()`.
+			 *
+			 * @returns			`true` on success and `false` on failure.
+			 */
+			static bool assignMonitor ( const std::wstring& filePath, const std::wstring& stableId );
+			/**
+			 * Get the Stable Identity of the Display Monitor assigned to a Terraria Configuration File.
+			 *
+			 * @param filePath	The path to the Terraria Configuration File.
+			 *
+			 * @returns			An `std::optional` containing the Stable Identity of the assigned Display Monitor,
+			 * 					which is empty if no Display Monitor has been assigned to the Terraria Configuration File.
+			 */
+			static std::optional<std::wstring> getAssignedMonitor ( const std::wstring& filePath );
+			/**
+			 * Get the time the Monitor Assignments File was last modified, which changes whenever any Monitor Assignment does.
+			 *
+			 * @returns		An `std::optional` containing the Last Write Time of the Monitor Assignments File,
+			 * 				which is empty if it does not exist or in Stateless Mode.
+			 */
+			static std::optional<std::filesystem::file_time_type> getLastWriteTime ();
+
+
+		/* Serialization & Persistence to File */
+		public:
+			/**
+			 * Fetch the Monitor Assignments from the Monitor Assignments File.
+			 *
+			 * The Monitor Assignments are stored in a file located at `ASSIGNMENTS_FILE_PATH`,
+			 * and are never read from in Stateless Mode.
+			 *
+			 * @returns		A `MonitorAssignmentMap` containing the saved Monitor Assignments,
+			 * 				which is empty if the Monitor Assignments File does not exist.
+			 */
+			static MonitorAssignmentMap fetchFromFile ();
+
+			/**
+			 * Save the specified Monitor Assignments to the Monitor Assignments File.
+			 *
+			 * The Monitor Assignments are stored in a file located at `ASSIGNMENTS_FILE_PATH`,
+			 * and are never written to in Stateless Mode.
+			 *
+			 * @param assignments	The Monitor Assignments being saved.
+			 *
+			 * @returns				`true` on success and `false` on failure.
+			 */
+			static bool saveToFile ( const MonitorAssignmentMap& assignments );
+			/**
+			 * Delete the Monitor Assignments File.
+			 *
+			 * @returns		`true` if the Monitor Assignments File was successfully
+			 * 				deleted or does not currently exist, otherwise `false`.
+			 */
+			static bool deleteSavedData ();
+
+	};
+
+
+	/* Watch Mode Functions */
+
+	/**
+	 * Run the program in Watch Mode until it is terminated using `CTRL + C`.
+	 *
+	 * Watch Mode waits for the Display Topology to change without polling, and then
+	 * sets the assigned Display Monitor of each known Terraria Configuration File as its
+	 * Active Display Monitor again, under whatever Display ID Windows has given it.
+	 *
+	 * The known Terraria Configuration Files are those with a Monitor Assignment, those in the
+	 * Configuration Path History, and those specified by the `configPathPatterns`. The Monitor Assignments are
+	 * read again before each correction, so that choosing another Display Monitor interactively while Watch Mode
+	 * is running is never reverted, and files still without a Monitor Assignment are assigned their current
+	 * Active Display Monitor at that time.
+	 *
+	 * Requests made over the Control Pipe (see `ControlPipeServer`) are answered on the same thread,
+	 * using the Connected Display Monitors and Monitor Assignments already known to Watch Mode, which are only
+	 * read again first if the Monitor Assignments File has been modified since.
+	 *
+	 * @param configPathPatterns	The paths to any additional Terraria Configuration Files,
+	 * 								each of which may contain the Wildcard Patterns accepted by `expandPathPattern()`.
+	 *
+	 * @returns						The `ProgramStatusCode` to be returned by the program if Watch Mode
+	 * 								could not be started. Otherwise, Watch Mode does not return.
+	 */
+	int runWatchMode ( const std::vector<std::wstring>& configPathPatterns );
+
+
+	/* Apply-Last Mode Functions */
+
+	/**
+	 * Set the Display Monitor with the specified Stable Identity as the Active Display Monitor
+	 * in a Terraria Configuration File, without using the `Console`.
+	 *
+	 * The Connected Display Monitors are loaded from the `DisplayTopologyCache` unless the Display Topology
+	 * has changed, and the Terraria Configuration File is only written to if its Active Display Monitor or
+	 * Display Resolution actually differ. Any errors are printed to the Standard Error Stream.
+	 *
+	 * @param configFile		The `ConfigurationFile` for the Terraria Configuration File.
+	 * @param stableId			The Stable Identity of the Display Monitor, as returned by `DisplayMonitor::getStableId()`.
+	 * @param oChangedValues	The `ChangedValuesMap` updated with the Modified Configuration Properties,
+	 * 							which remains empty if the Terraria Configuration File was left unchanged.
+	 *
+	 * @returns					The `ProgramStatusCode` to be returned by the program.
+	 */
+	int applyMonitorAssignment ( ConfigurationFile& configFile, const std::wstring& stableId, _Out_ ChangedValuesMap& oChangedValues );
+
+	/**
+	 * Run the program in Apply-Last Mode (`--apply-last`), setting the Display Monitor assigned to the
+	 * most recently used Terraria Configuration File as its Active Display Monitor again, and then exiting.
+	 *
+	 * Apply-Last Mode is meant to be run from Windows Shortcuts and Login Scripts, so neither the `Console`
+	 * nor the `UserInterface` are ever created. The result is printed to the Standard Output Stream instead,
+	 * along with the Unified Diff of the changes when performing a Dry Run.
+	 *
+	 * @returns		The `ProgramStatusCode` to be returned by the program.
+	 */
+	int runApplyLastMode ();
+
+}
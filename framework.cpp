@@ -6,6 +6,16 @@
 
 
 #include "framework.h"
+#include "Tracing.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>  // _O_U16TEXT
+#include <io.h>     // _setmode()
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#endif
 
 
 namespace PROGRAM_NAMESPACE {
@@ -15,107 +25,576 @@ namespace PROGRAM_NAMESPACE {
 
         // String Functions
 
-        std::wstring stringToLowercase ( const std::wstring& str ) {
+        /**
+         * Convert the case of all of the applicable characters of a Wide-Character String.
+         * 
+         * On x86 and x64, runs of ASCII characters are converted eight at a time using SSE2,
+         * while all other characters are passed to `std::towlower()` or `std::towupper()`.
+         * 
+         * @param str           The Wide-Character String being converted.
+         * @param toUppercase   `true` if the `str` is being converted to uppercase,
+         *                      or `false` if it is being converted to lowercase.
+         * @param oConvStr      The buffer whose contents are replaced by the converted string.
+         */
+        static void convertStringCase ( std::wstring_view str, bool toUppercase, _Out_ std::wstring& oConvStr ) {
+
+            size_t strPos = 0ULL;   // Our current position in the `str`.
+
+            oConvStr.resize( str.length() );
+
+#if ( defined(_M_X64) || defined(_M_IX86) ) && WCHAR_MAX == 0xFFFF
+            const __m128i nonAsciiMask = _mm_set1_epi16( (short) 0xFF80 );                         // Matches the bits set by any Non-ASCII Character.
+            const __m128i rangeStart = _mm_set1_epi16( toUppercase ? (L'a' - 1) : (L'A' - 1) );    // The character preceding the range being converted.
+            const __m128i rangeEnd = _mm_set1_epi16( toUppercase ? (L'z' + 1) : (L'Z' + 1) );      // The character following the range being converted.
+            const __m128i caseBit = _mm_set1_epi16(0x20);                                          // The bit distinguishing the case of an ASCII Letter.
+
+            for ( ; strPos + 8ULL <= str.length(); strPos += 8ULL ) {
+                __m128i chars = _mm_loadu_si128( (const __m128i*) &str[strPos] );                  // The next eight characters of the `str`.
+
+                // Leave any block containing a Non-ASCII Character to the scalar loop below.
+                if ( _mm_movemask_epi8( _mm_cmpeq_epi16(_mm_and_si128(chars, nonAsciiMask), _mm_setzero_si128()) ) != 0xFFFF )
+                    break;
 
-            std::wstring lcStr = {};
+                // The characters within the range being converted.
+                __m128i inRange = _mm_and_si128( _mm_cmpgt_epi16(chars, rangeStart), _mm_cmplt_epi16(chars, rangeEnd) );
+
+                _mm_storeu_si128( (__m128i*) &oConvStr[strPos], _mm_xor_si128(chars, _mm_and_si128(inRange, caseBit)) );
+            }
+#endif
+
+            for ( ; strPos < str.length(); strPos++ ) {
+                wchar_t ch = str[strPos];   // The current Wide Character being converted.
+
+                if (ch < 0x80)
+                    oConvStr[strPos] = ( (toUppercase ? (ch >= L'a' && ch <= L'z') : (ch >= L'A' && ch <= L'Z')) ? (ch ^ 0x20) : ch );
+                else
+                    oConvStr[strPos] = (wchar_t) ( toUppercase ? std::towupper(ch) : std::towlower(ch) );
+            }
+
+        }
+        /**
+         * Determine if the specified Wide Character is considered to be whitespace by `std::iswspace()`.
+         * 
+         * @param ch    The Wide Character being evaluated.
+         * 
+         * @returns     `true` if the `ch` is a whitespace character, otherwise `false`.
+         */
+        static bool isWhitespaceChar ( wchar_t ch ) {
+
+            // ASCII Characters are classified without consulting the Current Locale.
+            if (ch < 0x80)
+                return ( ch == L' ' || (ch >= L'\t' && ch <= L'\r') );
+
+            return std::iswspace(ch);
+
+        }
+
+        void stringToLowercase ( std::wstring_view str, _Out_ std::wstring& oLcStr ) {
 
-            for ( const wchar_t& ch : str )
-                lcStr.push_back( std::towlower(ch) );
+            convertStringCase(str, false, oLcStr);
+
+        }
+        std::wstring stringToLowercase ( std::wstring_view str ) {
 
+            std::wstring lcStr = {};
+
+            convertStringCase(str, false, lcStr);
             return lcStr;
 
         }
-        std::wstring stringToUppercase ( const std::wstring& str ) {
+        void stringToUppercase ( std::wstring_view str, _Out_ std::wstring& oUcStr ) {
 
-            std::wstring ucStr = {};
+            convertStringCase(str, true, oUcStr);
 
-            for ( const wchar_t& ch : str )
-                ucStr.push_back( std::towupper(ch) );
+        }
+        std::wstring stringToUppercase ( std::wstring_view str ) {
+
+            std::wstring ucStr = {};
 
+            convertStringCase(str, true, ucStr);
             return ucStr;
 
         }
 
-        std::wstring trimString ( const std::wstring& str ) {
+        std::wstring_view trimStringView ( std::wstring_view str ) {
+
+            size_t startPos = 0ULL;             // The position of the first character that is not whitespace.
+            size_t endPos = str.length();       // The position following the last character that is not whitespace.
 
-            std::wsmatch matches;
-            std::regex_match( str, matches, std::wregex(L"^\\s*(.+?)\\s*$") );
+            while ( startPos < endPos && isWhitespaceChar(str[startPos]) )
+                startPos++;
+            while ( endPos > startPos && isWhitespaceChar(str[endPos - 1ULL]) )
+                endPos--;
+
+            return str.substr(startPos, endPos - startPos);
+
+        }
+        std::wstring trimString ( std::wstring_view str ) {
 
-            // Return the match for the first Capture Group in the Regular Expression.
-            return matches[1];
+            return std::wstring( trimStringView(str) );
             
         }
-        std::wstring truncateString ( const std::wstring& str, size_t maxLength ) {
-        
-            if ( str.length() <= maxLength )
-                return str;
 
-            std::wstring truncStr = str.substr(0, maxLength - 3ULL);
-                         truncStr.append(L"...");
+        void truncateString ( std::wstring_view str, size_t maxLength, _Out_ std::wstring& oTruncStr ) {
+
+            if ( str.length() <= maxLength ) {
+                oTruncStr.assign(str);
+                return;
+            }
+
+            oTruncStr.assign( str.substr(0ULL, (maxLength > 3ULL ? maxLength - 3ULL : 0ULL)) )
+                     .append(L"...");
+
+        }
+        std::wstring truncateString ( std::wstring_view str, size_t maxLength ) {
+        
+            std::wstring truncStr = {};
 
+            truncateString(str, maxLength, truncStr);
             return truncStr;
         
         }
-        std::wstring truncatePathString ( const std::wstring& str, size_t maxLength ) {
+        void truncatePathString ( std::wstring_view pathStr, size_t maxLength, _Out_ std::wstring& oTruncStr ) {
 
-            if ( str.length() <= maxLength )
-                return str;
+            // The Path Separator Characters.
+            static constexpr std::wstring_view PATH_SEPARATORS = L"\\/";
 
-            std::wstring truncStr = str;
-            size_t index = 0ULL;
+            if ( pathStr.length() <= maxLength ) {
+                oTruncStr.assign(pathStr);
+                return;
+            }
 
-            // Start the truncation after the first Path Segment in the Path String.
-            while ( index < truncStr.length() && truncStr[index] != L'\\' && truncStr[index] != L'/' ) {
-                index++;
+            // The position of the first Path Separator in the Path String.
+            size_t firstSeparatorPos = pathStr.find_first_of(PATH_SEPARATORS);
+
+            // Start the truncation after the first Path Segment in the Path String, and find the first
+            // Path Separator after which the remainder of the Path String fits in the `maxLength`.
+            if ( firstSeparatorPos != std::wstring_view::npos ) {
+                size_t truncStartPos = (firstSeparatorPos + 1ULL);     // The position of the first truncated character.
+
+                for (
+                    size_t separatorPos = pathStr.find_first_of(PATH_SEPARATORS, truncStartPos + 1ULL);
+                    separatorPos != std::wstring_view::npos;
+                    separatorPos = pathStr.find_first_of(PATH_SEPARATORS, separatorPos + 1ULL)
+                ) {
+                    if ( pathStr.length() - (separatorPos - truncStartPos) <= (maxLength - 3ULL) ) {
+                        oTruncStr.assign( pathStr.substr(0ULL, truncStartPos) )
+                                 .append(L"...")
+                                 .append( pathStr.substr(separatorPos) );
+                        return;
+                    }
+                }
             }
 
-            index++;
+            // If we weren't able to truncate the Path String, we will return the
+            // truncated File or Directory Name instead.
+            size_t lastSeparatorPos = pathStr.find_last_of(PATH_SEPARATORS);
 
-            // Attempt to trim Path Segments from the Path String until the
-            // length of the Path String is less than `maxLength`.
-            while ( index < truncStr.length() ) {
-                truncStr.erase(index, 1);
+            oTruncStr.assign(L"...")
+                     .append( pathStr.substr(lastSeparatorPos != std::wstring_view::npos ? lastSeparatorPos + 1ULL : 0ULL) );
 
-                if ( (truncStr[index] == L'\\' || truncStr[index] == L'/') && truncStr.length() <= (maxLength - 3ULL) )
-                    break;
+        }
+        std::wstring truncatePathString ( std::wstring_view pathStr, size_t maxLength ) {
+
+            std::wstring truncStr = {};
+
+            truncatePathString(pathStr, maxLength, truncStr);
+            return truncStr;
+
+        }
+
+        std::wstring utf8ToWideString ( std::string_view str ) {
+
+            std::wstring wideStr = {};      // The converted Wide-Character String.
+            int wideStrLength = 0;          // The number of Wide Characters in the converted string.
+
+            if ( str.empty() )
+                return wideStr;
+
+            wideStrLength = MultiByteToWideChar(CP_UTF8, 0, str.data(), (int) str.size(), NULL, 0);
+
+            if (wideStrLength > 0) {
+                wideStr.resize(wideStrLength);
+                MultiByteToWideChar(CP_UTF8, 0, str.data(), (int) str.size(), wideStr.data(), wideStrLength);
             }
 
-            // If we were successfully able to truncate the Path String, 
-            // we just need to insert the ellipsis to indicate where the truncation occurred.
-            if ( index < truncStr.length() ) {
-                truncStr.insert(index, L"..."); 
+            return wideStr;
+
+        }
+        std::string wideStringToUtf8 ( std::wstring_view str ) {
+
+            std::string narrowStr = {};     // The converted Narrow-Character String.
+            int narrowStrLength = 0;        // The number of bytes in the converted string.
+
+            if ( str.empty() )
+                return narrowStr;
+
+            narrowStrLength = WideCharToMultiByte(CP_UTF8, 0, str.data(), (int) str.size(), NULL, 0, NULL, NULL);
+
+            if (narrowStrLength > 0) {
+                narrowStr.resize(narrowStrLength);
+                WideCharToMultiByte(CP_UTF8, 0, str.data(), (int) str.size(), narrowStr.data(), narrowStrLength, NULL, NULL);
             }
-            // If we weren't able to truncate the Path String, we will return the
-            // truncated File or Directory Name instead.
-            else {
-                wchar_t currentChar;
 
-                truncStr = L"...";
-                index = (str.length() - 1ULL);
+            return narrowStr;
 
-                while ( index >= 0ULL && (currentChar = str[index--]) != L'\\' && currentChar != L'/' )
-                    truncStr.insert(3ULL, 1ULL, currentChar);
+        }
+
+        std::wstring escapeJsonString ( std::wstring_view str ) {
+
+            std::wstring escapedStr = {};   // The escaped Wide-Character String.
+
+            escapedStr.reserve( str.size() );
+
+            for ( wchar_t ch : str ) {
+                switch (ch) {
+                    case L'"':  escapedStr.append(L"\\\""); break;
+                    case L'\\': escapedStr.append(L"\\\\"); break;
+                    case L'\n': escapedStr.append(L"\\n"); break;
+                    case L'\r': escapedStr.append(L"\\r"); break;
+                    case L'\t': escapedStr.append(L"\\t"); break;
+                    default: {
+                        if (ch < 0x20)
+                            escapedStr.append( std::format(L"\\u{:04x}", (unsigned int) ch) );
+                        else
+                            escapedStr.push_back(ch);
+                    }
+                }
             }
 
-            return truncStr;
+            return escapedStr;
+
+        }
+
+        bool matchesWildcardPattern ( std::wstring_view str, std::wstring_view pattern ) {
+
+            size_t strPos = 0ULL;                           // The position of the current character of the `str`.
+            size_t patternPos = 0ULL;                       // The position of the current character of the `pattern`.
+            size_t lastStarPos = std::wstring_view::npos;   // The position of the most recent `*` in the `pattern`.
+            size_t lastStarStrPos = 0ULL;                   // The position in the `str` that the most recent `*` currently extends to.
+
+            while ( strPos < str.size() ) {
+                if (
+                    patternPos < pattern.size()
+                    && (
+                           pattern[patternPos] == L'?'
+                        || std::towlower(pattern[patternPos]) == std::towlower(str[strPos])
+                    )
+                ) {
+                    strPos++;
+                    patternPos++;
+                }
+                else if ( patternPos < pattern.size() && pattern[patternPos] == L'*' ) {
+                    lastStarPos = patternPos++;
+                    lastStarStrPos = strPos;
+                }
+                // Backtrack, allowing the most recent `*` to match one more character.
+                else if (lastStarPos != std::wstring_view::npos) {
+                    patternPos = lastStarPos + 1ULL;
+                    strPos = ++lastStarStrPos;
+                }
+                else {
+                    return false;
+                }
+            }
+
+            while ( patternPos < pattern.size() && pattern[patternPos] == L'*' )
+                patternPos++;
+
+            return ( patternPos == pattern.size() );
 
         }
 
+
         // File Functions
 
-        std::optional<std::wstring> createTempFile () {
+        std::optional<std::wstring> readTextFile ( const std::filesystem::path& filePath ) {
+
+            MemoryMappedFile file = { filePath.wstring() };     // The file being read, mapped into memory.
+
+            if ( !file.isOpen() )
+                return {};
+
+            return utf8ToWideString( file.getContents() );
+
+        }
+
+        bool writeFileAtomically ( const std::filesystem::path& filePath, std::string_view contents ) {
+
+            // The path to the directory containing the file.
+            std::filesystem::path dirPath = ( filePath.has_parent_path() ? filePath.parent_path() : std::filesystem::path(L".") );
+            // A Null-Terminated Wide-Character String containing the path to the Temporary File.
+            WCHAR tempFile[MAX_PATH] = {};
+            // The handle to the Temporary File.
+            HANDLE fileHandle = INVALID_HANDLE_VALUE;
+            // The number of bytes actually written to the Temporary File.
+            DWORD bytesWritten = 0;
+            // Indicates if each step has succeeded so far.
+            bool success = false;
+
+            // The Temporary File is created in the same directory as the file,
+            // so that it is guaranteed to be on the same volume.
+            if ( contents.size() > MAXDWORD || GetTempFileNameW(dirPath.c_str(), L"tmt", 0, tempFile) == 0 )
+                return false;
+
+            fileHandle = CreateFileW(
+                tempFile,
+                GENERIC_WRITE,
+                0,
+                NULL,
+                CREATE_ALWAYS,
+                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_WRITE_THROUGH,
+                NULL
+            );
+
+            if (fileHandle != INVALID_HANDLE_VALUE) {
+                ScopedTraceTimer traceTimer = { "Write Temporary File", "io", filePath.wstring() };
+
+                success = (
+                       WriteFile(fileHandle, contents.data(), (DWORD) contents.size(), &bytesWritten, NULL)
+                    && bytesWritten == (DWORD) contents.size()
+                );
+                CloseHandle(fileHandle);
+            }
+
+            // `ReplaceFileW()` preserves the attributes and security descriptor of the existing file,
+            // but fails if the file does not exist yet, in which case it is simply moved into place.
+            if (success) {
+                ScopedTraceTimer traceTimer = { "Rename Temporary File", "io", filePath.wstring() };
+
+                success = (
+                       ReplaceFileW(filePath.c_str(), tempFile, NULL, REPLACEFILE_IGNORE_MERGE_ERRORS, NULL, NULL)
+                    || MoveFileExW(tempFile, filePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)
+                );
+            }
+
+            if (!success)
+                DeleteFileW(tempFile);
+
+            return success;
+
+        }
+
+        std::vector<std::wstring> expandPathPattern ( const std::wstring& pathPattern ) {
+
+            // The path being expanded.
+            std::filesystem::path patternPath = pathPattern;
+            // The paths matched by the components of the `patternPath` processed so far.
+            std::vector<std::filesystem::path> matchedPaths = { patternPath.root_path() };
+            // The list of matched file paths returned by the function.
+            std::vector<std::wstring> expandedPaths = {};
+
+            if ( pathPattern.find_first_of(L"*?") == std::wstring::npos )
+                return { pathPattern };
+
+            for ( const std::filesystem::path& component : patternPath.relative_path() ) {
+                // The Wide-Character String containing the current component of the `patternPath`.
+                std::wstring componentStr = component.wstring();
+                // The paths matched by the `matchedPaths` and the current `component`.
+                std::vector<std::filesystem::path> nextMatchedPaths = {};
+
+                if ( componentStr.find_first_of(L"*?") == std::wstring::npos ) {
+                    for ( const std::filesystem::path& matchedPath : matchedPaths )
+                        nextMatchedPaths.push_back(matchedPath / component);
+                }
+                else {
+                    for ( const std::filesystem::path& matchedPath : matchedPaths ) {
+                        std::error_code errorCode = {};     // Receives any errors raised while iterating over the directory.
+                        std::filesystem::directory_iterator dirItr(
+                            ( matchedPath.empty() ? std::filesystem::path(L".") : matchedPath ),
+                            std::filesystem::directory_options::skip_permission_denied,
+                            errorCode
+                        );
+
+                        if (errorCode)
+                            continue;
+
+                        for ( const std::filesystem::directory_entry& entry : dirItr ) {
+                            if ( matchesWildcardPattern(entry.path().filename().wstring(), componentStr) )
+                                nextMatchedPaths.push_back(matchedPath / entry.path().filename());
+                        }
+                    }
+                }
+
+                matchedPaths = std::move(nextMatchedPaths);
+
+                if ( matchedPaths.empty() )
+                    break;
+            }
+
+            for ( const std::filesystem::path& matchedPath : matchedPaths ) {
+                std::error_code errorCode = {};     // Receives any errors raised while checking the file.
+
+                if ( std::filesystem::is_regular_file(matchedPath, errorCode) )
+                    expandedPaths.push_back( matchedPath.wstring() );
+            }
+
+            std::sort( expandedPaths.begin(), expandedPaths.end() );
+            return expandedPaths;
 
-            // The Wide-Character String wrapped in an `std::optional`
-            // returned by the function.
-            std::optional<std::wstring> tempFilePath = {};
-            // A Null-Terminated Wide-Character String containing the path
-            // to the newly-created Temporary File.
-            WCHAR tempFile[L_tmpnam] = {};
+        }
+
+        // Binary Serialization Functions
+
+        void writeVarint ( std::string& contents, uint64_t value ) {
+
+            do {
+                unsigned char currentByte = (unsigned char) (value & 0x7FU);
+
+                value >>= 7U;
+                contents.push_back( (char) (value > 0ULL ? (currentByte | 0x80U) : currentByte) );
+            } while (value > 0ULL);
+
+        }
 
-            if ( _wtmpnam_s(tempFile) == 0 )
-                tempFilePath = tempFile;
+        void writeBytes ( std::string& contents, std::string_view bytes ) {
 
-            return tempFilePath;
+            writeVarint(contents, bytes.size());
+            contents.append(bytes);
+
+        }
+
+        uint64_t readVarint ( BinaryReader& reader ) {
+
+            uint64_t value = 0ULL;      // The integer being read.
+            unsigned int shift = 0U;    // The number of bits already read into the `value`.
+
+            while ( !reader.failed ) {
+                if ( reader.pos >= reader.contents.size() || shift >= 64U ) {
+                    reader.failed = true;
+                    break;
+                }
+
+                unsigned char currentByte = (unsigned char) reader.contents[reader.pos++];
+
+                value |= ( (uint64_t) (currentByte & 0x7FU) << shift );
+                shift += 7U;
+
+                if ( !(currentByte & 0x80U) )
+                    return value;
+            }
+
+            return 0ULL;
+
+        }
+
+        std::string_view readBytes ( BinaryReader& reader ) {
+
+            uint64_t length = readVarint(reader);   // The length of the string, in bytes.
+
+            if ( reader.failed || length > reader.contents.size() - reader.pos ) {
+                reader.failed = true;
+                return {};
+            }
+
+            reader.pos += length;
+            return reader.contents.substr(reader.pos - length, length);
+
+        }
+
+
+        // Standard Stream Functions
+
+        void useUtf16StandardStreams () {
+
+            _setmode(_fileno(stdout), _O_U16TEXT);
+            _setmode(_fileno(stderr), _O_U16TEXT);
+
+        }
+
+
+        /* MemoryMappedFile */
+        // Class Constructors & Destructors
+
+        MemoryMappedFile::MemoryMappedFile ( const std::wstring& filePath ) {
+
+            this->open(filePath);
+
+        }
+
+        MemoryMappedFile::~MemoryMappedFile () {
+
+            this->close();
+
+        }
+
+        // Instance Methods
+
+        bool MemoryMappedFile::isOpen () const {
+
+            return (this->fileHandle != INVALID_HANDLE_VALUE);
+
+        }
+        HANDLE MemoryMappedFile::getFileHandle () const {
+
+            return this->fileHandle;
+
+        }
+        std::string_view MemoryMappedFile::getContents () const {
+
+            if (this->view == nullptr)
+                return std::string_view();
+
+            return std::string_view(this->view, this->viewSize);
+
+        }
+        bool MemoryMappedFile::open ( const std::wstring& filePath ) {
+
+            LARGE_INTEGER fileSize = {};    // The size of the file in bytes.
+
+            this->close();
+
+            this->fileHandle = CreateFileW(
+                filePath.c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                NULL,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                NULL
+            );
+
+            if (this->fileHandle == INVALID_HANDLE_VALUE)
+                return false;
+
+            if ( !GetFileSizeEx(this->fileHandle, &fileSize) ) {
+                this->close();
+                return false;
+            }
+
+            // Empty files cannot be mapped into memory, and simply have no contents.
+            if (fileSize.QuadPart == 0)
+                return true;
+
+            this->mappingHandle = CreateFileMappingW(this->fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+            if (this->mappingHandle != NULL)
+                this->view = (const char*) MapViewOfFile(this->mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+            if (this->view == nullptr) {
+                this->close();
+                return false;
+            }
+
+            this->viewSize = (size_t) fileSize.QuadPart;
+            return true;
+
+        }
+        void MemoryMappedFile::close () {
+
+            if (this->view != nullptr) {
+                UnmapViewOfFile(this->view);
+                this->view = nullptr;
+                this->viewSize = 0ULL;
+            }
+            if (this->mappingHandle != NULL) {
+                CloseHandle(this->mappingHandle);
+                this->mappingHandle = NULL;
+            }
+            if (this->fileHandle != INVALID_HANDLE_VALUE) {
+                CloseHandle(this->fileHandle);
+                this->fileHandle = INVALID_HANDLE_VALUE;
+            }
 
         }
 
@@ -151,6 +630,110 @@ namespace PROGRAM_NAMESPACE {
         comments(isMainDisplay ? L"Main Display" : L"")
     {}
 
+    // Structure Methods
+
+    std::wstring DisplayMonitorStruct::getStableId () const {
+
+        return std::format(L"{:s}#{:d}", this->monitorName, this->targetId);
+
+    }
+
+
+    /* DisplayMonitorRegistry */
+    // Class Constructors
+
+    DisplayMonitorRegistry::DisplayMonitorRegistry ( DisplayMonitorList iMonitors ) : monitors( std::move(iMonitors) ) {
+
+        this->stableIds.reserve( this->monitors.size() );
+        this->displayIdIndex.reserve( this->monitors.size() );
+        this->identityIndex.reserve( this->monitors.size() );
+
+        for ( monitor_handle_t handle = 0U; handle < this->monitors.size(); handle++ ) {
+            this->stableIds.push_back( this->monitors[handle].getStableId() );
+            this->displayIdIndex.emplace(this->monitors[handle].displayId, handle);
+            this->identityIndex.emplace(getIdentityHash( this->stableIds.back() ), handle);
+        }
+
+    }
+
+    // Static Methods
+
+    size_t DisplayMonitorRegistry::getIdentityHash ( const std::wstring& stableId ) {
+
+        uint64_t hash = 14695981039346656037ULL;    // The running 64-bit FNV-1a Hash of the Identity.
+
+        /**
+         * A lambda function used to add the specified bytes to the running `hash`.
+         *
+         * @param data      A pointer to the first byte being added to the `hash`.
+         * @param length    The number of bytes being added to the `hash`.
+         */
+        auto addToHash = [&hash] ( const void* data, size_t length ) {
+
+            for ( size_t i = 0ULL; i < length; i++ ) {
+                hash ^= ( (const unsigned char*) data )[i];
+                hash *= 1099511628211ULL;
+            }
+
+        };
+
+        addToHash( stableId.data(), stableId.size() * sizeof(wchar_t) );
+
+        return (size_t) hash;
+
+    }
+
+    // Instance Methods
+
+    const DisplayMonitorList& DisplayMonitorRegistry::getMonitors () const {
+
+        return this->monitors;
+
+    }
+
+    size_t DisplayMonitorRegistry::size () const {
+
+        return this->monitors.size();
+
+    }
+
+    const DisplayMonitor& DisplayMonitorRegistry::operator[] ( monitor_handle_t handle ) const {
+
+        return this->monitors[handle];
+
+    }
+
+    const std::wstring& DisplayMonitorRegistry::getStableId ( monitor_handle_t handle ) const {
+
+        return this->stableIds[handle];
+
+    }
+
+    std::optional<DisplayMonitorRegistry::monitor_handle_t> DisplayMonitorRegistry::findByDisplayId ( const std::wstring& displayId ) const {
+
+        auto indexItr = this->displayIdIndex.find(displayId);   // The entry for the `displayId` in the `displayIdIndex`.
+
+        if ( indexItr == this->displayIdIndex.end() )
+            return {};
+
+        return indexItr->second;
+
+    }
+
+    std::optional<DisplayMonitorRegistry::monitor_handle_t> DisplayMonitorRegistry::findByStableId ( const std::wstring& stableId ) const {
+
+        // The entries in the `identityIndex` sharing the Identity Hash of the `stableId`, which may also include hash collisions.
+        auto [indexItr, endItr] = this->identityIndex.equal_range( getIdentityHash(stableId) );
+
+        for ( ; indexItr != endItr; indexItr++ ) {
+            if ( this->stableIds[indexItr->second] == stableId )
+                return indexItr->second;
+        }
+
+        return {};
+
+    }
+
 
     /* Global Variables */
 
@@ -8,6 +8,7 @@
  */
 
 
+#include <cstdint>
 #include <cwctype>
 #include <format>
 #include <filesystem>
@@ -17,6 +18,7 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 #include <Windows.h>
 
@@ -59,6 +61,13 @@ namespace PROGRAM_NAMESPACE {
              * Can be enabled using the `-d` or `--dry-run` flag when launching the program.
              */
             bool dryRun = false;
+            /**
+             * The number of unchanged lines printed before and after each change
+             * to the Terraria Configuration File when performing a Dry Run.
+             * 
+             * Can be changed using the `--diff-context <Lines>` flag when launching the program.
+             */
+            size_t dryRunContextLines = 3ULL;
             /**
              * Indicates if the program should skip reading from or writing to any program files.
              * 
@@ -92,7 +101,9 @@ namespace PROGRAM_NAMESPACE {
              * 
              *      - Alternate Output Buffers are managed by `clear()`ing the `Console` and maintaining
              *        an inner buffer of all of the contents of each Output Buffer, all within
-             *        the original underlying Console Output Buffer.
+             *        the original underlying Console Output Buffer. The cells covered by an Alternate
+             *        Output Buffer are saved when it is created and written back in a single block
+             *        when it is closed, replaying the inner buffer only if that is not possible.
              * 
              *      - Calling `clear()` uses a Virtual Terminal Sequence to clear the characters between
              *        the Current Cursor Position and the Recorded Cursor Position marking the beginning
@@ -126,10 +137,38 @@ namespace PROGRAM_NAMESPACE {
 
         } ProgramSettings;
 
+        /**
+         * A structure type used to read the fields of a binary Program Data File in order,
+         * which stops reading at the first field that is truncated or malformed.
+         * 
+         * Fields are read using `readVarint()` and `readBytes()`, and are written using
+         * `writeVarint()` and `writeBytes()`.
+         */
+        typedef struct BinaryReaderStruct {
+
+            std::string_view contents;  // The raw contents of the Program Data File.
+            size_t pos;                 // The position of the next field within the `contents`.
+            bool failed;                // Indicates if a truncated or malformed field has been read.
+
+        } BinaryReader;
+
     
         /* Global Helper Functions */
         // String Functions
 
+        /**
+         * Convert all of the applicable characters of a Wide-Character String to Lowercase,
+         * writing the result to a caller-supplied buffer.
+         * 
+         * Each character of the specified Wide-Character String is effectively passed to `std::towlower()`.
+         * Runs of ASCII characters are converted several at a time, and the `oLcStr` is only
+         * reallocated if it is not already large enough to hold the result.
+         * 
+         * @param str       The Wide-Character String being converted to lowercase.
+         * @param oLcStr    The buffer whose contents are replaced by the lowercase equivalent
+         *                  of the specified Wide-Character `str`.
+         */
+        void stringToLowercase ( std::wstring_view str, _Out_ std::wstring& oLcStr );
         /**
          * Convert all of the applicable characters of a Wide-Character String to Lowercase.
          * 
@@ -141,11 +180,24 @@ namespace PROGRAM_NAMESPACE {
          * @return      A new Wide-Character String containing the lowercase equivalent
          *              of the specified Wide-Character `str`.
          */
-        std::wstring stringToLowercase ( const std::wstring& str );
+        std::wstring stringToLowercase ( std::wstring_view str );
+        /**
+         * Convert all of the applicable characters of a Wide-Character String to Uppercase,
+         * writing the result to a caller-supplied buffer.
+         * 
+         * Each character of the specified Wide-Character String is effectively passed to `std::towupper()`.
+         * Runs of ASCII characters are converted several at a time, and the `oUcStr` is only
+         * reallocated if it is not already large enough to hold the result.
+         * 
+         * @param str       The Wide-Character String being converted to uppercase.
+         * @param oUcStr    The buffer whose contents are replaced by the uppercase equivalent
+         *                  of the specified Wide-Character `str`.
+         */
+        void stringToUppercase ( std::wstring_view str, _Out_ std::wstring& oUcStr );
         /**
          * Convert all of the applicable characters of a Wide-Character String to Uppercase.
          * 
-         * Each character of the specified Wide-Character String is effectively passed to `std::towlower()`,
+         * Each character of the specified Wide-Character String is effectively passed to `std::towupper()`,
          * concatenated together, and returned as a new Wide-Character String.
          * 
          * @param str   The Wide-Character String being converted to uppercase.
@@ -153,8 +205,22 @@ namespace PROGRAM_NAMESPACE {
          * @return      A new Wide-Character String containing the uppercase equivalent
          *              of the specified Wide-Character `str`.
          */
-        std::wstring stringToUppercase ( const std::wstring& str );
+        std::wstring stringToUppercase ( std::wstring_view str );
 
+        /**
+         * Trim extraneous whitespace characters from the beginning 
+         * and end of the specified Wide-Character String without copying it.
+         * 
+         * Any characters considered to be whitespace by the `std::iswspace()` function
+         * at the beginning or end of the specified Wide-Character `str` will be
+         * excluded from the returned view.
+         * 
+         * @param str   The Wide-Character String being trimmed.
+         * 
+         * @returns     A view of the trimmed contents of the specified Wide-Character `str`,
+         *              which is only valid for as long as the `str` itself is.
+         */
+        std::wstring_view trimStringView ( std::wstring_view str );
         /**
          * Trim extraneous whitespace characters from the beginning 
          * and end of the specified Wide-Character String.
@@ -168,8 +234,20 @@ namespace PROGRAM_NAMESPACE {
          * @returns     A new Wide-Character String containing the trimmed contents
          *              of the specified Wide-Character `str`.
          */
-        std::wstring trimString ( const std::wstring& str );
+        std::wstring trimString ( std::wstring_view str );
 
+        /**
+         * Truncate a Wide-Character String to the specified number of characters,
+         * writing the result to a caller-supplied buffer.
+         * 
+         * Behaves identically to the overload returning a new Wide-Character String, except that
+         * the `oTruncStr` is only reallocated if it is not already large enough to hold the result.
+         * 
+         * @param str           The Wide-Character String being truncated.
+         * @param maxLength     The maximum length of the specified `str` before truncating it.
+         * @param oTruncStr     The buffer whose contents are replaced by the truncated string.
+         */
+        void truncateString ( std::wstring_view str, size_t maxLength, _Out_ std::wstring& oTruncStr );
         /**
          * Truncate a Wide-Character String to the specified number of characters.
          * 
@@ -191,7 +269,19 @@ namespace PROGRAM_NAMESPACE {
          *                      equal to the specified `maxLength`, a copy of the
          *                      specified `str` will be returned without truncation.
          */
-        std::wstring truncateString ( const std::wstring& str, size_t maxLength );
+        std::wstring truncateString ( std::wstring_view str, size_t maxLength );
+        /**
+         * Truncate a Wide-Character Path String to the specified number of characters,
+         * writing the result to a caller-supplied buffer.
+         * 
+         * Behaves identically to the overload returning a new Wide-Character String, except that
+         * the `oTruncStr` is only reallocated if it is not already large enough to hold the result.
+         * 
+         * @param pathStr       The Wide-Character Path String being truncated.
+         * @param maxLength     The maximum length of the specified `pathStr` before truncating it.
+         * @param oTruncStr     The buffer whose contents are replaced by the truncated string.
+         */
+        void truncatePathString ( std::wstring_view pathStr, size_t maxLength, _Out_ std::wstring& oTruncStr );
         /**
          * Truncate a Wide-Character Path String to the specified number of characters.
          * 
@@ -217,30 +307,236 @@ namespace PROGRAM_NAMESPACE {
          *                      equal to the specified `maxLength`, a copy of the
          *                      specified `pathStr` will be returned without truncation.
          */
-        std::wstring truncatePathString ( const std::wstring& pathStr, size_t maxLength );
+        std::wstring truncatePathString ( std::wstring_view pathStr, size_t maxLength );
+
+        /**
+         * Convert a UTF-8 Encoded Narrow-Character String to a Wide-Character String.
+         * 
+         * @param str   The UTF-8 Encoded Narrow-Character String being converted.
+         * 
+         * @returns     A new Wide-Character String containing the converted contents of the `str`.
+         * 
+         *              If the `str` could not be converted, an empty Wide-Character String is returned.
+         */
+        std::wstring utf8ToWideString ( std::string_view str );
+        /**
+         * Convert a Wide-Character String to a UTF-8 Encoded Narrow-Character String.
+         * 
+         * @param str   The Wide-Character String being converted.
+         * 
+         * @returns     A new UTF-8 Encoded Narrow-Character String containing the converted contents of the `str`.
+         * 
+         *              If the `str` could not be converted, an empty Narrow-Character String is returned.
+         */
+        std::string wideStringToUtf8 ( std::wstring_view str );
+
+        /**
+         * Escape a Wide-Character String so that it can be embedded in a JSON String.
+         * 
+         * Quotes, backslashes, and control characters are escaped. The surrounding
+         * quotes of the JSON String are *not* added to the returned string.
+         * 
+         * @param str   The Wide-Character String being escaped.
+         * 
+         * @returns     A new Wide-Character String containing the escaped contents of the `str`.
+         */
+        std::wstring escapeJsonString ( std::wstring_view str );
+
+        /**
+         * Determine if a Wide-Character String matches the specified Wildcard Pattern.
+         * 
+         * Within the `pattern`, `*` matches any sequence of zero or more characters and
+         * `?` matches any single character. All other characters are compared case-insensitively,
+         * consistent with how file names are compared by Windows.
+         * 
+         * @param str       The Wide-Character String being matched.
+         * @param pattern   The Wildcard Pattern the `str` is being matched against.
+         * 
+         * @returns         `true` if the entire `str` matches the `pattern`, otherwise `false`.
+         */
+        bool matchesWildcardPattern ( std::wstring_view str, std::wstring_view pattern );
 
 
         // File Functions
 
         /**
-         * Create a new Temporary File for writing.
+         * Read the entire contents of a UTF-8 Encoded Text File.
          * 
-         * The Temporary File is created by the OS and may be located
-         * in the Temporary File Directory as returned by `GetTempPath()`,
-         * as well as in the Current Working Directory.
+         * @param filePath  The path to the file being read.
          * 
-         * @returns     A Wide-Character String containing the path to the
-         *              newly-created Temporary File, wrapped in an `std::optional` object.
+         * @returns         A Wide-Character String containing the contents of the file,
+         *                  wrapped in an `std::optional` object.
          * 
-         *                  - If the returned path does not contain any path information and
-         *                    is prefixed by a backslash, the Temporary File was created
-         *                    in the Current Working Directory, and the returned path will
-         *                    be relative to the CWD.
+         *                  If the file does not exist or could not be read,
+         *                  an empty `std::optional` object is returned.
+         */
+        std::optional<std::wstring> readTextFile ( const std::filesystem::path& filePath );
+        /**
+         * Atomically replace the contents of a file, creating it if it does not exist yet.
          * 
-         *              If a Temporary File could not be successfully created,
-         *              an empty `std::optional` object is returned.
+         * The `contents` are written to a new Temporary File in the *same directory* as the file
+         * using a single Write-Through `WriteFile()` call, which is then swapped in for the file
+         * using `ReplaceFileW()` (or `MoveFileExW()` if the file does not exist yet).
+         * 
+         * As the Temporary File is always on the same volume as the file, swapping it in is a cheap
+         * metadata-only operation, rather than a copy of the contents across volumes as can happen
+         * when a file in the Temporary File Directory is moved into a OneDrive-redirected folder.
+         * Readers of the file only ever observe either the old or the new contents.
+         * 
+         * @param filePath  The path to the file being written. The directory containing
+         *                  the file must already exist.
+         * 
+         * @param contents  The new contents of the file.
+         * 
+         * @returns         `true` on success and `false` on failure, in which case
+         *                  the file is left unmodified and the Temporary File is deleted.
          */
-        std::optional<std::wstring> createTempFile ();
+        bool writeFileAtomically ( const std::filesystem::path& filePath, std::string_view contents );
+
+        /**
+         * Expand a path containing Wildcard Patterns into the paths of the files it matches.
+         * 
+         * Any component of the `pathPattern` may contain the `*` and `?` Wildcard Characters
+         * supported by `matchesWildcardPattern()`, allowing patterns such as
+         * `C:\Users\*\Documents\My Games\Terraria\config.json` to be used.
+         * 
+         * @param pathPattern   A Wide-Character String containing the path being expanded.
+         * 
+         * @returns             A list of Wide-Character Strings containing the paths of each
+         *                      of the existing files matched by the `pathPattern`, sorted alphabetically.
+         * 
+         *                      If the `pathPattern` does not contain any Wildcard Characters,
+         *                      the returned list contains only the `pathPattern` itself,
+         *                      regardless of whether or not the file exists.
+         */
+        std::vector<std::wstring> expandPathPattern ( const std::wstring& pathPattern );
+
+
+        // Binary Serialization Functions
+
+        /**
+         * Append an unsigned Variable-Length Integer of 7 bits per byte to the contents of a binary Program Data File.
+         * 
+         * @param contents  The contents of the Program Data File.
+         * @param value     The integer being appended.
+         */
+        void writeVarint ( std::string& contents, uint64_t value );
+        /**
+         * Append a string to the contents of a binary Program Data File, preceded by its length in bytes.
+         * 
+         * @param contents  The contents of the Program Data File.
+         * @param bytes     The raw bytes of the string being appended.
+         */
+        void writeBytes ( std::string& contents, std::string_view bytes );
+        /**
+         * Read an unsigned Variable-Length Integer written by `writeVarint()`.
+         * 
+         * @param reader    The `BinaryReader` being read from.
+         * 
+         * @returns         The integer, or `0` if the `reader` has failed.
+         */
+        uint64_t readVarint ( BinaryReader& reader );
+        /**
+         * Read a length-prefixed string written by `writeBytes()`.
+         * 
+         * @param reader    The `BinaryReader` being read from.
+         * 
+         * @returns         A view of the raw bytes of the string within the `contents` of the `reader`,
+         *                  which is empty if the `reader` has failed.
+         */
+        std::string_view readBytes ( BinaryReader& reader );
+
+
+        // Standard Stream Functions
+
+        /**
+         * Switch the Standard Output and Standard Error Streams into UTF-16 Text Mode.
+         * 
+         * Otherwise, `std::wcout` and `std::wcerr` convert their output using the "C" Locale, and the first
+         * character that cannot be converted (such as in the name of a User Profile) sets their `badbit`,
+         * silently discarding all further output. Only Wide-Character output may be written to either stream
+         * once this function has been called, so it is only used where the `Console` is never created.
+         */
+        void useUtf16StandardStreams ();
+
+
+        /* Global Helper Classes */
+
+        /**
+         * A Read-Only View of the contents of a file that has been mapped into memory.
+         * 
+         * Mapping a file into memory allows its contents to be scanned in a single pass directly from
+         * the OS File Cache, without copying the contents into an intermediate buffer or converting them
+         * into Wide Characters first. The file remains open for reading, and cannot be replaced,
+         * until the `MemoryMappedFile` is `close()`d or destroyed.
+         */
+        class MemoryMappedFile {
+
+            /* Instance Properties */
+            private:
+                HANDLE fileHandle = INVALID_HANDLE_VALUE;   // The handle to the file being mapped.
+                HANDLE mappingHandle = NULL;                // The handle to the File Mapping Object for the file.
+                const char* view = nullptr;                 // A pointer to the first byte of the Mapped View of the file.
+                size_t viewSize = 0ULL;                     // The number of bytes in the Mapped View of the file.
+
+
+            /* Class Constructors & Destructors */
+            public:
+                /**
+                 * Construct a new `MemoryMappedFile` by mapping the specified file into memory.
+                 * 
+                 * Use `isOpen()` to determine if the file was successfully mapped into memory.
+                 * 
+                 * @param filePath  A Wide-Character String containing the path to the file being mapped.
+                 */
+                MemoryMappedFile ( const std::wstring& filePath );
+                MemoryMappedFile ( const MemoryMappedFile& ) = delete;
+                MemoryMappedFile& operator= ( const MemoryMappedFile& ) = delete;
+
+                /**
+                 * Destroy the `MemoryMappedFile`, unmapping and closing the file.
+                 */
+                ~MemoryMappedFile ();
+
+
+            /* Instance Methods */
+            public:
+                /**
+                 * Determine if the file was successfully opened and mapped into memory.
+                 * 
+                 * @returns     `true` if the file is open, otherwise `false`.
+                 */
+                bool isOpen () const;
+                /**
+                 * Get the handle to the file, such as for retrieving information about the file that was mapped.
+                 * 
+                 * @returns     The handle to the file, which remains owned by the `MemoryMappedFile`,
+                 *              or `INVALID_HANDLE_VALUE` if the file is not open.
+                 */
+                HANDLE getFileHandle () const;
+                /**
+                 * Get the contents of the file.
+                 * 
+                 * @returns     An `std::string_view` of the raw bytes of the file,
+                 *              which remains valid until the `MemoryMappedFile` is `close()`d.
+                 * 
+                 *              If the file is empty or is not open, an empty `std::string_view` is returned.
+                 */
+                std::string_view getContents () const;
+                /**
+                 * Map the specified file into memory, closing any file that is currently open.
+                 * 
+                 * @param filePath  A Wide-Character String containing the path to the file being mapped.
+                 * 
+                 * @returns         `true` if the file was successfully opened, otherwise `false`.
+                 */
+                bool open ( const std::wstring& filePath );
+                /**
+                 * Unmap and close the file, if it is open.
+                 */
+                void close ();
+
+        };
         
     }
 
@@ -309,6 +605,9 @@ namespace PROGRAM_NAMESPACE {
             std::wstring displayId;                 // The "Unique" Display Identifier of the Connected Monitor.
             std::wstring monitorName;               // The Human-Readable Name of the Connected Monitor.
             DisplayResolution currentResolution;    // The Current Display Resolution of the Connected Monitor.
+            UINT32 targetId = 0U;                   // The Target ID of the Display Path of the Connected Monitor, which survives Display ID reassignments.
+            LUID adapterId = {};                    // The Locally-Unique ID of the Display Adapter driving the Display Path of the Connected Monitor.
+            std::wstring devicePath = {};           // The Device Interface Path of the Connected Monitor (e.g., `\\?\DISPLAY#DEL40F7#...`).
 
             /**
              * Additional Comments about the Connected Monitor.
@@ -342,11 +641,142 @@ namespace PROGRAM_NAMESPACE {
                 bool isMainDisplay = false
             );
 
+
+        /* Structure Methods */
+        public:
+            /**
+             * Get the Stable Identity of the Connected Monitor.
+             * 
+             * Unlike the `displayId`, which Windows may reassign to a different
+             * Connected Monitor at any time, the Stable Identity is composed of the
+             * `monitorName` and the `targetId`, which both remain the same for as long as
+             * the Connected Monitor stays connected to the same output.
+             * 
+             * @returns     A Wide-Character String containing the Stable Identity of the Connected Monitor.
+             */
+            std::wstring getStableId () const;
+
     } DisplayMonitor;
 
     // A collection of `DisplayMonitor` objects representing the Connected Display Monitors.
     typedef std::vector<DisplayMonitor> DisplayMonitorList;
 
+    /**
+     * An immutable, indexed collection of `DisplayMonitor` objects representing the Connected Display Monitors.
+     * 
+     * Each Connected Display Monitor is identified by a small integer Handle, which is its position within the
+     * `DisplayMonitorRegistry`, allowing the Main Menu and the functions used to read and write the Active Display Monitor
+     * to pass Handles around instead of copying `DisplayMonitor` objects.
+     * 
+     * The Connected Display Monitors are also indexed by their Display ID and by a precomputed hash of
+     * their Stable Identity (see `DisplayMonitor::getStableId()`), which is the same identity used by
+     * Watch Mode, Apply-Last Mode, and Monitor Presets, so that neither lookup needs to compare the
+     * Display ID or Stable Identity of every `DisplayMonitor`.
+     */
+    class DisplayMonitorRegistry {
+
+        /* Type Definitions */
+        public:
+            // An integer type representing the Handle of a Connected Display Monitor within a `DisplayMonitorRegistry`.
+            typedef unsigned short monitor_handle_t;
+
+
+        /* Instance Properties */
+        private:
+            DisplayMonitorList monitors = {};                                       // The Connected Display Monitors, in order of their Handles.
+            std::vector<std::wstring> stableIds = {};                               // The Stable Identity of each of the `monitors`.
+            std::unordered_map<std::wstring, monitor_handle_t> displayIdIndex = {}; // A Map of Display IDs to Handles.
+            /**
+             * A Map of Identity Hashes to Handles, which keeps every Connected Display Monitor sharing the same Identity Hash,
+             * as the Stable Identity of each candidate is compared when it is looked up.
+             */
+            std::unordered_multimap<size_t, monitor_handle_t> identityIndex = {};
+
+
+        /* Class Constructors */
+        public:
+            /**
+             * Construct a new, empty `DisplayMonitorRegistry`.
+             */
+            DisplayMonitorRegistry () = default;
+            /**
+             * Construct a new `DisplayMonitorRegistry` containing the specified Connected Display Monitors.
+             * 
+             * @param iMonitors     The `DisplayMonitorList` containing the Connected Display Monitors,
+             *                      which are assigned Handles in the order they appear.
+             */
+            DisplayMonitorRegistry ( DisplayMonitorList iMonitors );
+
+
+        /* Static Methods */
+        public:
+            /**
+             * Compute the Identity Hash of the specified Stable Identity.
+             * 
+             * @param stableId  The Stable Identity of a Display Monitor, as returned by `DisplayMonitor::getStableId()`.
+             * 
+             * @returns         The 64-bit FNV-1a Hash of the `stableId`.
+             */
+            static size_t getIdentityHash ( const std::wstring& stableId );
+
+
+        /* Instance Methods */
+        public:
+            /**
+             * Get the Connected Display Monitors in the `DisplayMonitorRegistry`.
+             * 
+             * @returns     A constant reference to the `DisplayMonitorList`, in which
+             *              the position of each `DisplayMonitor` is its Handle.
+             */
+            const DisplayMonitorList& getMonitors () const;
+            /**
+             * Get the number of Connected Display Monitors in the `DisplayMonitorRegistry`.
+             * 
+             * @returns     The number of Connected Display Monitors.
+             */
+            size_t size () const;
+            /**
+             * Get the Connected Display Monitor identified by the specified Handle.
+             * 
+             * @param handle    The Handle of the Connected Display Monitor, which must be less than `size()`.
+             * 
+             * @returns         A constant reference to the `DisplayMonitor`.
+             */
+            const DisplayMonitor& operator[] ( monitor_handle_t handle ) const;
+            /**
+             * Get the precomputed Stable Identity of the Connected Display Monitor identified by the specified Handle.
+             * 
+             * @param handle    The Handle of the Connected Display Monitor, which must be less than `size()`.
+             * 
+             * @returns         The Stable Identity, as returned by `DisplayMonitor::getStableId()`.
+             */
+            const std::wstring& getStableId ( monitor_handle_t handle ) const;
+
+            /**
+             * Find the Connected Display Monitor with the specified Display ID.
+             * 
+             * @param displayId     The Display ID of the Connected Display Monitor (e.g., `\\.\DISPLAY1`).
+             * 
+             * @returns             The Handle of the Connected Display Monitor, wrapped in an `std::optional` object.
+             *                      If no Connected Display Monitor has the `displayId`, an empty `std::optional` will be returned.
+             */
+            std::optional<monitor_handle_t> findByDisplayId ( const std::wstring& displayId ) const;
+            /**
+             * Find the Connected Display Monitor with the specified Stable Identity.
+             * 
+             * This allows a Connected Display Monitor to be found again in a new `DisplayMonitorRegistry`
+             * after the Display Topology has changed, even if its Display ID has been reassigned.
+             * Only the Connected Display Monitors sharing the Identity Hash of the `stableId` are compared to it.
+             * 
+             * @param stableId  The Stable Identity of the Display Monitor, as returned by `DisplayMonitor::getStableId()`.
+             * 
+             * @returns         The Handle of the first Connected Display Monitor with the `stableId`, wrapped in an `std::optional` object.
+             *                  If no Connected Display Monitor has the `stableId`, an empty `std::optional` will be returned.
+             */
+            std::optional<monitor_handle_t> findByStableId ( const std::wstring& stableId ) const;
+
+    };
+
 
     /* Global Constants */
 
@@ -361,13 +791,20 @@ namespace PROGRAM_NAMESPACE {
      * @see PROGRAM_TITLE for the Full Title of the Program.
      */
     const std::wstring PRIMARY_PROGRAM_TITLE = L"Terraria Monitor Tool";
+    /**
+     * A Wide-Character String containing the Author of the Program.
+     * 
+     * @see PROGRAM_TITLE for the Full Title of the Program.
+     */
+    const std::wstring PROGRAM_AUTHOR = L"FusedKush";
     /**
      * A Wide-Character String containing the Full Title of the Program.
      * 
      * @see PRIMARY_PROGRAM_TITLE for the Primary Title of the Program.
+     * @see PROGRAM_AUTHOR for the Author of the Program.
      * @see PROGRAM_VERSION for the Version Number String for the Program.
      */
-    const std::wstring PROGRAM_TITLE = std::format(L"{:s} by FusedKush (v{:s})", PRIMARY_PROGRAM_TITLE, PROGRAM_VERSION);
+    const std::wstring PROGRAM_TITLE = std::format(L"{:s} by {:s} (v{:s})", PRIMARY_PROGRAM_TITLE, PROGRAM_AUTHOR, PROGRAM_VERSION);
 
     // The filename of the Terraria Configuration File.
     const std::wstring CONFIG_FILE_NAME = L"config.json";
@@ -426,7 +863,36 @@ namespace PROGRAM_NAMESPACE {
          * Indicates that the Connected Display Monitors could not
          * be retrieved from the Windows API due to an error.
          */
-        DISPLAY_MONITOR_QUERY_FAILURE = 0x20
+        DISPLAY_MONITOR_QUERY_FAILURE = 0x20,
+        /**
+         * Indicates that the Command-Line Arguments used for Non-Interactive Mode
+         * were invalid, such as when the specified Display Monitor was not found
+         * or no Terraria Configuration Files were matched.
+         */
+        INVALID_ARGUMENTS = 0x30,
+        /**
+         * Indicates that one or more of the Terraria Configuration Files
+         * could not be modified while running in Non-Interactive Mode.
+         */
+        BATCH_MODE_FAILURE = 0x40,
+        /**
+         * Indicates that one or more of the Terraria Configuration Files
+         * could not be restored from a Backup Generation.
+         */
+        BACKUP_RESTORE_FAILURE = 0x50,
+        /**
+         * Indicates that the Display Monitor assigned to the most recently used
+         * Terraria Configuration File could not be set again using `--apply-last`,
+         * such as when no Terraria Configuration File has been used yet
+         * or its assigned Display Monitor is no longer connected.
+         */
+        APPLY_LAST_FAILURE = 0x60,
+        /**
+         * Indicates that a Monitor Preset could not be applied, saved, or deleted,
+         * such as when no Monitor Preset with the specified name exists or one or more
+         * of its Terraria Configuration Files could not be modified.
+         */
+        PRESET_FAILURE = 0x70
     
     };
 